@@ -28,6 +28,11 @@
  *   BENCH_SHADOWS    1=dir light casts PSSM shadows, 0=off (default 1)
  *   BENCH_MOVE_POSES 1=re-push every box pose each frame   (default 1)
  *                    (mimics gz-sim RenderUtil unconditional pose update)
+ *                    2=same, batched through Scene::SetLocalPoses
+ *   BENCH_SHARED_MAT 1=all boxes share one material instead of a per-box
+ *                    clone (SetMaterial(mat, false))       (default 0)
+ *   BENCH_STATIC     1=mark boxes and ground static (Visual::SetStatic)
+ *                                                          (default 0)
  *   BENCH_OFFSCREEN  1=place boxes BEHIND camera (frustum-culled, never drawn)
  *                                                          (default 0)
  *   BENCH_W BENCH_H  render target size                    (default 800x600)
@@ -77,6 +82,8 @@ int main(int _argc, char **_argv)
   const int warmup    = envi("BENCH_WARMUP", 30);
   const int shadows   = envi("BENCH_SHADOWS", 1);
   const int movePoses = envi("BENCH_MOVE_POSES", 1);
+  const int sharedMat = envi("BENCH_SHARED_MAT", 0);
+  const int staticVis = envi("BENCH_STATIC", 0);
   const int offscreen = envi("BENCH_OFFSCREEN", 0);
   const int W         = envi("BENCH_W", 800);
   const int H         = envi("BENCH_H", 600);
@@ -131,8 +138,10 @@ int main(int _argc, char **_argv)
     const double x = offscreen ? -50.0 : depth;
     box->SetLocalPosition(x, y, z);
     box->SetLocalScale(0.35, 0.35, 0.35);
-    box->SetMaterial(mat);
+    box->SetMaterial(mat, sharedMat == 0);
     root->AddChild(box);
+    if (staticVis)
+      box->SetStatic(true);
     boxes.push_back(box);
   }
 
@@ -147,6 +156,8 @@ int main(int _argc, char **_argv)
     gmat->SetReceiveShadows(true);
     ground->SetMaterial(gmat);
     root->AddChild(ground);
+    if (staticVis)
+      ground->SetStatic(true);
   }
 
   CameraPtr camera = scene->CreateCamera("camera");
@@ -159,8 +170,22 @@ int main(int _argc, char **_argv)
   camera->SetAntiAliasing(2);
   root->AddChild(camera);
 
+  std::vector<unsigned int> boxIds;
+  std::vector<math::Pose3d> boxPoses;
+  for (auto &b : boxes)
+  {
+    boxIds.push_back(b->Id());
+    boxPoses.push_back(b->LocalPose());
+  }
+
   auto reapply = [&]()
   {
+    if (movePoses == 2)
+    {
+      scene->SetLocalPoses(boxIds.data(), boxPoses.data(),
+          static_cast<unsigned int>(boxIds.size()));
+      return;
+    }
     for (auto &b : boxes)
       b->SetLocalPose(b->LocalPose());
   };
@@ -228,8 +253,14 @@ int main(int _argc, char **_argv)
   const double coresBusy = cpuTotalSec / wallTotalSec;
   const double achievedFps = frames / wallTotalSec;
 
+  // Draw calls of the last frame. Boxes sharing a mesh and a material are
+  // batched by instancing, so draws are far fewer than drawn instances.
+  const unsigned int draws = scene->DrawCallCount();
+  const unsigned int instances = scene->DrawnInstanceCount();
+
   std::cout << "BENCH engine=" << engineName << " N=" << N
             << " shadows=" << shadows << " poses=" << movePoses
+            << " static=" << staticVis
             << " offscreen=" << offscreen << " capFps=" << capFps << " "
             << W << "x" << H << " frames=" << frames << "\n"
             << "  achieved fps:   " << achievedFps << "\n"
@@ -238,13 +269,16 @@ int main(int _argc, char **_argv)
             << "  cpu/frame  ms:  mean=" << cpuPerFrame << "\n"
             << "  CORES BUSY:     " << coresBusy
             << "  (total CPU " << cpuTotalSec << "s / wall " << wallTotalSec
-            << "s)\n";
+            << "s)\n"
+            << "  draw calls:     " << draws << "  instances=" << instances
+            << "  (" << (draws > 0 ? static_cast<double>(instances) / draws : 0.0)
+            << " instances/draw, shared material=" << sharedMat << ")\n";
 
   // Stable, grep-friendly one-liner.
   std::cout << "CSV," << engineName << "," << N << "," << shadows << ","
             << movePoses << "," << offscreen << "," << W << "x" << H << ","
             << wMin << "," << wMed << "," << wMean << "," << cpuPerFrame
-            << "\n";
+            << "," << draws << "," << instances << "\n";
 
   scene->DestroySensor(camera);
   engine->DestroyScene(scene);
@@ -23,6 +23,7 @@
 #include <gz/math/Matrix4.hh>
 
 #include "gz/rendering/config.hh"
+#include "gz/rendering/FrameView.hh"
 #include "gz/rendering/Image.hh"
 #include "gz/rendering/PixelFormat.hh"
 #include "gz/rendering/Sensor.hh"
@@ -52,6 +53,10 @@ namespace gz
       public: typedef std::function<void(const void*, unsigned int,
           unsigned int, unsigned int, const std::string&)> NewFrameListener;
 
+      /// \brief Callback function for borrowed frame view listeners
+      public: typedef std::function<void(const FrameView &)>
+          FrameViewListener;
+
       /// \brief Destructor
       public: virtual ~Camera();
 
@@ -364,6 +369,47 @@ namespace gz
       /// \internal
       /// \brief Notify that shadows are dirty and need to be regenerated
       public: virtual void SetShadowsDirty() = 0;
+
+      /// \brief Set the number of frames by which GPU to CPU readback of
+      /// this camera's output may lag behind rendering. With a latency of N,
+      /// the download of frame k is queued and the completed download of
+      /// frame k-N is delivered, so the CPU does not stall waiting on the
+      /// GPU. No data is delivered during the first N frames. The default
+      /// of 0 reads back each frame synchronously.
+      /// Not all render engines support pipelined readback, in which case
+      /// the value is stored but has no effect.
+      /// \param[in] _frames Frames of readback latency.
+      public: virtual void SetReadbackLatency(unsigned int _frames) = 0;
+
+      /// \brief Get the number of frames of GPU to CPU readback latency.
+      /// \return Frames of readback latency.
+      /// \sa SetReadbackLatency
+      public: virtual unsigned int ReadbackLatency() const = 0;
+
+      /// \brief Subscribe to a read-only view of each new frame, pointing
+      /// straight into the memory the render engine mapped for readback.
+      /// This avoids the copy into the sensor's own buffer that the regular
+      /// frame events require. The view is only valid for the duration of
+      /// the callback. Sensors that do not support borrowed frames never
+      /// invoke the callback.
+      /// \param[in] _listener Callback invoked with the frame view
+      /// \return Connection pointer; the subscription ends when it is
+      /// destroyed.
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+          FrameViewListener _listener) = 0;
+
+      /// \brief Provide a buffer that the sensor fills with its published
+      /// frame instead of its internally allocated buffer. The regular frame
+      /// event then hands out a pointer to this buffer, so subscribers do not
+      /// need to copy the data out. The buffer must hold at least one full
+      /// frame in the published layout and must outlive the sensor or be
+      /// removed by passing nullptr. A buffer that is too small is ignored.
+      /// The data accessors of the sensor keep returning the latest frame
+      /// after the buffer is replaced or removed.
+      /// \param[in] _buffer Destination buffer, nullptr to use the internal
+      /// buffer again
+      /// \param[in] _size Size of the buffer in bytes
+      public: virtual void SetOutputBuffer(void *_buffer, size_t _size) = 0;
     };
     }
   }
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_FRAMEVIEW_HH_
+#define GZ_RENDERING_FRAMEVIEW_HH_
+
+#include <memory>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/PixelFormat.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Read-only view of a sensor frame that borrows the memory the
+    /// render engine mapped for GPU to CPU readback, so subscribers can read
+    /// the frame without the sensor copying it into its own buffer first.
+    /// The data is only valid while the view callback runs; Valid() becomes
+    /// false as soon as the sensor reclaims the memory.
+    /// \sa Camera::ConnectNewFrameView
+    struct GZ_RENDERING_VISIBLE FrameView
+    {
+      /// \brief Pointer to the first pixel of the frame
+      const void *data = nullptr;
+
+      /// \brief Frame width in pixels
+      unsigned int width = 0u;
+
+      /// \brief Frame height in pixels
+      unsigned int height = 0u;
+
+      /// \brief Number of bytes between the start of consecutive rows. May be
+      /// larger than width times the pixel size because of GPU row alignment.
+      unsigned int rowPitch = 0u;
+
+      /// \brief Pixel format of the mapped data. This is the format of the
+      /// GPU texture, which may hold more channels than the sensor publishes
+      /// through its regular frame event.
+      PixelFormat format = PF_UNKNOWN;
+
+      /// \brief Lifetime token. Expires once the mapped memory is released.
+      std::weak_ptr<const void> lifetime;
+
+      /// \brief Check whether the data can still be read
+      /// \return True if the mapped memory has not been released yet
+      bool Valid() const
+      {
+        return this->data != nullptr && !this->lifetime.expired();
+      }
+    };
+    }
+  }
+}
+#endif
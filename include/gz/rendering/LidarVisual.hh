@@ -45,7 +45,12 @@ namespace gz
       LVT_POINTS         = 2,
 
       /// \brief Triangle strips visual
-      LVT_TRIANGLE_STRIPS = 3
+      LVT_TRIANGLE_STRIPS = 3,
+
+      /// \brief Points visual placed by the GPU from the ranges. Each update
+      /// only uploads the ranges, the ray directions are computed once.
+      /// Not supported by all render engines.
+      LVT_GPU_POINTS = 4
     };
 
     /// \class LidarVisual LidarVisual.hh gz/rendering/LidarVisual
@@ -75,6 +80,15 @@ namespace gz
       public: virtual void SetPoints(const std::vector<double> &_points,
                         const std::vector<gz::math::Color> &_colors) = 0;
 
+      /// \brief Set lidar points to be visualised from single precision
+      /// ranges, such as the output of GpuRays, without converting them
+      /// \param[in] _ranges Ranges of the rays, one every _stride floats
+      /// \param[in] _count Number of rays
+      /// \param[in] _stride Number of floats between the ranges of two
+      /// consecutive rays, e.g. the number of channels of a GpuRays frame
+      public: virtual void SetPoints(const float *_ranges,
+                        unsigned int _count, unsigned int _stride = 1u) = 0;
+
       /// \brief Set minimum vertical angle
       /// \param[in] _minVerticalAngle Minimum vertical angle
       public: virtual void SetMinVerticalAngle(
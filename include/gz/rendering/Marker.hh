@@ -143,6 +143,17 @@ namespace gz
       /// \param[in] _value The new positional vector of the point
       public: virtual void SetPoint(unsigned int _index,
                   const gz::math::Vector3d &_value) = 0;
+
+      /// \brief Replace all the points of the marker. Prefer it over
+      /// clearing and adding the points one by one when updating markers
+      /// with many points every frame: render engines may then only upload
+      /// the points that changed.
+      /// \param[in] _points Positions of the points, stored as _count
+      /// consecutive x, y, z triples
+      /// \param[in] _count Number of points
+      /// \param[in] _color The color all the points are set to
+      public: virtual void SetPoints(const float *_points, size_t _count,
+                  const gz::math::Color &_color = gz::math::Color::White) = 0;
     };
     }
   }
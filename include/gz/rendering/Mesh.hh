@@ -40,6 +40,12 @@ namespace gz
       /// \brief Destructor
       public: virtual ~Mesh();
 
+      /// \brief Check whether the mesh is loaded. A mesh created with
+      /// Scene::CreateMeshAsync shows a placeholder until it is loaded,
+      /// other meshes are loaded when they are created.
+      /// \return True if the mesh is loaded
+      public: virtual bool IsLoaded() const = 0;
+
       /// \brief Check whether the mesh has skeleton
       /// \return True if the mesh has skeleton
       public: virtual bool HasSkeleton() const = 0;
@@ -77,6 +77,22 @@ namespace gz
 
       /// \brief Denotes if the loaded sub-mesh vertices should be centered
       public: bool centerSubMesh = false;
+
+      /// \brief Store the vertices of the loaded mesh in a smaller format
+      /// that costs some precision, to save GPU memory and bandwidth. With
+      /// ogre2, vertex positions become half floats where they fit in the
+      /// half float range and keep at least 1/1024 of the size of their
+      /// submesh as precision. Normals
+      /// and texture coordinates are compressed in every case. Engines
+      /// without a compressed format ignore it.
+      public: bool compressVertices = false;
+
+      /// \brief Number of simplified levels of detail to generate for the
+      /// loaded mesh, each with about half the triangles of the previous
+      /// one. Cameras switch to a level once its error spans less than a
+      /// pixel of their images. 0 to only render the full mesh. Engines
+      /// without levels of detail ignore it.
+      public: unsigned int lodLevels = 0u;
     };
     }
   }
@@ -337,6 +337,24 @@ namespace gz
       /// \param[in] _key Unique key
       /// \return True if node has custom data with the specified key
       public: virtual bool HasUserData(const std::string &_key) const = 0;
+
+      /// \brief Mark this node as changed so that it is visited by the next
+      /// Scene::PreRender. The mark is propagated to all ancestors. Setters
+      /// that affect rendering mark the node automatically, so this only
+      /// needs to be called for changes made outside of the rendering API.
+      public: virtual void MarkPreRenderDirty() = 0;
+
+      /// \brief Check if this node or any node in its subtree needs to be
+      /// visited by the next Scene::PreRender.
+      /// \return True if the subtree of this node needs PreRender
+      public: virtual bool PreRenderDirty() const = 0;
+
+      /// \brief Call PreRender on this node if its subtree needs it, skipping
+      /// descendant subtrees that have not changed since their last
+      /// PreRender.
+      /// \return Number of nodes whose PreRender was called, including this
+      /// node. Zero if the whole subtree was skipped.
+      public: virtual unsigned int PreRenderIfDirty() = 0;
     };
     }
   }
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_POINTCLOUDVISUAL_HH_
+#define GZ_RENDERING_POINTCLOUDVISUAL_HH_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <gz/math/Color.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Export.hh"
+#include "gz/rendering/RenderTypes.hh"
+#include "gz/rendering/Visual.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class PointCloudVisual PointCloudVisual.hh
+    /// gz/rendering/PointCloudVisual.hh
+    //
+    /// \brief A visual for large point clouds, such as accumulated maps of
+    /// hundreds of millions of points.
+    ///
+    /// Points are appended in batches and sorted into an octree in the
+    /// background. Every camera only draws the octree nodes inside its
+    /// frustum, down to the level where the spacing between points is
+    /// smaller than ScreenSpaceError() pixels, and at most PointBudget()
+    /// points. The nodes are uploaded to the GPU a few at a time, at most
+    /// UploadBudget() points per frame, and the nodes least recently drawn
+    /// are evicted when more than GpuPointBudget() points are resident.
+    /// The cost of a frame is thus bounded by the budgets rather than by
+    /// the size of the cloud.
+    class GZ_RENDERING_VISIBLE PointCloudVisual :
+      public virtual Visual
+    {
+      /// \brief Destructor
+      public: virtual ~PointCloudVisual();
+
+      /// \brief Append points of a single color to the cloud.
+      /// Points with non finite coordinates are skipped.
+      /// \param[in] _points Coordinates of the points in the frame of the
+      /// visual, 3 floats per point
+      /// \param[in] _count Number of points
+      /// \param[in] _color Color of the points
+      public: virtual void AddPoints(const float *_points, size_t _count,
+                  const math::Color &_color = math::Color::White) = 0;
+
+      /// \brief Append colored points to the cloud.
+      /// Points with non finite coordinates are skipped.
+      /// \param[in] _points Coordinates of the points in the frame of the
+      /// visual, 3 floats per point
+      /// \param[in] _colors Colors of the points, 4 bytes per point in RGBA
+      /// order
+      /// \param[in] _count Number of points
+      public: virtual void AddPoints(const float *_points,
+                  const uint8_t *_colors, size_t _count) = 0;
+
+      /// \brief Remove all the points of the cloud
+      public: virtual void ClearPoints() = 0;
+
+      /// \brief Get the number of points added to the cloud
+      /// \return Number of points
+      public: virtual size_t PointCount() const = 0;
+
+      /// \brief Get the number of points drawn by the last camera that
+      /// rendered the cloud
+      /// \return Number of points drawn
+      public: virtual size_t DrawnPointCount() const = 0;
+
+      /// \brief Set the size of the points in pixels
+      /// \param[in] _size Size of the points
+      public: virtual void SetSize(double _size) = 0;
+
+      /// \brief Get the size of the points in pixels
+      /// \return Size of the points
+      public: virtual double Size() const = 0;
+
+      /// \brief Set the largest spacing between two points on screen, in
+      /// pixels, before a camera draws a finer level of the octree.
+      /// Smaller values draw more points.
+      /// \param[in] _pixels Screen space error in pixels
+      public: virtual void SetScreenSpaceError(double _pixels) = 0;
+
+      /// \brief Get the screen space error in pixels
+      /// \return Screen space error
+      /// \sa SetScreenSpaceError
+      public: virtual double ScreenSpaceError() const = 0;
+
+      /// \brief Set the maximum number of points a camera draws
+      /// \param[in] _count Maximum number of points drawn per camera
+      public: virtual void SetPointBudget(size_t _count) = 0;
+
+      /// \brief Get the maximum number of points a camera draws
+      /// \return Maximum number of points drawn per camera
+      public: virtual size_t PointBudget() const = 0;
+
+      /// \brief Set the maximum number of points uploaded to the GPU every
+      /// frame. A node larger than the budget is still uploaded when it is
+      /// the only one pending.
+      /// \param[in] _count Maximum number of points uploaded per frame
+      public: virtual void SetUploadBudget(size_t _count) = 0;
+
+      /// \brief Get the maximum number of points uploaded every frame
+      /// \return Maximum number of points uploaded per frame
+      public: virtual size_t UploadBudget() const = 0;
+
+      /// \brief Set the maximum number of points kept in GPU memory
+      /// \param[in] _count Maximum number of resident points
+      public: virtual void SetGpuPointBudget(size_t _count) = 0;
+
+      /// \brief Get the maximum number of points kept in GPU memory
+      /// \return Maximum number of resident points
+      public: virtual size_t GpuPointBudget() const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -17,6 +17,8 @@
 #ifndef GZ_RENDERING_RAYQUERY_HH_
 #define GZ_RENDERING_RAYQUERY_HH_
 
+#include <vector>
+
 #include <gz/utils/SuppressWarning.hh>
 #include <gz/math/Vector3.hh>
 
@@ -136,6 +138,23 @@ namespace gz
       /// \return A vector of intersection results
       public: virtual RayQueryResult ClosestPoint(
             bool _forceSceneUpdate = true) = 0;
+
+      /// \brief Compute the closest intersection of many rays in one call.
+      /// The origin and direction set on the ray query are not used nor
+      /// changed. The rays are always intersected on the CPU, even if a
+      /// camera was set with SetFromCamera. Engines may share the scene
+      /// traversal between rays and spread them across threads, which is
+      /// much faster than calling ClosestPoint for every ray.
+      /// \param[in] _origins Origin of every ray
+      /// \param[in] _directions Direction of every ray, must have as many
+      /// elements as _origins
+      /// \param[in] _forceSceneUpdate See ClosestPoint
+      /// \return Closest intersection of every ray, in the order of the
+      /// rays. Empty if the sizes of _origins and _directions differ.
+      public: virtual std::vector<RayQueryResult> ClosestPoints(
+            const std::vector<math::Vector3d> &_origins,
+            const std::vector<math::Vector3d> &_directions,
+            bool _forceSceneUpdate = true) = 0;
     };
     }
   }
@@ -82,6 +82,7 @@ namespace gz
     class Object;
     class ObjectFactory;
     class ParticleEmitter;
+    class PointCloudVisual;
     class PointLight;
     class Projector;
     class RayQuery;
@@ -207,6 +208,10 @@ namespace gz
     /// \brief Shared pointer to LidarVisual
     typedef shared_ptr<LidarVisual> LidarVisualPtr;
 
+    /// \typedef PointCloudVisualPtr
+    /// \brief Shared pointer to PointCloudVisual
+    typedef shared_ptr<PointCloudVisual> PointCloudVisualPtr;
+
     /// \typedef FrustumVisualPtr
     /// \brief Shared pointer to FrustumVisual
     typedef shared_ptr<FrustumVisual> FrustumVisualPtr;
@@ -389,6 +394,10 @@ namespace gz
     /// \brief Shared pointer to const LidarVisual
     typedef shared_ptr<const LidarVisual> ConstLidarVisualPtr;
 
+    /// \typedef const PointCloudVisualPtr
+    /// \brief Shared pointer to const PointCloudVisual
+    typedef shared_ptr<const PointCloudVisual> ConstPointCloudVisualPtr;
+
     /// \typedef const FrustumVisualPtr
     /// \brief Shared pointer to const FrustumVisual
     typedef shared_ptr<const FrustumVisual> ConstFrustumVisualPtr;
@@ -247,6 +247,20 @@ namespace gz
       /// \brief Destroy all nodes manages by this scene.
       public: virtual void DestroyNodes() = 0;
 
+      /// \brief Set the local poses of many nodes in a single pass. The
+      /// ids and poses are given as two parallel arrays, so that a caller
+      /// keeping its poses in a contiguous buffer can push all of them
+      /// at once. Nodes whose pose did not change are skipped, as are ids
+      /// that do not refer to a node of this scene.
+      /// \param[in] _ids Array of _count node ids
+      /// \param[in] _poses Array of _count local poses, _poses[i] is the new
+      /// local pose of the node with id _ids[i]
+      /// \param[in] _count Number of entries in _ids and _poses
+      /// \return Number of nodes whose pose was changed
+      /// \sa Node::SetLocalPose
+      public: virtual unsigned int SetLocalPoses(const unsigned int *_ids,
+          const math::Pose3d *_poses, unsigned int _count) = 0;
+
       /// \brief Get the number of lights managed by this scene. Note these
       /// lights may not be directly or indirectly attached to the root light.
       /// \return The number of lights managed by this scene
@@ -1068,6 +1082,17 @@ namespace gz
       /// \return The created mesh
       public: virtual MeshPtr CreateMesh(const MeshDescriptor &_desc) = 0;
 
+      /// \brief Create new mesh geometry, loading it in the background. The
+      /// vertex data of the mesh is packed on worker threads and uploaded to
+      /// the GPU during a later PreRender. Until then the mesh shows a box
+      /// the size of its bounds, see Mesh::IsLoaded. The common::Mesh of the
+      /// descriptor must stay unchanged until the mesh is loaded. Render
+      /// engines that cannot load meshes in the background load them right
+      /// away, like CreateMesh.
+      /// \param[in] _desc Descriptor of the mesh to load
+      /// \return The created mesh
+      public: virtual MeshPtr CreateMeshAsync(const MeshDescriptor &_desc) = 0;
+
       /// \brief Create new grid geometry.
       /// \return The created grid
       public: virtual GridPtr CreateGrid() = 0;
@@ -1108,6 +1133,35 @@ namespace gz
       public: virtual LidarVisualPtr CreateLidarVisual(
                   unsigned int _id, const std::string &_name) = 0;
 
+      /// \brief Create new point cloud visual. A unique ID and name will
+      /// automatically be assigned to the point cloud visual.
+      /// \return The created point cloud visual
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual() = 0;
+
+      /// \brief Create new point cloud visual with the given ID. A unique
+      /// name will automatically be assigned to the point cloud visual. If
+      /// the given ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new point cloud visual
+      /// \return The created point cloud visual
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id) = 0;
+
+      /// \brief Create new point cloud visual with the given name. A unique
+      /// ID will automatically be assigned to the point cloud visual. If the
+      /// given name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new point cloud visual
+      /// \return The created point cloud visual
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  const std::string &_name) = 0;
+
+      /// \brief Create new point cloud visual with the given name. If either
+      /// the given ID or name is already in use, NULL will be returned.
+      /// \param[in] _id ID of the point cloud visual.
+      /// \param[in] _name Name of the new point cloud visual.
+      /// \return The created point cloud visual
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id, const std::string &_name) = 0;
+
       /// \brief Create new frusum visual. A unique ID and name will
       /// automatically be assigned to the frustum visual.
       /// \return The created frustum visual
@@ -1318,8 +1372,32 @@ namespace gz
 
       /// \brief Prepare scene for rendering. The scene will flushing any scene
       /// changes by traversing scene-graph, calling PreRender on all objects
+      /// that changed since the last call. Subtrees without changes are
+      /// skipped, see Node::MarkPreRenderDirty.
       public: virtual void PreRender() = 0;
 
+      /// \brief Get the number of scene-graph nodes that were visited by the
+      /// last call to PreRender.
+      /// \return Number of nodes visited by the last PreRender
+      /// \sa NodeCount
+      public: virtual unsigned int PreRenderVisitedNodeCount() const = 0;
+
+      /// \brief Get the number of draw calls issued to the GPU between the
+      /// last PreRender and PostRender pair. Objects that share a mesh and a
+      /// material can be batched into a single instanced draw call, so this
+      /// may be much lower than the number of objects drawn. Render engines
+      /// that do not track draw calls return 0.
+      /// \return Number of draw calls of the last frame
+      /// \sa DrawnInstanceCount
+      public: virtual unsigned int DrawCallCount() const = 0;
+
+      /// \brief Get the number of object instances drawn between the last
+      /// PreRender and PostRender pair, across all draw calls.
+      /// Render engines that do not track draw calls return 0.
+      /// \return Number of instances drawn in the last frame
+      /// \sa DrawCallCount
+      public: virtual unsigned int DrawnInstanceCount() const = 0;
+
       /// \brief Call this function after you're done updating ALL cameras
       /// \remark Each PreRender must have a correspondent PostRender
       /// \remark Particle FX simulation is moved forward after this call
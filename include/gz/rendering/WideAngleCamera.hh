@@ -48,6 +48,22 @@ namespace gz
       /// \return Camera lens set to this wide angle camera
       public: virtual const CameraLens &Lens() const = 0;
 
+      /// \brief Set whether the faces of the environment cubemap are only
+      /// rendered again when their content changed. A face is rendered again
+      /// if the camera, a light, the background or an object overlapping it
+      /// changed since the last time it was rendered. Changes that do not
+      /// move, resize, hide or swap the material of an object, such as
+      /// shadows cast from outside the face, are not detected. Disabled by
+      /// default. Not every render engine supports it.
+      /// \param[in] _enabled True to render only the faces that changed
+      public: virtual void SetStaticFaceCaching(bool _enabled) = 0;
+
+      /// \brief Get whether the faces of the environment cubemap are only
+      /// rendered again when their content changed
+      /// \return True if only the faces that changed are rendered
+      /// \sa SetStaticFaceCaching
+      public: virtual bool StaticFaceCaching() const = 0;
+
       /// \brief Project 3D world coordinates to screen coordinates
       /// \param[in] _pt 3D world coordinates
       /// \return Screen coordinates. Z is the distance of point from camera
@@ -88,6 +88,7 @@ namespace gz
     template <class T>
     BaseCOMVisual<T>::BaseCOMVisual()
     {
+      this->preRenderEveryFrame = true;
     }
 
     //////////////////////////////////////////////////
@@ -18,6 +18,7 @@
 #define GZ_RENDERING_BASE_BASECAMERA_HH_
 
 #include <cmath>
+#include <memory>
 #include <string>
 
 #include <gz/math/Matrix3.hh>
@@ -209,6 +210,20 @@ namespace gz
       // Documentation inherited.
       public: virtual void SetShadowsDirty() override;
 
+      // Documentation inherited.
+      public: virtual void SetReadbackLatency(unsigned int _frames) override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ReadbackLatency() const override;
+
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewFrameView(
+                  Camera::FrameViewListener _listener) override;
+
+      // Documentation inherited.
+      public: virtual void SetOutputBuffer(void *_buffer, size_t _size)
+                  override;
+
       protected: virtual void *CreateImageBuffer() const;
 
       protected: virtual void Load() override;
@@ -217,10 +232,30 @@ namespace gz
 
       protected: virtual RenderTargetPtr RenderTarget() const = 0;
 
+      /// \brief Get the subscriber supplied output buffer if one is set and
+      /// large enough to hold a frame.
+      /// \param[in] _size Size in bytes of one published frame
+      /// \return Output buffer or nullptr to use the internal buffer
+      protected: void *OutputBuffer(size_t _size) const;
+
+      /// \brief Invoke the frame view listeners with a borrowed view of
+      /// mapped frame data. The view is invalidated when this returns.
+      /// \param[in] _data Pointer to the first pixel
+      /// \param[in] _width Frame width in pixels
+      /// \param[in] _height Frame height in pixels
+      /// \param[in] _rowPitch Bytes between consecutive rows
+      /// \param[in] _format Pixel format of the data
+      protected: void PublishFrameView(const void *_data, unsigned int _width,
+                     unsigned int _height, unsigned int _rowPitch,
+                     PixelFormat _format);
+
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       protected: common::EventT<void(const void *, unsigned int, unsigned int,
                      unsigned int, const std::string &)> newFrameEvent;
 
+      /// \brief Event used to signal borrowed frame views
+      protected: common::EventT<void(const FrameView &)> newFrameViewEvent;
+
       protected: ImagePtr imageBuffer;
 
       /// \brief Near clipping plane distance
@@ -272,6 +307,15 @@ namespace gz
       /// \brief Camera projection type
       protected: CameraProjectionType projectionType = CPT_PERSPECTIVE;
 
+      /// \brief Frames of GPU to CPU readback latency
+      protected: unsigned int readbackLatency = 0u;
+
+      /// \brief Subscriber supplied output buffer
+      protected: void *outputBuffer = nullptr;
+
+      /// \brief Size in bytes of the subscriber supplied output buffer
+      protected: size_t outputBufferSize = 0u;
+
       friend class BaseDepthCamera<T>;
     };
 
@@ -907,6 +951,74 @@ namespace gz
     {
       // no op
     }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetReadbackLatency(unsigned int _frames)
+    {
+      this->readbackLatency = _frames;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCamera<T>::ReadbackLatency() const
+    {
+      return this->readbackLatency;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    common::ConnectionPtr BaseCamera<T>::ConnectNewFrameView(
+        Camera::FrameViewListener _listener)
+    {
+      return this->newFrameViewEvent.Connect(_listener);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetOutputBuffer(void *_buffer, size_t _size)
+    {
+      this->outputBuffer = _buffer;
+      this->outputBufferSize = _buffer ? _size : 0u;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void *BaseCamera<T>::OutputBuffer(size_t _size) const
+    {
+      if (!this->outputBuffer)
+        return nullptr;
+
+      if (this->outputBufferSize < _size)
+      {
+        gzwarn << "Output buffer of " << this->outputBufferSize
+               << " bytes is too small for a frame of " << _size
+               << " bytes, using the internal buffer" << std::endl;
+        return nullptr;
+      }
+      return this->outputBuffer;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::PublishFrameView(const void *_data,
+        unsigned int _width, unsigned int _height, unsigned int _rowPitch,
+        PixelFormat _format)
+    {
+      if (this->newFrameViewEvent.ConnectionCount() == 0u)
+        return;
+
+      // The view borrows mapped memory; the token expires on return.
+      auto lifetime = std::make_shared<bool>(true);
+      FrameView view;
+      view.data = _data;
+      view.width = _width;
+      view.height = _height;
+      view.rowPitch = _rowPitch;
+      view.format = _format;
+      view.lifetime = lifetime;
+      this->newFrameViewEvent(view);
+    }
     }
   }
 }
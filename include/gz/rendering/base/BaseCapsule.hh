@@ -22,6 +22,7 @@
 
 #include "gz/rendering/Capsule.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
 #include "gz/rendering/base/BaseObject.hh"
 
 namespace gz
@@ -86,6 +87,8 @@ namespace gz
     {
       this->radius = _radius;
       this->capsuleDirty = true;
+      if (VisualPtr parent = this->Parent())
+        parent->MarkPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -101,6 +104,8 @@ namespace gz
     {
       this->length = _length;
       this->capsuleDirty = true;
+      if (VisualPtr parent = this->Parent())
+        parent->MarkPreRenderDirty();
     }
 
     /////////////////////////////////////////////////
@@ -109,6 +109,7 @@ namespace gz
     template <class T>
     BaseFrustumVisual<T>::BaseFrustumVisual()
     {
+      this->preRenderEveryFrame = true;
     }
 
     /////////////////////////////////////////////////
@@ -141,6 +141,7 @@ namespace gz
     template <class T>
     BaseGizmoVisual<T>::BaseGizmoVisual()
     {
+      this->preRenderEveryFrame = true;
     }
 
     //////////////////////////////////////////////////
@@ -64,6 +64,7 @@ namespace gz
     template <class T>
     BaseInertiaVisual<T>::BaseInertiaVisual()
     {
+      this->preRenderEveryFrame = true;
     }
 
     //////////////////////////////////////////////////
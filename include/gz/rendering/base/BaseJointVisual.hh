@@ -173,6 +173,7 @@ namespace gz
     template <class T>
     BaseJointVisual<T>::BaseJointVisual()
     {
+      this->preRenderEveryFrame = true;
     }
 
     //////////////////////////////////////////////////
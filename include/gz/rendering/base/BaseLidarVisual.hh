@@ -61,6 +61,11 @@ namespace gz
                             const std::vector<gz::math::Color> &_colors)
                             override;
 
+      // Documentation inherited
+      public: virtual void SetPoints(const float *_ranges,
+                            unsigned int _count, unsigned int _stride)
+                            override;
+
       // Documentation inherited
       public: virtual void Update() override;
 
@@ -205,6 +210,7 @@ namespace gz
     template <class T>
     BaseLidarVisual<T>::BaseLidarVisual()
     {
+      this->preRenderEveryFrame = true;
     }
 
     /////////////////////////////////////////////////
@@ -271,6 +277,17 @@ namespace gz
       // no op
     }
 
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseLidarVisual<T>::SetPoints(const float *_ranges,
+                                unsigned int _count, unsigned int _stride)
+    {
+      std::vector<double> points(_count);
+      for (unsigned int i = 0; i < _count; ++i)
+        points[i] = _ranges[static_cast<size_t>(i) * _stride];
+      this->SetPoints(points);
+    }
+
     /////////////////////////////////////////////////
     template <class T>
     void BaseLidarVisual<T>::Init()
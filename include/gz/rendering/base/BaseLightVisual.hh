@@ -86,6 +86,7 @@ namespace gz
     template <class T>
     BaseLightVisual<T>::BaseLightVisual()
     {
+      this->preRenderEveryFrame = true;
     }
 
     //////////////////////////////////////////////////
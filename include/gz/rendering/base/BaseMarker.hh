@@ -88,6 +88,10 @@ namespace gz
       public: virtual void SetPoint(unsigned int _index,
                   const gz::math::Vector3d &_value) override;
 
+      // Documentation inherited
+      public: virtual void SetPoints(const float *_points, size_t _count,
+                  const gz::math::Color &_color) override;
+
       /// \brief Life time of a marker
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       protected: std::chrono::steady_clock::duration lifetime =
@@ -227,6 +231,19 @@ namespace gz
     {
       // no op
     }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BaseMarker<T>::SetPoints(const float *_points, size_t _count,
+                  const gz::math::Color &_color)
+    {
+      this->ClearPoints();
+      for (size_t i = 0; i < _count; ++i)
+      {
+        this->AddPoint(_points[i * 3], _points[i * 3 + 1],
+            _points[i * 3 + 2], _color);
+      }
+    }
     }
   }
 }
@@ -26,6 +26,7 @@
 #include "gz/rendering/Mesh.hh"
 #include "gz/rendering/RenderEngine.hh"
 #include "gz/rendering/Storage.hh"
+#include "gz/rendering/Visual.hh"
 #include "gz/rendering/base/BaseObject.hh"
 
 namespace gz
@@ -44,6 +45,9 @@ namespace gz
 
       public: virtual ~BaseMesh();
 
+      // Documentation inherited.
+      public: virtual bool IsLoaded() const override;
+
       // Documentation inherited.
       public: virtual bool HasSkeleton() const override;
 
@@ -180,6 +184,13 @@ namespace gz
     {
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseMesh<T>::IsLoaded() const
+    {
+      return true;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     bool BaseMesh<T>::HasSkeleton() const
@@ -308,6 +319,9 @@ namespace gz
         subMesh->SetMaterial(_material, false);
       }
 
+      if (VisualPtr parent = this->Parent())
+        parent->MarkPreRenderDirty();
+
       // If the same material is being set, return early and don't try
       // to destroy the material. We still need call SetMaterial on the
       // submeshes in case the user changed some material properties
@@ -183,8 +183,29 @@ namespace gz
       // Documentation inherited
       public: virtual bool HasUserData(const std::string &_key) const override;
 
+      // Documentation inherited
+      public: virtual void MarkPreRenderDirty() override;
+
+      // Documentation inherited
+      public: virtual bool PreRenderDirty() const override;
+
+      // Documentation inherited
+      public: virtual unsigned int PreRenderIfDirty() override;
+
       protected: virtual void PreRenderChildren();
 
+      /// \brief Call PreRender on a child node if its subtree needs it and
+      /// keep this node dirty while the child subtree is still dirty.
+      /// \param[in] _child Child node
+      protected: void PreRenderChild(const NodePtr &_child);
+
+      /// \brief Whether this node has work to do in PreRender even if none
+      /// of its properties changed. Such nodes, and all their ancestors, are
+      /// visited by every Scene::PreRender.
+      /// \return True by default. Node types whose PreRender only applies
+      /// changes made through their setters override this to return false.
+      protected: virtual bool PreRenderEveryFrame() const;
+
       protected: virtual math::Pose3d RawLocalPose() const = 0;
 
       protected: virtual void SetRawLocalPose(const math::Pose3d &_pose) = 0;
@@ -212,6 +233,14 @@ namespace gz
 
       /// \brief A map of custom key value data
       protected: std::map<std::string, Variant> userData;
+
+      /// \brief True if this node or a node in its subtree needs PreRender.
+      /// A dirty node always has dirty ancestors.
+      protected: bool preRenderDirty = true;
+
+      /// \brief Number of nodes visited by the PreRenderIfDirty call in
+      /// progress, see PreRenderChild.
+      protected: unsigned int preRenderVisitCount = 0u;
     };
 
     //////////////////////////////////////////////////
@@ -254,6 +283,8 @@ namespace gz
       if (this->AttachChild(_child))
       {
         this->Children()->Add(_child);
+        if (_child->PreRenderDirty())
+          this->MarkPreRenderDirty();
       }
     }
 
@@ -308,6 +339,10 @@ namespace gz
     void BaseNode<T>::PreRender()
     {
       T::PreRender();
+
+      // Clear the flag before visiting the children so that changes made
+      // while they are pre-rendered propagate up again
+      this->preRenderDirty = this->PreRenderEveryFrame();
       this->PreRenderChildren();
     }
 
@@ -319,10 +354,59 @@ namespace gz
 
       for (unsigned int i = 0; i < count; ++i)
       {
-        this->ChildByIndex(i)->PreRender();
+        this->PreRenderChild(this->ChildByIndex(i));
       }
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseNode<T>::PreRenderChild(const NodePtr &_child)
+    {
+      this->preRenderVisitCount += _child->PreRenderIfDirty();
+      if (_child->PreRenderDirty())
+        this->preRenderDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseNode<T>::PreRenderEveryFrame() const
+    {
+      return true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseNode<T>::MarkPreRenderDirty()
+    {
+      // ancestors of a dirty node are already dirty
+      if (this->preRenderDirty)
+        return;
+
+      this->preRenderDirty = true;
+      NodePtr parent = this->Parent();
+      if (parent)
+        parent->MarkPreRenderDirty();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseNode<T>::PreRenderDirty() const
+    {
+      return this->preRenderDirty;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseNode<T>::PreRenderIfDirty()
+    {
+      if (!this->preRenderDirty)
+        return 0u;
+
+      this->preRenderVisitCount = 1u;
+      this->PreRender();
+      return this->preRenderVisitCount;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     math::Pose3d BaseNode<T>::LocalPose() const
@@ -353,6 +437,7 @@ namespace gz
       }
 
       this->SetRawLocalPose(pose);
+      this->MarkPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -546,6 +631,7 @@ namespace gz
         return;
       }
       this->origin = _origin;
+      this->MarkPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
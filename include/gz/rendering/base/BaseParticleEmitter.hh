@@ -206,6 +206,7 @@ namespace gz
     template <class T>
     BaseParticleEmitter<T>::BaseParticleEmitter()
     {
+      this->preRenderEveryFrame = true;
     }
 
     //////////////////////////////////////////////////
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_BASE_BASEPOINTCLOUDVISUAL_HH_
+#define GZ_RENDERING_BASE_BASEPOINTCLOUDVISUAL_HH_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "gz/rendering/base/BaseScene.hh"
+#include "gz/rendering/base/BaseNode.hh"
+#include "gz/rendering/PointCloudVisual.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BasePointCloudVisual BasePointCloudVisual.hh \
+     * gz/rendering/base/BasePointCloudVisual.hh
+     */
+    /// \brief A base implementation of the PointCloudVisual class
+    template <class T>
+    class BasePointCloudVisual :
+      public virtual PointCloudVisual,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BasePointCloudVisual();
+
+      /// \brief Destructor
+      public: virtual ~BasePointCloudVisual();
+
+      // Documentation inherited
+      public: virtual void AddPoints(const float *_points, size_t _count,
+                  const math::Color &_color = math::Color::White) override;
+
+      // Documentation inherited
+      public: virtual void AddPoints(const float *_points,
+                  const uint8_t *_colors, size_t _count) override = 0;
+
+      // Documentation inherited
+      public: virtual double Size() const override;
+
+      // Documentation inherited
+      public: virtual void SetSize(double _size) override;
+
+      // Documentation inherited
+      public: virtual double ScreenSpaceError() const override;
+
+      // Documentation inherited
+      public: virtual void SetScreenSpaceError(double _pixels) override;
+
+      // Documentation inherited
+      public: virtual size_t PointBudget() const override;
+
+      // Documentation inherited
+      public: virtual void SetPointBudget(size_t _count) override;
+
+      // Documentation inherited
+      public: virtual size_t UploadBudget() const override;
+
+      // Documentation inherited
+      public: virtual void SetUploadBudget(size_t _count) override;
+
+      // Documentation inherited
+      public: virtual size_t GpuPointBudget() const override;
+
+      // Documentation inherited
+      public: virtual void SetGpuPointBudget(size_t _count) override;
+
+      /// \brief Size of the points in pixels
+      protected: double size = 1.0;
+
+      /// \brief Screen space error in pixels
+      protected: double screenSpaceError = 2.0;
+
+      /// \brief Maximum number of points drawn per camera
+      protected: size_t pointBudget = 5000000u;
+
+      /// \brief Maximum number of points uploaded per frame
+      protected: size_t uploadBudget = 1000000u;
+
+      /// \brief Maximum number of points kept in GPU memory
+      protected: size_t gpuPointBudget = 20000000u;
+
+      /// \brief Only the scene can create a point cloud visual
+      private: friend class BaseScene;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BasePointCloudVisual<T>::BasePointCloudVisual()
+    {
+      this->preRenderEveryFrame = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BasePointCloudVisual<T>::~BasePointCloudVisual()
+    {
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::AddPoints(const float *_points,
+        size_t _count, const math::Color &_color)
+    {
+      const uint8_t rgba[4] = {
+          static_cast<uint8_t>(std::clamp(_color.R(), 0.0f, 1.0f) * 255.0f),
+          static_cast<uint8_t>(std::clamp(_color.G(), 0.0f, 1.0f) * 255.0f),
+          static_cast<uint8_t>(std::clamp(_color.B(), 0.0f, 1.0f) * 255.0f),
+          static_cast<uint8_t>(std::clamp(_color.A(), 0.0f, 1.0f) * 255.0f)};
+      std::vector<uint8_t> colors(_count * 4u);
+      for (size_t i = 0; i < colors.size(); i += 4u)
+        std::copy(rgba, rgba + 4, colors.begin() + i);
+      this->AddPoints(_points, colors.data(), _count);
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BasePointCloudVisual<T>::Size() const
+    {
+      return this->size;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetSize(double _size)
+    {
+      this->size = _size;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    double BasePointCloudVisual<T>::ScreenSpaceError() const
+    {
+      return this->screenSpaceError;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetScreenSpaceError(double _pixels)
+    {
+      this->screenSpaceError = _pixels;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    size_t BasePointCloudVisual<T>::PointBudget() const
+    {
+      return this->pointBudget;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetPointBudget(size_t _count)
+    {
+      this->pointBudget = _count;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    size_t BasePointCloudVisual<T>::UploadBudget() const
+    {
+      return this->uploadBudget;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetUploadBudget(size_t _count)
+    {
+      this->uploadBudget = _count;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    size_t BasePointCloudVisual<T>::GpuPointBudget() const
+    {
+      return this->gpuPointBudget;
+    }
+
+    /////////////////////////////////////////////////
+    template <class T>
+    void BasePointCloudVisual<T>::SetGpuPointBudget(size_t _count)
+    {
+      this->gpuPointBudget = _count;
+    }
+    }
+  }
+}
+#endif
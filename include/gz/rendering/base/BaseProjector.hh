@@ -97,6 +97,7 @@ namespace gz
     template <class T>
     BaseProjector<T>::BaseProjector()
     {
+      this->preRenderEveryFrame = true;
     }
 
     //////////////////////////////////////////////////
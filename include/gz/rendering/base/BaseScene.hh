@@ -126,6 +126,10 @@ namespace gz
 
       public: virtual void DestroyNodes() override;
 
+      // Documentation inherited.
+      public: virtual unsigned int SetLocalPoses(const unsigned int *_ids,
+          const math::Pose3d *_poses, unsigned int _count) override;
+
       public: virtual unsigned int LightCount() const override;
 
       public: virtual bool HasLight(ConstLightPtr _light) const override;
@@ -513,6 +517,10 @@ namespace gz
 
       public: virtual MeshPtr CreateMesh(const MeshDescriptor &_desc) override;
 
+      // Documentation inherited.
+      public: virtual MeshPtr CreateMeshAsync(const MeshDescriptor &_desc)
+                  override;
+
       // Documentation inherited.
       public: virtual CapsulePtr CreateCapsule() override;
 
@@ -537,6 +545,21 @@ namespace gz
       public: virtual LidarVisualPtr CreateLidarVisual(unsigned int _id,
                                             const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual() override;
+
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual PointCloudVisualPtr CreatePointCloudVisual(
+                  unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited.
       public: virtual FrustumVisualPtr CreateFrustumVisual() override;
 
@@ -657,6 +680,15 @@ namespace gz
 
       public: virtual void PreRender() override;
 
+      // Documentation inherited.
+      public: virtual unsigned int PreRenderVisitedNodeCount() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int DrawCallCount() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int DrawnInstanceCount() const override;
+
       public: virtual void Clear() override;
 
       public: virtual void Destroy() override;
@@ -815,6 +847,16 @@ namespace gz
                      const std::string &_name,
                      const MeshDescriptor &_desc) = 0;
 
+      /// \brief Implementation for creating a mesh loaded in the background.
+      /// The default implementation loads it right away with CreateMeshImpl.
+      /// \param[in] _id unique object id.
+      /// \param[in] _name unique object name.
+      /// \param[in] _desc Descriptor of the mesh to load
+      /// \return Pointer to a mesh geometry object
+      protected: virtual MeshPtr CreateMeshAsyncImpl(unsigned int _id,
+                     const std::string &_name,
+                     const MeshDescriptor &_desc);
+
       /// \brief Implementation for creating a capsule geometry object
       /// \param[in] _id unique object id.
       /// \param[in] _name unique object name.
@@ -918,6 +960,20 @@ namespace gz
                    return ProjectorPtr();
                  }
 
+      /// \brief Implementation for creating a PointCloudVisual.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of PointCloudVisual.
+      /// \return Pointer to the created point cloud visual
+      protected: virtual PointCloudVisualPtr CreatePointCloudVisualImpl(
+                     unsigned int _id, const std::string &_name)
+                 {
+                   (void)_id;
+                   (void)_name;
+                   gzerr << "PointCloudVisual not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return PointCloudVisualPtr();
+                 }
+
       /// \brief Implementation for creating a GlobalIlluminationVct.
       /// \param[in] _id Unique id.
       /// \param[in] _name Name of GlobalIlluminationVct.
@@ -1005,6 +1061,9 @@ namespace gz
 
       private: unsigned int nextObjectId;
 
+      /// \brief Number of nodes visited by the last PreRender
+      private: unsigned int preRenderVisitedNodeCount = 0u;
+
       GZ_UTILS_WARN_IGNORE__DLL_INTERFACE_MISSING
       private: NodeStorePtr nodes;
       GZ_UTILS_WARN_RESUME__DLL_INTERFACE_MISSING
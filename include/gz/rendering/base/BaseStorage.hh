@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <gz/common/Console.hh>
@@ -94,7 +95,8 @@ namespace gz
 
       typedef std::shared_ptr<U> UPtr;
 
-      typedef std::map<std::string, int> UStoreMap;
+      typedef std::unordered_map<std::string, unsigned int> UStoreMap;
+      typedef std::unordered_map<unsigned int, unsigned int> UIdMap;
       typedef std::vector<UPtr> UStore;
 
       typedef typename UStore::iterator UIter;
@@ -232,8 +234,15 @@ namespace gz
 
       protected: virtual UIter RemoveConstness(ConstUIter _iter);
 
+      /// \brief Objects in insertion order, without gaps so that access by
+      /// index is O(1)
       protected: UStore store;
+
+      /// \brief Slot of each object in the store, keyed by object name
       protected: UStoreMap storeMap;
+
+      /// \brief Slot of each object in the store, keyed by object id
+      protected: UIdMap idMap;
     };
 
     //////////////////////////////////////////////////
@@ -732,6 +741,7 @@ namespace gz
     {
       this->store.clear();
       this->storeMap.clear();
+      this->idMap.clear();
     }
 
     //////////////////////////////////////////////////
@@ -859,18 +869,14 @@ namespace gz
     typename BaseStore<T, U>::ConstUIter
     BaseStore<T, U>::ConstIter(ConstTPtr _object) const
     {
-      auto begin = this->store.begin();
-      auto end = this->store.end();
+      if (!_object)
+        return this->store.end();
 
-      for (auto iter = begin; iter != end; ++iter)
-      {
-        if (*iter == _object)
-        {
-          return iter;
-        }
-      }
+      auto iter = this->ConstIterById(_object->Id());
+      if (this->IsValidIter(iter) && *iter == _object)
+        return iter;
 
-      return end;
+      return this->store.end();
     }
 
     //////////////////////////////////////////////////
@@ -878,18 +884,12 @@ namespace gz
     typename BaseStore<T, U>::ConstUIter
     BaseStore<T, U>::ConstIterById(unsigned int _id) const
     {
-      auto begin = this->store.begin();
-      auto end = this->store.end();
-
-      for (auto iter = begin; iter != end; ++iter)
+      auto slot = this->idMap.find(_id);
+      if (slot == this->idMap.end())
       {
-        if ((*iter)->Id() == _id)
-        {
-          return iter;
-        }
+        return this->store.end();
       }
-
-      return end;
+      return this->store.begin() + slot->second;
     }
 
     //////////////////////////////////////////////////
@@ -897,12 +897,12 @@ namespace gz
     typename BaseStore<T, U>::ConstUIter
     BaseStore<T, U>::ConstIterByName(const std::string &_name) const
     {
-      auto idx = this->storeMap.find(_name);
-      if (idx == this->storeMap.end())
+      auto slot = this->storeMap.find(_name);
+      if (slot == this->storeMap.end())
       {
         return this->store.end();
       }
-      return ConstIterByIndex(idx->second);
+      return this->store.begin() + slot->second;
     }
 
     //////////////////////////////////////////////////
@@ -916,9 +916,7 @@ namespace gz
         return this->store.end();
       }
 
-      auto iter = this->store.begin();
-      std::advance(iter, _index);
-      return iter;
+      return this->store.begin() + _index;
     }
 
     //////////////////////////////////////////////////
@@ -977,7 +975,9 @@ namespace gz
         return false;
       }
 
-      this->storeMap[name] = this->store.size();
+      unsigned int slot = this->store.size();
+      this->storeMap[name] = slot;
+      this->idMap[id] = slot;
       this->store.emplace_back(_object);
       return true;
     }
@@ -992,21 +992,19 @@ namespace gz
         return nullptr;
       }
 
+      UPtr result = *_iter;
+      this->idMap.erase(result->Id());
+      this->storeMap.erase(result->Name());
 
-      auto idx = std::distance(this->store.begin(), _iter);
-      std::string nameToErase;
-      for (auto &[name, objIdx] : this->storeMap)
+      // the objects after the removed one move down one slot, removing the
+      // last object, e.g. in DestroyAll, moves none
+      auto iter = this->store.erase(_iter);
+      for (; iter != this->store.end(); ++iter)
       {
-        if (objIdx == idx)
-          nameToErase = name;
-
-        if (objIdx >= idx)
-          objIdx--;
+        --this->idMap.find((*iter)->Id())->second;
+        --this->storeMap.find((*iter)->Name())->second;
       }
-      this->storeMap.erase(nameToErase);
 
-      UPtr result = *_iter;
-      this->store.erase(_iter);
       return result;
     }
 
@@ -22,6 +22,9 @@
 
 #include <gz/math/AxisAlignedBox.hh>
 
+#include "gz/rendering/Capsule.hh"
+#include "gz/rendering/Material.hh"
+#include "gz/rendering/Mesh.hh"
 #include "gz/rendering/Visual.hh"
 #include "gz/rendering/Storage.hh"
 #include "gz/rendering/RenderEngine.hh"
@@ -128,6 +131,17 @@ namespace gz
 
       protected: virtual void PreRenderGeometries();
 
+      /// \brief A visual only needs PreRender after a change if all its
+      /// geometries are meshes or capsules and none of its materials use
+      /// custom shaders, whose parameters are applied in PreRender.
+      /// \return True if this visual has to be visited every frame
+      protected: virtual bool PreRenderEveryFrame() const override;
+
+      /// \brief Set by visual types whose PreRender has work to do every
+      /// frame, e.g. helper visuals that rebuild their geometry there, so
+      /// that PreRenderEveryFrame always returns true for them.
+      protected: bool preRenderEveryFrame = false;
+
       protected: virtual GeometryStorePtr Geometries() const = 0;
 
       protected: virtual bool AttachGeometry(GeometryPtr _geometry) = 0;
@@ -185,6 +199,7 @@ namespace gz
       }
 
       this->SetRawLocalPose(rawPose);
+      this->MarkPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -215,6 +230,7 @@ namespace gz
       if (this->AttachGeometry(_geometry))
       {
         this->Geometries()->Add(_geometry);
+        this->MarkPreRenderDirty();
       }
     }
 
@@ -225,6 +241,7 @@ namespace gz
       if (this->DetachGeometry(_geometry))
       {
         this->Geometries()->Remove(_geometry);
+        this->MarkPreRenderDirty();
       }
       return _geometry;
     }
@@ -262,6 +279,7 @@ namespace gz
       this->SetChildMaterial(_material, false);
       this->SetGeometryMaterial(_material, false);
       this->material = _material;
+      this->MarkPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -298,6 +316,7 @@ namespace gz
         GeometryPtr geometry = this->GeometryByIndex(i);
         geometry->SetMaterial(_material, false);
       }
+      this->MarkPreRenderDirty();
     }
 
     //////////////////////////////////////////////////
@@ -311,8 +330,8 @@ namespace gz
     template <class T>
     void BaseVisual<T>::PreRender()
     {
+      // T::PreRender already pre-renders the children
       T::PreRender();
-      this->PreRenderChildren();
       this->PreRenderGeometries();
     }
 
@@ -340,7 +359,7 @@ namespace gz
       }
       for (auto it = children_->Begin(); it != children_->End(); ++it)
       {
-        (*it)->PreRender();
+        this->PreRenderChild(*it);
       }
     }
 
@@ -357,6 +376,43 @@ namespace gz
       }
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseVisual<T>::PreRenderEveryFrame() const
+    {
+      if (this->preRenderEveryFrame)
+        return true;
+
+      auto customShaders = [](const MaterialPtr &_material)
+      {
+        return _material && (!_material->VertexShader().empty() ||
+            !_material->FragmentShader().empty());
+      };
+
+      if (customShaders(this->material))
+        return true;
+
+      unsigned int count = this->GeometryCount();
+      for (unsigned int i = 0; i < count; ++i)
+      {
+        GeometryPtr geometry = this->GeometryByIndex(i);
+        if (std::dynamic_pointer_cast<Capsule>(geometry))
+          continue;
+
+        MeshPtr mesh = std::dynamic_pointer_cast<Mesh>(geometry);
+        if (!mesh)
+          return true;
+
+        unsigned int subMeshCount = mesh->SubMeshCount();
+        for (unsigned int j = 0; j < subMeshCount; ++j)
+        {
+          if (customShaders(mesh->SubMeshByIndex(j)->Material()))
+            return true;
+        }
+      }
+      return false;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     bool BaseVisual<T>::Wireframe() const
@@ -469,6 +525,7 @@ namespace gz
     void BaseVisual<T>::SetVisibilityFlags(uint32_t _flags)
     {
       this->visibilityFlags = _flags;
+      this->MarkPreRenderDirty();
 
       // recursively set child visuals' visibility flags
       auto childNodes =
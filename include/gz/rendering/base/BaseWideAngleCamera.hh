@@ -51,6 +51,12 @@ namespace gz
       // Documentation inherited.
       public: virtual const CameraLens &Lens() const override;
 
+      // Documentation inherited.
+      public: virtual void SetStaticFaceCaching(bool _enabled) override;
+
+      // Documentation inherited.
+      public: virtual bool StaticFaceCaching() const override;
+
       // Documentation inherited.
       public: virtual math::Vector3d Project3d(const math::Vector3d &_pt) const
           override;
@@ -62,6 +68,9 @@ namespace gz
 
       /// \brief Camera lens used by this wide angle camera
       protected: CameraLens lens;
+
+      /// \brief True to only render the cubemap faces that changed
+      protected: bool staticFaceCaching = false;
     };
 
     //////////////////////////////////////////////////
@@ -90,6 +99,20 @@ namespace gz
       return this->lens;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseWideAngleCamera<T>::SetStaticFaceCaching(bool _enabled)
+    {
+      this->staticFaceCaching = _enabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseWideAngleCamera<T>::StaticFaceCaching() const
+    {
+      return this->staticFaceCaching;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseWideAngleCamera<T>::CreateWideAngleTexture()
@@ -200,7 +200,12 @@ void OgreLidarVisual::Update()
 
   bool clearVisuals = false;
 
-  if (this->lidarVisualType != this->dataPtr->lidarVisType
+  // points are always placed on the CPU
+  LidarVisualType lidarVisualType = this->lidarVisualType;
+  if (lidarVisualType == LidarVisualType::LVT_GPU_POINTS)
+    lidarVisualType = LidarVisualType::LVT_POINTS;
+
+  if (lidarVisualType != this->dataPtr->lidarVisType
         || !this->displayNonHitting)
   {
     clearVisuals = true;
@@ -217,7 +222,7 @@ void OgreLidarVisual::Update()
   {
     this->ClearVisualData();
   }
-  this->dataPtr->lidarVisType = this->lidarVisualType;
+  this->dataPtr->lidarVisType = lidarVisualType;
 
   this->dataPtr->receivedData = false;
   double horizontalAngle = this->minHorizontalAngle;
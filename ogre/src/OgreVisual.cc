@@ -91,6 +91,8 @@ void OgreVisual::SetWireframe(bool _show)
       }
     }
   }
+
+  this->MarkPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -106,6 +108,8 @@ void OgreVisual::SetVisible(bool _visible)
     return;
 
   this->ogreNode->setVisible(_visible);
+
+  this->MarkPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
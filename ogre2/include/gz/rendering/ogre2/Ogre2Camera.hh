@@ -129,6 +129,9 @@ namespace gz
       // Documentation inherited.
       public: void SetShadowsDirty() override;
 
+      // Documentation inherited.
+      public: virtual void SetReadbackLatency(unsigned int _frames) override;
+
       // Documentation inherited.
       public: virtual void Destroy() override;
 
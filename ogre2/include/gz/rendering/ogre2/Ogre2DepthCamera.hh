@@ -54,6 +54,13 @@ namespace gz
     class Ogre2DepthCameraPrivate;
 
     /// \brief Depth camera used to render depth data into an image buffer
+    ///
+    /// Without a GPU, the camera can instead cast one ray per pixel against
+    /// the scene meshes and heightmaps on the CPU. This is the case if it
+    /// has a "cpu_ray_casting" user data set to true, or if it has no such
+    /// user data and the GZ_RENDERING_OGRE2_CPU_RAY_SENSORS environment
+    /// variable is set. The point cloud is then colored with the unlit
+    /// diffuse color of the objects, and particles are not seen.
     class GZ_RENDERING_OGRE2_VISIBLE Ogre2DepthCamera :
       public virtual BaseDepthCamera<Ogre2Sensor>,
       public virtual Ogre2ObjectInterface
@@ -155,6 +162,18 @@ namespace gz
       /// \brief Create the camera.
       protected: void CreateCamera();
 
+      /// \brief Compute the direction of the rays cast on the CPU, one per
+      /// pixel
+      private: void CreateCpuRays();
+
+      /// \brief Cast the rays on the CPU instead of rasterizing the scene
+      private: void RenderCpu();
+
+      /// \brief Write the result of the rays cast on the CPU in the depth
+      /// buffer and the depth image
+      /// \param[out] _depthImage Depth image
+      private: void FillCpuBuffers(float *_depthImage) const;
+
       /// \brief Notifies us that the shadow node definition is about to be
       /// updated. This means our compositor workspace must be destroyed
       /// because the shadow node definition it's using will become a
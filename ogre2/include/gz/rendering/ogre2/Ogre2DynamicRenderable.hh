@@ -95,6 +95,15 @@ namespace gz
       public: void SetPoint(unsigned int _index,
                             const gz::math::Vector3d &_value);
 
+      /// \brief Replace all the points of the point list. Only the points
+      /// that differ from the current ones are uploaded on the next update.
+      /// \param[in] _points Positions of the points, stored as _count
+      /// consecutive x, y, z triples
+      /// \param[in] _count Number of points
+      /// \param[in] _color Color of all the points
+      public: void SetPoints(const float *_points, size_t _count,
+            const gz::math::Color &_color = gz::math::Color::White);
+
       /// \brief Change the color of an existing point in the point list
       /// \param[in] _index Index of the point to set
       /// \param[in] _color color to set the point to
@@ -130,20 +139,22 @@ namespace gz
       /// \brief Update vertex buffer if vertices have changes
       private: void UpdateBuffer();
 
-      /// \brief Helper function to generate normals
+      /// \brief Helper function to generate normals of a range of vertices
+      /// in the vertex buffer. The range is grown to cover all the vertices
+      /// whose normals depend on the vertices in the range.
       /// \param[in] _opType Ogre render operation type
-      /// \param[in] _vertices a list of vertices
-      /// \param[in,out] _vbuffer vertex buffer to be filled
+      /// \param[in,out] _begin First vertex of the range
+      /// \param[in,out] _end One past the last vertex of the range
       private: void GenerateNormals(Ogre::OperationType _opType,
-          const std::vector<math::Vector3d> &_vertices, float *_vbuffer);
+          size_t &_begin, size_t &_end);
 
       /// \brief Helper function to generate colors per-vertex. Only applies
       /// to points. The colors fill the normal slots on the vertex buffer.
       /// \param[in] _opType Ogre render operation type
-      /// \param[in] _vertices a list of vertices
-      /// \param[in,out] _vbuffer vertex buffer to be filled
+      /// \param[in] _begin First vertex of the range to fill
+      /// \param[in] _end One past the last vertex of the range to fill
       private: void GenerateColors(Ogre::OperationType _opType,
-          const std::vector<math::Vector3d> &_vertices, float *_vbuffer);
+          size_t _begin, size_t _end);
 
       /// \brief Destroy the vertex buffer
       private: void DestroyBuffer();
@@ -38,6 +38,7 @@ namespace Ogre
   class Material;
   class RenderTarget;
   class Texture;
+  class TextureGpu;
   class Viewport;
 }
 
@@ -49,6 +50,7 @@ namespace gz
     //
     // Forward declaration
     class Ogre2GpuRaysPrivate;
+    class Ogre2GpuRaysSampleTable;
 
     /// \brief Gpu Rays used to render range data into an image buffer
     /// The ogre2 implementation takes a 2 pass process to generate
@@ -63,6 +65,17 @@ namespace gz
     /// min/max angles and no. of samples. Each ray is a direction vector that
     /// is used to sample/lookup the range data stored in the faces of the
     /// cubemap.
+    ///
+    /// Sensors with the same pose, clip planes, clamping, visibility mask
+    /// and 1st pass texture size when their textures are created share the
+    /// cubemap of the 1st pass. Its faces are rendered once per frame and
+    /// each sensor only runs its own 2nd pass.
+    ///
+    /// Without a GPU, the sensor can instead cast its rays against the
+    /// scene meshes and heightmaps on the CPU. This is the case if it has a
+    /// "cpu_ray_casting" user data set to true, or if it has no such user
+    /// data and the GZ_RENDERING_OGRE2_CPU_RAY_SENSORS environment variable
+    /// is set. Particles are not seen by the CPU rays.
     class GZ_RENDERING_OGRE2_VISIBLE Ogre2GpuRays :
       public BaseGpuRays<Ogre2Sensor>
     {
@@ -93,6 +106,10 @@ namespace gz
       // Documentation inherited.
       public: virtual void Copy(float *_data) override;
 
+      // Documentation inherited.
+      public: virtual void SetOutputBuffer(void *_buffer, size_t _size)
+                  override;
+
       // Documentation inherited.
       public: virtual common::ConnectionPtr ConnectNewGpuRaysFrame(
                   std::function<void(const float *_frame, unsigned int _width,
@@ -135,15 +152,64 @@ namespace gz
       private: void UpdateRenderTarget2ndPass();
 
       /// \brief Create texture that store cubemap uv coordinates and
-      /// cubemap face index data
+      /// cubemap face index data. The texture is shared with the sensors
+      /// sampling the same rays and its data is cached across the sensors
+      /// of the process.
       private: void CreateSampleTexture();
 
+      /// \brief Compute the cubemap face and uv coordinates sampled by
+      /// every ray of the 2nd pass
+      /// \return Data of the sampling texture
+      private: std::shared_ptr<const Ogre2GpuRaysSampleTable>
+                   CreateSampleTable();
+
+      /// \brief Create a sampling texture holding a table
+      /// \param[in] _table Data of the texture
+      /// \param[in] _name Name of the texture
+      /// \return The texture
+      private: Ogre::TextureGpu *UploadSampleTable(
+                   const Ogre2GpuRaysSampleTable &_table,
+                   const std::string &_name);
+
       /// \brief Set up 1st pass material, texture, and compositor
       private: void Setup1stPass();
 
+      /// \brief Destroy the textures and workspaces of the render passes
+      private: void DestroyGpuRaysTextures();
+
+      /// \brief Stop using the cubemap of the 1st pass. It is destroyed if
+      /// no other sensor shares it.
+      private: void ReleaseCubemap();
+
+      /// \brief Check whether the 1st pass of another sensor renders the
+      /// same cubemap faces as the one of this sensor would: both sensors
+      /// have the same pose, clip planes, clamping, visibility mask and 1st
+      /// pass texture size
+      /// \param[in] _other Other sensor, its textures must be created
+      /// \return True if this sensor can sample the cubemap of _other
+      private: bool CanShareCubemap(const Ogre2GpuRays &_other) const;
+
       /// \brief Set up 2nd pass material, texture, and compositor
       private: void Setup2ndPass();
 
+      /// \brief Set up the pass that packs the 2nd pass output into the
+      /// RGB layout published by the sensor
+      private: void SetupPackPass();
+
+      /// \brief Update the packing pass render target
+      private: void UpdatePackPass();
+
+      /// \brief Compute the direction of the rays cast on the CPU
+      private: void CreateCpuRays();
+
+      /// \brief Cast the rays on the CPU instead of rasterizing the scene
+      private: void RenderCpu();
+
+      /// \brief Write the result of the rays cast on the CPU in the layout
+      /// of the published scan
+      /// \param[out] _scan Scan buffer
+      private: void FillCpuScan(float *_scan) const;
+
       /// \brief Helper function to convert a direction vector to the
       /// index number of a cubemap face and texture uv coordinates on that face
       /// \param[in] _v Direction vector
@@ -59,6 +59,10 @@ namespace gz
       public: virtual void SetPoints(
               const std::vector<double> &_points) override;
 
+      // Documentation inherited
+      public: virtual void SetPoints(const float *_ranges,
+              unsigned int _count, unsigned int _stride = 1u) override;
+
       // Documentation inherited
       public: virtual void ClearPoints() override;
 
@@ -74,6 +78,16 @@ namespace gz
       /// \brief Clear data stored by dynamiclines
       private: void ClearVisualData();
 
+      /// \brief Update the points placed by the GPU, used by LVT_GPU_POINTS
+      private: void UpdateGpuPoints();
+
+      /// \brief Create the mesh of the points placed by the GPU, holding
+      /// the direction of every ray
+      private: void CreateGpuPoints();
+
+      /// \brief Destroy the mesh of the points placed by the GPU
+      private: void DestroyGpuPoints();
+
       // Documentation inherited
       public: virtual void SetVisible(bool _visible) override;
 
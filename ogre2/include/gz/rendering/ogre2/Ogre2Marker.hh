@@ -64,6 +64,10 @@ namespace gz
       public: virtual void SetPoint(unsigned int _index,
                            const gz::math::Vector3d &_value) override;
 
+      // Documentation inherited
+      public: virtual void SetPoints(const float *_points, size_t _count,
+                           const gz::math::Color &_color) override;
+
       // Documentation inherited
       public: virtual void AddPoint(const gz::math::Vector3d &_pt,
                            const gz::math::Color &_color) override;
@@ -56,6 +56,9 @@ namespace gz
       // Documentation inherited
       public: virtual void Destroy() override;
 
+      // Documentation inherited.
+      public: virtual bool IsLoaded() const override;
+
       // Documentation inherited.
       public: virtual bool HasSkeleton() const override;
 
@@ -96,9 +99,21 @@ namespace gz
       /// \brief Store containing all the submeshes
       protected: Ogre2SubMeshStorePtr subMeshes;
 
+      /// \brief Replace the ogre item of the mesh, e.g. the placeholder of a
+      /// mesh loaded in the background, by an item of the loaded mesh. The
+      /// new item takes the place of the old one in the scene node and the
+      /// submeshes are recreated, keeping the material set on the mesh.
+      /// \param[in] _item New ogre item
+      /// \param[in] _meshName Name of the ogre mesh of the new item
+      private: void ReplaceOgreItem(Ogre::Item *_item,
+                   const std::string &_meshName);
+
       /// \brief Pointer to the ogre item object
       protected: Ogre::Item *ogreItem = nullptr;
 
+      /// \brief False while the mesh shows a placeholder, see IsLoaded
+      protected: bool loaded = true;
+
       /// \brief Make scene our friend so it can create an ogre2 mesh
       private: friend class Ogre2Scene;
 
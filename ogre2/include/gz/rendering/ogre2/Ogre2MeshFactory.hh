@@ -57,6 +57,20 @@ namespace gz
       /// mesh
       public: virtual Ogre2MeshPtr Create(const MeshDescriptor &_desc);
 
+      /// \brief Create a mesh whose vertex and index data is packed on worker
+      /// threads. The mesh shows a box the size of its bounds until
+      /// UpdateAsyncLoads uploads the data. Meshes with a skeleton are
+      /// created right away, like Create does.
+      /// \param[in] _desc Mesh descriptor containing data needed to create a
+      /// mesh
+      /// \return The created mesh
+      public: virtual Ogre2MeshPtr CreateAsync(const MeshDescriptor &_desc);
+
+      /// \brief Upload the meshes packed by the worker threads since the
+      /// last call and replace the placeholders of the meshes created by
+      /// CreateAsync. Must be called from the render thread.
+      public: void UpdateAsyncLoads();
+
       /// \brief Cleanup and clear all internal ogre v2 meshes created by this
       /// factory
       public: virtual void Clear();
@@ -79,6 +93,13 @@ namespace gz
       /// \param[in] _desc Input mesh descriptor
       protected: virtual bool LoadImpl(const MeshDescriptor &_desc);
 
+      /// \brief Helper function to load a mesh without skeleton from the
+      /// input mesh descriptor straight into v2 vertex and index buffers,
+      /// without going through a v1 mesh
+      /// \param[in] _desc Input mesh descriptor
+      /// \return True if the mesh was loaded
+      private: bool LoadImplV2(const MeshDescriptor &_desc);
+
       /// \brief Get the mesh name from the mesh descriptor
       /// \param[in] _desc Mesh descriptor containing the mesh name
       protected: virtual std::string MeshName(const MeshDescriptor &_desc);
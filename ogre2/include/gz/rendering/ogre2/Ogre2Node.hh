@@ -52,6 +52,13 @@ namespace gz
       /// \return Ogre scene node pointer
       public: virtual Ogre::SceneNode *Node() const;
 
+      /// \brief Set the local pose of the node only if it differs from the
+      /// current one. Nodes without an origin offset are written straight
+      /// to the Ogre scene node. Used by Ogre2Scene::SetLocalPoses.
+      /// \param[in] _pose New local pose
+      /// \return True if the pose of the node changed
+      public: bool UpdateLocalPose(const math::Pose3d &_pose);
+
       // Documentation inherited.
       public: virtual void Destroy() override;
 
@@ -106,6 +113,13 @@ namespace gz
       /// \param[in] _parent The parent ogre node
       protected: virtual void SetParent(Ogre2NodePtr _parent);
 
+      /// \brief Tell ogre that this node changed if it is static, so that
+      /// its transform and the bounds of its objects are recomputed. Ogre
+      /// does not update static nodes every frame. Does nothing for dynamic
+      /// nodes.
+      /// \sa Visual::SetStatic
+      protected: void NotifyStaticDirty();
+
       // Documentation inherited.
       protected: virtual void Load() override;
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2POINTCLOUDVISUAL_HH_
+#define GZ_RENDERING_OGRE2_OGRE2POINTCLOUDVISUAL_HH_
+
+#include <gz/utils/ImplPtr.hh>
+
+#include "gz/rendering/config.hh"
+
+#include "gz/rendering/base/BasePointCloudVisual.hh"
+#include "gz/rendering/ogre2/Export.hh"
+#include "gz/rendering/ogre2/Ogre2Visual.hh"
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+
+    /// \brief Ogre 2.x implementation of a PointCloudVisual class.
+    ///
+    /// Every octree node uploaded to the GPU is an item of its own. A
+    /// camera listener selects the nodes drawn by each camera right before
+    /// it renders, and PreRender uploads the nodes the cameras asked for.
+    class GZ_RENDERING_OGRE2_VISIBLE Ogre2PointCloudVisual :
+      public BasePointCloudVisual<Ogre2Visual>
+    {
+      /// \brief Constructor.
+      protected: Ogre2PointCloudVisual();
+
+      /// \brief Destructor.
+      public: virtual ~Ogre2PointCloudVisual();
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
+      // Documentation inherited.
+      public: virtual void AddPoints(const float *_points,
+                  const uint8_t *_colors, size_t _count) override;
+
+      // Documentation inherited.
+      public: virtual void ClearPoints() override;
+
+      // Documentation inherited.
+      public: virtual size_t PointCount() const override;
+
+      // Documentation inherited.
+      public: virtual size_t DrawnPointCount() const override;
+
+      // Documentation inherited.
+      public: virtual void SetVisible(bool _visible) override;
+
+      /// \brief Add the camera listener to the cameras of the scene
+      private: void UpdateCameraListener();
+
+      /// \brief Upload the nodes selected by the cameras, within the upload
+      /// budget, and evict the nodes that were not drawn recently
+      private: void UpdateGpuNodes();
+
+      /// \brief Destroy the GPU resources of all the nodes
+      private: void DestroyGpuNodes();
+
+      /// \brief Only the ogre scene can instanstiate this class
+      private: friend class Ogre2Scene;
+
+      /// \cond warning
+      /// \brief Private data pointer
+      GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
+      /// \endcond
+    };
+    }
+  }
+}
+#endif
@@ -148,6 +148,16 @@ namespace gz
       /// \brief See Camera::PrepareForExternalSampling
       public: void PrepareForExternalSampling();
 
+      /// \brief Set the number of frames by which Copy() may lag behind
+      /// rendering. See Camera::SetReadbackLatency
+      /// \param[in] _frames Frames of readback latency, 0 for blocking
+      /// readback.
+      public: void SetReadbackLatency(unsigned int _frames);
+
+      /// \brief Get the number of frames of readback latency used by Copy()
+      /// \return Frames of readback latency
+      public: unsigned int ReadbackLatency() const;
+
       /// \brief Destroy the render texture
       protected: void DestroyTargetImpl();
 
@@ -57,6 +57,7 @@ namespace gz
     class Ogre2Object;
     class Ogre2ObjectInterface;
     class Ogre2ParticleEmitter;
+    class Ogre2PointCloudVisual;
     class Ogre2Projector;
     class Ogre2PointLight;
     class Ogre2RayQuery;
@@ -116,6 +117,7 @@ namespace gz
       Ogre2GlobalIlluminationCiVctPtr;
     typedef shared_ptr<Ogre2GlobalIlluminationVct>
       Ogre2GlobalIlluminationVctPtr;
+    typedef shared_ptr<Ogre2PointCloudVisual>     Ogre2PointCloudVisualPtr;
     typedef shared_ptr<Ogre2PointLight>           Ogre2PointLightPtr;
     typedef shared_ptr<Ogre2Projector>            Ogre2ProjectorPtr;
     typedef shared_ptr<Ogre2RayQuery>             Ogre2RayQueryPtr;
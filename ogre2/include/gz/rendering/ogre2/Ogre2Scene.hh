@@ -51,6 +51,7 @@ namespace gz
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     //
     // forward declaration
+    class Ogre2MeshBvhCache;
     class Ogre2ScenePrivate;
     //
     /// \brief Ogre2.x implementation of the scene class
@@ -87,6 +88,10 @@ namespace gz
       // Documentation inherited.
       public: void SetBackgroundColor(const math::Color &_color) override;
 
+      // Documentation inherited
+      public: virtual unsigned int SetLocalPoses(const unsigned int *_ids,
+          const math::Pose3d *_poses, unsigned int _count) override;
+
       // Documentation inherited
       public: virtual void PreRender() override;
 
@@ -136,6 +141,12 @@ namespace gz
       // Documentation inherited
       public: virtual void PostRender() override;
 
+      // Documentation inherited
+      public: virtual unsigned int DrawCallCount() const override;
+
+      // Documentation inherited
+      public: virtual unsigned int DrawnInstanceCount() const override;
+
       /// \cond PRIVATE
       /// \brief Certain functions like Ogre2Camera::VisualAt would
       /// need to call PreRender and PostFrame, which is very unintuitive
@@ -211,6 +222,12 @@ namespace gz
       /// \return True if the number of shadow casting lights changed
       /// \sa ShadowsDirty
       public: bool ShadowsDirty() const;
+
+      /// \internal
+      /// \brief Get the triangle hierarchies of the meshes in the scene,
+      /// used by ray queries to intersect meshes
+      /// \return Mesh hierarchy cache
+      public: Ogre2MeshBvhCache &MeshBvhCache();
       /// \endcond
 
       // Documentation inherited
@@ -323,6 +340,11 @@ namespace gz
                      const std::string &_name, const MeshDescriptor &_desc)
                      override;
 
+      // Documentation inherited
+      protected: virtual MeshPtr CreateMeshAsyncImpl(unsigned int _id,
+                     const std::string &_name, const MeshDescriptor &_desc)
+                     override;
+
       // Documentation inherited
       protected: virtual CapsulePtr CreateCapsuleImpl(unsigned int _id,
                      const std::string &_name) override;
@@ -339,6 +361,10 @@ namespace gz
       protected: virtual MarkerPtr CreateMarkerImpl(unsigned int _id,
                      const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual PointCloudVisualPtr CreatePointCloudVisualImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual LidarVisualPtr CreateLidarVisualImpl(unsigned int _id,
                      const std::string &_name) override;
@@ -95,6 +95,10 @@ namespace gz
       public: void LabelMapFromColoredBuffer(
                   uint8_t * _labelBuffer) const override;
 
+      // Documentation inherited.
+      public: virtual void SetOutputBuffer(void *_buffer, size_t _size)
+                  override;
+
       // Documentation inherited.
       public: virtual Ogre::Camera *OgreCamera() const override;
 
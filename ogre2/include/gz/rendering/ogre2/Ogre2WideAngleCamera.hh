@@ -17,6 +17,8 @@
 #ifndef GZ_RENDERING_OGRE2_WIDEANGLECAMERA_HH_
 #define GZ_RENDERING_OGRE2_WIDEANGLECAMERA_HH_
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -34,6 +36,10 @@ namespace gz
     inline namespace GZ_RENDERING_VERSION_NAMESPACE {
     //
     /// \brief Ogre implementation of WideAngleCamera
+    ///
+    /// Only the cubemap faces sampled by the lens are rendered. With
+    /// SetStaticFaceCaching, faces whose content did not change since they
+    /// were last rendered are not rendered either.
     class GZ_RENDERING_OGRE2_VISIBLE Ogre2WideAngleCamera :
         public BaseWideAngleCamera<Ogre2Sensor>
     {
@@ -206,6 +212,17 @@ namespace gz
       /// \param[in] _pass Material Pass to setup
       private: void PrepareForFinalPass(Ogre::Pass *_pass);
 
+      /// \brief Find the cubemap faces sampled by the stitching pass, if
+      /// the lens, field of view or image size changed
+      private: void UpdateCubeFaces();
+
+      /// \brief Compute a signature of what every cubemap face sees: the
+      /// pose of the camera, the lights, the background and the bounds,
+      /// orientation and materials of the objects overlapping the face
+      /// \param[out] _signatures Signature of every face
+      private: void FaceSignatures(std::array<uint64_t, 6> &_signatures)
+          const;
+
       /// \cond warning
       /// \brief Private data pointer
       GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
@@ -15,13 +15,17 @@
  *
  */
 
+#include <algorithm>
 #include <limits>
+#include <unordered_map>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable:5033)
 #endif
 #include <OgreBitwise.h>
+#include <Threading/OgreUniformScalableTask.h>
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -48,12 +52,62 @@
 #include "gz/rendering/ogre2/Ogre2Visual.hh"
 
 #include "Ogre2BoundingBoxMaterialSwitcher.hh"
+#include "Ogre2GpuReadbackTicket.hh"
 
 using namespace gz;
 using namespace rendering;
 
 class gz::rendering::Ogre2BoundingBoxCameraPrivate
 {
+  /// \brief Local space vertex positions of a mesh, read once from the
+  /// vertex buffers and kept as one array per component
+  public: struct MeshPositions
+  {
+    /// \brief Vertex array objects the positions were read from, they
+    /// change when the mesh is reloaded
+    std::vector<const Ogre::VertexArrayObject *> vaos;
+
+    /// \brief X components of the vertex positions
+    std::vector<float> x;
+
+    /// \brief Y components of the vertex positions
+    std::vector<float> y;
+
+    /// \brief Z components of the vertex positions
+    std::vector<float> z;
+
+    /// \brief Value of frameCount when the positions were last used
+    uint64_t lastUsedFrame = 0u;
+  };
+
+  /// \brief Get the local space vertex positions of a mesh. They are read
+  /// from the gpu the first time the mesh is seen and cached afterwards.
+  /// \param[in] _mesh Mesh to get the positions of
+  /// \return Vertex positions of the mesh
+  public: const MeshPositions &Positions(const Ogre::MeshPtr &_mesh);
+
+  /// \brief Drop the positions of meshes that were not used for a while
+  /// and advance the frame count
+  public: void PrunePositions();
+
+  /// \brief Transform vertex positions by a matrix, divide x and y by w and
+  /// find the min & max of the results
+  /// \param[in] _positions Vertex positions
+  /// \param[in] _transform Transform from local space to clip space
+  /// \param[out] _minVertex Minimum of projected x & y & z of the vertices
+  /// \param[out] _maxVertex Maximum of projected x & y & z of the vertices
+  public: static void ProjectedBounds(const MeshPositions &_positions,
+              const Ogre::Matrix4 &_transform, Ogre::Vector3 &_minVertex,
+              Ogre::Vector3 &_maxVertex);
+
+  /// \brief Transform vertex positions by an affine matrix
+  /// \param[in] _positions Vertex positions
+  /// \param[in] _transform Affine transform from local space
+  /// \param[out] _vertices Vector the transformed positions are appended to
+  public: static void TransformPositions(const MeshPositions &_positions,
+              const Ogre::Matrix4 &_transform,
+              std::vector<math::Vector3d> &_vertices);
+
   /// \brief Merge a vector of 2D boxes. Used in multi-links model.
   /// \param[in] _boxes Vector of 2D boxes
   /// \return Merged bounding box
@@ -127,6 +181,11 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   /// \brief Buffer to store render texture data & to be sent to listeners
   public: uint8_t *buffer = nullptr;
 
+  /// \brief Persistent GPU->CPU readback ticket used by the non-legacy
+  /// PostRender path. The ogre id map must match the items gathered in the
+  /// same frame, so this camera always reads back synchronously.
+  public: Ogre2GpuReadbackTicket readback;
+
   /// \brief Dummy render texture to set image dims
   public: Ogre2RenderTexturePtr dummyTexture {nullptr};
 
@@ -169,6 +228,18 @@ class gz::rendering::Ogre2BoundingBoxCameraPrivate
   /// \brief Bounding Box type
   public: BoundingBoxType type {BoundingBoxType::BBT_VISIBLEBOX2D};
 
+  /// \brief Cached vertex positions of the meshes of the labelled items
+  /// Key: ogre mesh resource handle, value: its vertex positions
+  public: std::unordered_map<Ogre::ResourceHandle, MeshPositions>
+      meshPositions;
+
+  /// \brief Number of frames rendered, used to drop unused mesh positions
+  public: uint64_t frameCount = 0u;
+
+  /// \brief Number of frames a mesh can go unused before its positions
+  /// are dropped
+  public: static constexpr uint64_t kMaxPositionsIdleFrames = 100u;
+
   /// \brief Alias variable that's used in the ClipToViewPort and
   /// LocationRelativeToViewPort methods.
   /// Binary representation of 0000
@@ -407,6 +478,7 @@ void Ogre2BoundingBoxCamera::CreateCamera()
 void Ogre2BoundingBoxCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
+  this->dataPtr->readback.Destroy();
 
   if (this->dataPtr->buffer)
   {
@@ -576,6 +648,30 @@ void Ogre2BoundingBoxCamera::Render()
   this->scene->FlushGpuCommandsAndStartNewFrame(1u, false);
 }
 
+namespace
+{
+  /// \brief Copy one mapped RGBA8 readback box into the RGB ogre id buffer
+  /// (drops alpha) in a single stride-aware pass.
+  /// Honors _box.bytesPerRow as the source stride.
+  void FillOgreIdBuffer(const Ogre::TextureBox &_box, uint8_t *_buffer,
+      unsigned int _width, unsigned int _height, unsigned int _channels,
+      unsigned int _rawChannels)
+  {
+    const uint8_t *src = static_cast<const uint8_t *>(_box.data);
+    for (unsigned int row = 0; row < _height; ++row)
+    {
+      const uint8_t *srcRow = src + row * _box.bytesPerRow;
+      uint8_t *dstRow = _buffer + row * _width * _channels;
+      for (unsigned int column = 0; column < _width; ++column)
+      {
+        dstRow[column * _channels] = srcRow[column * _rawChannels];
+        dstRow[column * _channels + 1] = srcRow[column * _rawChannels + 1];
+        dstRow[column * _channels + 2] = srcRow[column * _rawChannels + 2];
+      }
+    }
+  }
+}  // namespace
+
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::PostRender()
 {
@@ -599,40 +695,70 @@ void Ogre2BoundingBoxCamera::PostRender()
   // raw gpu texture format is RGBA8
   unsigned int rawChannelCount = 4u;
 
-  Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreRenderTexture, 0u, 0u);
-  Ogre::TextureBox box = image.getData(0);
-  uint8_t *imgBufferTmp = static_cast<uint8_t *>(box.data);
   if (!this->dataPtr->buffer)
   {
     auto bufferSize = PixelUtil::MemorySize(format, width, height);
     this->dataPtr->buffer = new uint8_t[bufferSize];
   }
 
-  for (unsigned int row = 0; row < height; ++row)
+  bool frameValid = true;
+  if (Ogre2UseLegacyReadback())
   {
-    // the texture box step size could be larger than our image buffer step
-    // size
-    unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
-    for (unsigned int column = 0; column < width; ++column)
+    // Legacy A/B control: original Ogre::Image2 path, kept verbatim.
+    Ogre::Image2 image;
+    image.convertFromTexture(this->dataPtr->ogreRenderTexture, 0u, 0u);
+    Ogre::TextureBox box = image.getData(0);
+    uint8_t *imgBufferTmp = static_cast<uint8_t *>(box.data);
+
+    for (unsigned int row = 0; row < height; ++row)
+    {
+      // the texture box step size could be larger than our image buffer step
+      // size
+      unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
+      for (unsigned int column = 0; column < width; ++column)
+      {
+        unsigned int idx = (row * width * channelCount) +
+            column * channelCount;
+        unsigned int rawIdx = rawDataRowIdx +
+            column * rawChannelCount;
+
+        this->dataPtr->buffer[idx] = imgBufferTmp[rawIdx];
+        this->dataPtr->buffer[idx + 1] = imgBufferTmp[rawIdx + 1];
+        this->dataPtr->buffer[idx + 2] = imgBufferTmp[rawIdx + 2];
+      }
+    }
+  }
+  else
+  {
+    // Persistent-ticket path: map the staging buffer once and repack
+    // RGBA->RGB in a single fused pass.
+    Ogre::TextureBox box = this->dataPtr->readback.DownloadAndMap(
+        this->dataPtr->ogreRenderTexture);
+    if (box.data)
+    {
+      FillOgreIdBuffer(box, this->dataPtr->buffer, width, height,
+          channelCount, rawChannelCount);
+      this->dataPtr->readback.Unmap();
+    }
+    else
     {
-      unsigned int idx = (row * width * channelCount) +
-          column * channelCount;
-      unsigned int rawIdx = rawDataRowIdx +
-          column * rawChannelCount;
-
-      this->dataPtr->buffer[idx] = imgBufferTmp[rawIdx];
-      this->dataPtr->buffer[idx + 1] = imgBufferTmp[rawIdx + 1];
-      this->dataPtr->buffer[idx + 2] = imgBufferTmp[rawIdx + 2];
+      gzerr << "Ogre2BoundingBoxCamera: GPU readback failed; dropping frame"
+            << std::endl;
+      frameValid = false;
     }
   }
 
-  if (this->dataPtr->type == BoundingBoxType::BBT_VISIBLEBOX2D)
-    this->VisibleBoundingBoxes();
-  else if (this->dataPtr->type == BoundingBoxType::BBT_FULLBOX2D)
-    this->FullBoundingBoxes();
-  else if (this->dataPtr->type == BoundingBoxType::BBT_BOX3D)
-    this->BoundingBoxes3D();
+  // on a failed readback skip box extraction but still reset the per frame
+  // state below
+  if (frameValid)
+  {
+    if (this->dataPtr->type == BoundingBoxType::BBT_VISIBLEBOX2D)
+      this->VisibleBoundingBoxes();
+    else if (this->dataPtr->type == BoundingBoxType::BBT_FULLBOX2D)
+      this->FullBoundingBoxes();
+    else if (this->dataPtr->type == BoundingBoxType::BBT_BOX3D)
+      this->BoundingBoxes3D();
+  }
 
   this->dataPtr->boundingboxes.clear();
   this->dataPtr->visibleBoxesLabel.clear();
@@ -641,8 +767,10 @@ void Ogre2BoundingBoxCamera::PostRender()
   this->dataPtr->itemVertices.clear();
   this->dataPtr->ogreIdToItem.clear();
   this->dataPtr->materialSwitcher->ogreIdName.clear();
+  this->dataPtr->PrunePositions();
 
-  this->dataPtr->newBoundingBoxes(this->dataPtr->outputBoxes);
+  if (frameValid)
+    this->dataPtr->newBoundingBoxes(this->dataPtr->outputBoxes);
 }
 
 /////////////////////////////////////////////////
@@ -659,6 +787,10 @@ void Ogre2BoundingBoxCamera::MarkVisibleBoxes()
   uint32_t height = this->ImageHeight();
   uint32_t channelCount = 3;
 
+  // neighbouring pixels mostly belong to the same item, only look it up
+  // when the ogre id changes
+  uint32_t lastOgreId = std::numeric_limits<uint32_t>::max();
+
   // Filter bounding boxes by looping over all pixels in ogre ids map
   for (uint32_t y = 0; y < height; ++y)
   {
@@ -675,6 +807,9 @@ void Ogre2BoundingBoxCamera::MarkVisibleBoxes()
       uint32_t ogreId1 = this->dataPtr->buffer[index + 1];
       uint32_t ogreId2 = this->dataPtr->buffer[index + 0];
       uint32_t ogreId = ogreId1 * 256 + ogreId2;
+      if (ogreId == lastOgreId)
+        continue;
+      lastOgreId = ogreId;
 
       // mark the ogreId as visible not to filter its bbox
       if (!this->dataPtr->visibleBoxesLabel.count(ogreId))
@@ -683,6 +818,201 @@ void Ogre2BoundingBoxCamera::MarkVisibleBoxes()
   }
 }
 
+/////////////////////////////////////////////////
+const Ogre2BoundingBoxCameraPrivate::MeshPositions &
+    Ogre2BoundingBoxCameraPrivate::Positions(const Ogre::MeshPtr &_mesh)
+{
+  MeshPositions &positions = this->meshPositions[_mesh->getHandle()];
+  positions.lastUsedFrame = this->frameCount;
+
+  std::vector<const Ogre::VertexArrayObject *> vaos;
+  for (const auto &subMesh : _mesh->getSubMeshes())
+  {
+    // Get the first LOD level
+    if (!subMesh->mVao[0].empty())
+      vaos.push_back(subMesh->mVao[0][0]);
+  }
+  if (vaos == positions.vaos)
+    return positions;
+
+  GZ_PROFILE("Ogre2BoundingBoxCameraPrivate::Positions");
+  positions.vaos = vaos;
+  positions.x.clear();
+  positions.y.clear();
+  positions.z.clear();
+
+  for (const Ogre::VertexArrayObject *constVao : vaos)
+  {
+    Ogre::VertexArrayObject *vao =
+        const_cast<Ogre::VertexArrayObject *>(constVao);
+
+    // request async read from buffer
+    Ogre::VertexArrayObject::ReadRequestsArray requests;
+    requests.push_back(Ogre::VertexArrayObject::ReadRequests(
+      Ogre::VES_POSITION));
+    vao->readRequests(requests);
+    vao->mapAsyncTickets(requests);
+
+    unsigned int subMeshVerticiesNum =
+      requests[0].vertexBuffer->getNumElements();
+    positions.x.reserve(positions.x.size() + subMeshVerticiesNum);
+    positions.y.reserve(positions.y.size() + subMeshVerticiesNum);
+    positions.z.reserve(positions.z.size() + subMeshVerticiesNum);
+    for (size_t i = 0; i < subMeshVerticiesNum; ++i)
+    {
+      Ogre::Vector3 vec;
+      if (requests[0].type == Ogre::VET_HALF4)
+      {
+        const Ogre::uint16* vertex = reinterpret_cast<const Ogre::uint16*>
+          (requests[0].data);
+        vec.x = Ogre::Bitwise::halfToFloat(vertex[0]);
+        vec.y = Ogre::Bitwise::halfToFloat(vertex[1]);
+        vec.z = Ogre::Bitwise::halfToFloat(vertex[2]);
+      }
+      else if (requests[0].type == Ogre::VET_FLOAT3)
+      {
+        const float* vertex =
+          reinterpret_cast<const float*>(requests[0].data);
+        vec.x = *vertex++;
+        vec.y = *vertex++;
+        vec.z = *vertex++;
+      }
+      else
+        gzerr << "Vertex Buffer type error" << std::endl;
+
+      positions.x.push_back(vec.x);
+      positions.y.push_back(vec.y);
+      positions.z.push_back(vec.z);
+
+      // get the next element
+      requests[0].data += requests[0].vertexBuffer->getBytesPerElement();
+    }
+    vao->unmapAsyncTickets(requests);
+  }
+
+  return positions;
+}
+
+/////////////////////////////////////////////////
+void Ogre2BoundingBoxCameraPrivate::PrunePositions()
+{
+  for (auto it = this->meshPositions.begin();
+       it != this->meshPositions.end();)
+  {
+    if (this->frameCount - it->second.lastUsedFrame > kMaxPositionsIdleFrames)
+      it = this->meshPositions.erase(it);
+    else
+      ++it;
+  }
+  ++this->frameCount;
+}
+
+/////////////////////////////////////////////////
+void Ogre2BoundingBoxCameraPrivate::ProjectedBounds(
+    const MeshPositions &_positions, const Ogre::Matrix4 &_transform,
+    Ogre::Vector3 &_minVertex, Ogre::Vector3 &_maxVertex)
+{
+  // The vertices are processed in blocks of kLanes with one running min &
+  // max per lane, so the compiler can vectorize the loop without having to
+  // reorder a floating point reduction.
+  constexpr size_t kLanes = 8u;
+  const float max = std::numeric_limits<float>::max();
+  float minX[kLanes], minY[kLanes], minZ[kLanes];
+  float maxX[kLanes], maxY[kLanes], maxZ[kLanes];
+  for (size_t l = 0; l < kLanes; ++l)
+  {
+    minX[l] = minY[l] = minZ[l] = max;
+    maxX[l] = maxY[l] = maxZ[l] = -max;
+  }
+
+  const float m00 = static_cast<float>(_transform[0][0]);
+  const float m01 = static_cast<float>(_transform[0][1]);
+  const float m02 = static_cast<float>(_transform[0][2]);
+  const float m03 = static_cast<float>(_transform[0][3]);
+  const float m10 = static_cast<float>(_transform[1][0]);
+  const float m11 = static_cast<float>(_transform[1][1]);
+  const float m12 = static_cast<float>(_transform[1][2]);
+  const float m13 = static_cast<float>(_transform[1][3]);
+  const float m20 = static_cast<float>(_transform[2][0]);
+  const float m21 = static_cast<float>(_transform[2][1]);
+  const float m22 = static_cast<float>(_transform[2][2]);
+  const float m23 = static_cast<float>(_transform[2][3]);
+  const float m30 = static_cast<float>(_transform[3][0]);
+  const float m31 = static_cast<float>(_transform[3][1]);
+  const float m32 = static_cast<float>(_transform[3][2]);
+  const float m33 = static_cast<float>(_transform[3][3]);
+
+  const float *x = _positions.x.data();
+  const float *y = _positions.y.data();
+  const float *z = _positions.z.data();
+  const size_t count = _positions.x.size();
+
+  auto project = [&](size_t _i, size_t _l)
+  {
+    const float cx = m00 * x[_i] + m01 * y[_i] + m02 * z[_i] + m03;
+    const float cy = m10 * x[_i] + m11 * y[_i] + m12 * z[_i] + m13;
+    const float cz = m20 * x[_i] + m21 * y[_i] + m22 * z[_i] + m23;
+    const float cw = m30 * x[_i] + m31 * y[_i] + m32 * z[_i] + m33;
+
+    // homogeneous
+    const float px = cx / cw;
+    const float py = cy / cw;
+
+    minX[_l] = px < minX[_l] ? px : minX[_l];
+    minY[_l] = py < minY[_l] ? py : minY[_l];
+    minZ[_l] = cz < minZ[_l] ? cz : minZ[_l];
+    maxX[_l] = px > maxX[_l] ? px : maxX[_l];
+    maxY[_l] = py > maxY[_l] ? py : maxY[_l];
+    maxZ[_l] = cz > maxZ[_l] ? cz : maxZ[_l];
+  };
+
+  size_t i = 0u;
+  for (; i + kLanes <= count; i += kLanes)
+  {
+    for (size_t l = 0; l < kLanes; ++l)
+      project(i + l, l);
+  }
+  for (; i < count; ++i)
+    project(i, 0u);
+
+  _minVertex = Ogre::Vector3(max, max, max);
+  _maxVertex = Ogre::Vector3(-max, -max, -max);
+  for (size_t l = 0; l < kLanes; ++l)
+  {
+    _minVertex.x = std::min<Ogre::Real>(_minVertex.x, minX[l]);
+    _minVertex.y = std::min<Ogre::Real>(_minVertex.y, minY[l]);
+    _minVertex.z = std::min<Ogre::Real>(_minVertex.z, minZ[l]);
+    _maxVertex.x = std::max<Ogre::Real>(_maxVertex.x, maxX[l]);
+    _maxVertex.y = std::max<Ogre::Real>(_maxVertex.y, maxY[l]);
+    _maxVertex.z = std::max<Ogre::Real>(_maxVertex.z, maxZ[l]);
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2BoundingBoxCameraPrivate::TransformPositions(
+    const MeshPositions &_positions, const Ogre::Matrix4 &_transform,
+    std::vector<math::Vector3d> &_vertices)
+{
+  const float *x = _positions.x.data();
+  const float *y = _positions.y.data();
+  const float *z = _positions.z.data();
+  const size_t count = _positions.x.size();
+
+  const size_t offset = _vertices.size();
+  _vertices.resize(offset + count);
+  math::Vector3d *out = _vertices.data() + offset;
+  for (size_t i = 0; i < count; ++i)
+  {
+    out[i].Set(
+        _transform[0][0] * x[i] + _transform[0][1] * y[i] +
+        _transform[0][2] * z[i] + _transform[0][3],
+        _transform[1][0] * x[i] + _transform[1][1] * y[i] +
+        _transform[1][2] * z[i] + _transform[1][3],
+        _transform[2][0] * x[i] + _transform[2][1] * y[i] +
+        _transform[2][2] * z[i] + _transform[2][3]);
+  }
+}
+
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCameraPrivate::MeshVertices(
     const std::vector<uint32_t> &_ogreIds,
@@ -694,76 +1024,17 @@ void Ogre2BoundingBoxCameraPrivate::MeshVertices(
   for (const auto &ogreId : _ogreIds)
   {
     Ogre::Item *item = this->ogreIdToItem[ogreId];
-    Ogre::MeshPtr mesh = item->getMesh();
     Ogre::Node *node = item->getParentNode();
 
-    Ogre::Vector3 position = node->_getDerivedPosition();
-    Ogre::Quaternion oreintation = node->_getDerivedOrientation();
-    Ogre::Vector3 scale = node->_getDerivedScale();
-
-    auto subMeshes = mesh->getSubMeshes();
+    // local to world to camera view coordinates
+    Ogre::Matrix4 worldMatrix;
+    worldMatrix.makeTransform(node->_getDerivedPosition(),
+        node->_getDerivedScale(), node->_getDerivedOrientation());
 
-    for (const auto &subMesh : subMeshes)
-    {
-      Ogre::VertexArrayObjectArray vaos = subMesh->mVao[0];
-
-      if (!vaos.empty())
-      {
-        // Get the first LOD level
-        Ogre::VertexArrayObject *vao = vaos[0];
-
-        // request async read from buffer
-        Ogre::VertexArrayObject::ReadRequestsArray requests;
-        requests.push_back(Ogre::VertexArrayObject::ReadRequests(
-          Ogre::VES_POSITION));
-        vao->readRequests(requests);
-        vao->mapAsyncTickets(requests);
-
-        unsigned int subMeshVerticiesNum =
-          requests[0].vertexBuffer->getNumElements();
-        for (size_t i = 0; i < subMeshVerticiesNum; ++i)
-        {
-          Ogre::Vector3 vec;
-          if (requests[0].type == Ogre::VET_HALF4)
-          {
-            const Ogre::uint16* vertex = reinterpret_cast<const Ogre::uint16*>
-              (requests[0].data);
-            vec.x = Ogre::Bitwise::halfToFloat(vertex[0]);
-            vec.y = Ogre::Bitwise::halfToFloat(vertex[1]);
-            vec.z = Ogre::Bitwise::halfToFloat(vertex[2]);
-          }
-          else if (requests[0].type == Ogre::VET_FLOAT3)
-          {
-            const float* vertex =
-              reinterpret_cast<const float*>(requests[0].data);
-            vec.x = *vertex++;
-            vec.y = *vertex++;
-            vec.z = *vertex++;
-          }
-          else
-            gzerr << "Vertex Buffer type error" << std::endl;
-
-          // Convert to world coordinates
-          vec = (oreintation * (vec * scale)) + position;
-
-          // Convert to camera view coordinates
-          Ogre::Vector4 vec4(vec.x, vec.y, vec.z, 1);
-          vec4 = viewMatrix * vec4;
-
-          vec.x = vec4.x;
-          vec.y = vec4.y;
-          vec.z = vec4.z;
-
-          // Add the vertex to the vertices of all items that
-          // belongs to the same parent
-          _vertices.push_back(Ogre2Conversions::Convert(vec));
-
-          // get the next element
-          requests[0].data += requests[0].vertexBuffer->getBytesPerElement();
-        }
-        vao->unmapAsyncTickets(requests);
-      }
-    }
+    // Add the vertices to the vertices of all items that
+    // belongs to the same parent
+    TransformPositions(this->Positions(item->getMesh()),
+        viewMatrix * worldMatrix, _vertices);
   }
 }
 
@@ -989,6 +1260,11 @@ void Ogre2BoundingBoxCamera::VisibleBoundingBoxes()
 
   std::unordered_map<uint32_t, std::shared_ptr<BoxBoundary>> boxesBoundary;
 
+  // neighbouring pixels mostly belong to the same item, only look up its
+  // boundary when the ogre id changes
+  uint32_t lastOgreId = std::numeric_limits<uint32_t>::max();
+  BoxBoundary *lastBoundary = nullptr;
+
   // find item's boundaries from panoptic BoundingBox
   for (uint32_t y = 0; y < height; y++)
   {
@@ -1005,6 +1281,15 @@ void Ogre2BoundingBoxCamera::VisibleBoundingBoxes()
         // get the OGRE id of 16 bit value
         uint32_t ogreId = ogreId1 * 256 + ogreId2;
 
+        if (ogreId == lastOgreId)
+        {
+          lastBoundary->minX = std::min<uint32_t>(lastBoundary->minX, x);
+          lastBoundary->minY = std::min<uint32_t>(lastBoundary->minY, y);
+          lastBoundary->maxX = std::max<uint32_t>(lastBoundary->maxX, x);
+          lastBoundary->maxY = std::max<uint32_t>(lastBoundary->maxY, y);
+          continue;
+        }
+
         std::shared_ptr<BoundingBox> box;
         std::shared_ptr<BoxBoundary> boundary;
 
@@ -1032,6 +1317,9 @@ void Ogre2BoundingBoxCamera::VisibleBoundingBoxes()
         boundary->minY = std::min<uint32_t>(boundary->minY, y);
         boundary->maxX = std::max<uint32_t>(boundary->maxX, x);
         boundary->maxY = std::max<uint32_t>(boundary->maxY, y);
+
+        lastOgreId = ogreId;
+        lastBoundary = boundary.get();
       }
     }
   }
@@ -1054,6 +1342,52 @@ void Ogre2BoundingBoxCamera::VisibleBoundingBoxes()
   this->MergeMultiLinksModels2D();
 }
 
+namespace
+{
+  /// \brief Projects the cached vertices of many items and finds their
+  /// bounds in clip space, spreading the items across ogre's worker threads
+  class ThreadedProjectedBounds final
+    : public Ogre::UniformScalableTask
+  {
+    /// \brief An item to project
+    public: struct Item
+    {
+      /// \brief Vertex positions of the item's mesh
+      const Ogre2BoundingBoxCameraPrivate::MeshPositions *positions;
+
+      /// \brief Transform from the item's local space to clip space
+      Ogre::Matrix4 transform;
+
+      /// \brief Minimum of projected x & y & z of the vertices
+      Ogre::Vector3 minVertex;
+
+      /// \brief Maximum of projected x & y & z of the vertices
+      Ogre::Vector3 maxVertex;
+    };
+
+    /// \brief Constructor
+    /// \param[in, out] _items Items to project
+    public: explicit ThreadedProjectedBounds(std::vector<Item> &_items)
+        : items(_items)
+    {
+    }
+
+    // Documentation inherited
+    public: void execute(size_t _threadId, size_t _numThreads) override
+    {
+      for (size_t i = _threadId; i < this->items.size(); i += _numThreads)
+      {
+        Item &item = this->items[i];
+        Ogre2BoundingBoxCameraPrivate::ProjectedBounds(*item.positions,
+            item.transform, item.minVertex, item.maxVertex);
+      }
+    }
+
+    /// \brief Items to project
+    private: std::vector<Item> &items;
+  };
+}  // namespace
+
 /////////////////////////////////////////////////
 void Ogre2BoundingBoxCamera::FullBoundingBoxes()
 {
@@ -1063,6 +1397,12 @@ void Ogre2BoundingBoxCamera::FullBoundingBoxes()
 
   Ogre::Matrix4 viewMatrix = this->dataPtr->ogreCamera->getViewMatrix();
   Ogre::Matrix4 projMatrix = this->dataPtr->ogreCamera->getProjectionMatrix();
+  Ogre::Matrix4 viewProjMatrix = projMatrix * viewMatrix;
+
+  // Gather the visible items and their vertices. Reading vertices from the
+  // gpu must happen on this thread, but is only done once per mesh.
+  std::vector<uint32_t> ogreIds;
+  std::vector<ThreadedProjectedBounds::Item> items;
 
   auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
       Ogre::ItemFactory::FACTORY_TYPE_NAME);
@@ -1070,24 +1410,13 @@ void Ogre2BoundingBoxCamera::FullBoundingBoxes()
   {
     Ogre::MovableObject *object = itor.peekNext();
     Ogre::Item *item = static_cast<Ogre::Item *>(object);
-    Ogre::MeshPtr mesh = item->getMesh();
+    itor.moveNext();
 
     uint32_t ogreId = item->getId();
 
     // Skip the items which is hidden in the ogreId map
     if (!this->dataPtr->visibleBoxesLabel.count(ogreId))
-    {
-      itor.moveNext();
       continue;
-    }
-
-    // get attached node
-    Ogre::Node *node = item->getParentNode();
-
-    // get the derived position
-    Ogre::Vector3 position = node->_getDerivedPosition();
-    Ogre::Quaternion oreintation = node->_getDerivedOrientation();
-    Ogre::Vector3 scale = node->_getDerivedScale();
 
     Ogre::Aabb aabb = item->getWorldAabb();
     Ogre::AxisAlignedBox worldAabb;
@@ -1095,29 +1424,38 @@ void Ogre2BoundingBoxCamera::FullBoundingBoxes()
 
     // filter the boxes outside the camera frustum
     if (!this->dataPtr->ogreCamera->isVisible(worldAabb))
-    {
-      itor.moveNext();
       continue;
-    }
 
-    Ogre::Vector3 minVertex;
-    Ogre::Vector3 maxVertex;
-
-    this->MeshMinimalBox(
-      mesh,
-      viewMatrix,
-      projMatrix,
-      minVertex,
-      maxVertex,
-      position,
-      oreintation,
-      scale
-    );
+    // get attached node
+    Ogre::Node *node = item->getParentNode();
+
+    Ogre::Matrix4 worldMatrix;
+    worldMatrix.makeTransform(node->_getDerivedPosition(),
+        node->_getDerivedScale(), node->_getDerivedOrientation());
+
+    ThreadedProjectedBounds::Item projected;
+    projected.positions = &this->dataPtr->Positions(item->getMesh());
+    projected.transform = viewProjMatrix * worldMatrix;
+    items.push_back(projected);
+    ogreIds.push_back(ogreId);
+  }
+
+  // Project all the vertices of all the items
+  ThreadedProjectedBounds task(items);
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  if (items.size() > 1u && sceneManager->getNumWorkerThreads() > 1u)
+    sceneManager->executeUserScalableTask(&task, true);
+  else
+    task.execute(0u, 1u);
+
+  for (size_t i = 0; i < items.size(); ++i)
+  {
+    Ogre::Vector3 minVertex = items[i].minVertex;
+    Ogre::Vector3 maxVertex = items[i].maxVertex;
 
     if ((abs(minVertex.x) > 1 && abs(maxVertex.x) > 1) ||
         (abs(minVertex.y) > 1 && abs(maxVertex.y) > 1))
     {
-      itor.moveNext();
       continue;
     }
 
@@ -1130,9 +1468,7 @@ void Ogre2BoundingBoxCamera::FullBoundingBoxes()
         {minVertex.x + boxWidth / 2, maxVertex.y + boxHeight / 2, 0});
     box->SetSize({boxWidth, boxHeight, 0});
 
-    this->dataPtr->boundingboxes[ogreId] = box;
-
-    itor.moveNext();
+    this->dataPtr->boundingboxes[ogreIds[i]] = box;
   }
 
   // Set boxes label
@@ -1161,79 +1497,12 @@ void Ogre2BoundingBoxCamera::MeshMinimalBox(
   )
 {
   GZ_PROFILE("Ogre2BoundingBoxCamera::MeshMinimalBox");
-  _minVertex.x = std::numeric_limits<float>::max();
-  _minVertex.y = std::numeric_limits<float>::max();
-  _minVertex.z = std::numeric_limits<float>::max();
-  _maxVertex.x = -std::numeric_limits<float>::max();
-  _maxVertex.y = -std::numeric_limits<float>::max();
-  _maxVertex.z = -std::numeric_limits<float>::max();
-
-  auto subMeshes = _mesh->getSubMeshes();
-
-  for (auto subMesh : subMeshes)
-  {
-    Ogre::VertexArrayObjectArray vaos = subMesh->mVao[0];
-
-    if (!vaos.empty())
-    {
-      // Get the first LOD level
-      Ogre::VertexArrayObject *vao = vaos[0];
-
-      // request async read from buffer
-      Ogre::VertexArrayObject::ReadRequestsArray requests;
-      requests.push_back(Ogre::VertexArrayObject::ReadRequests(
-        Ogre::VES_POSITION));
-      vao->readRequests(requests);
-      vao->mapAsyncTickets(requests);
-
-      unsigned int subMeshVerticiesNum =
-        requests[0].vertexBuffer->getNumElements();
-      for (size_t i = 0; i < subMeshVerticiesNum; ++i)
-      {
-        Ogre::Vector3 vec;
-        if (requests[0].type == Ogre::VET_HALF4)
-        {
-          const Ogre::uint16* vertex = reinterpret_cast<const Ogre::uint16*>
-            (requests[0].data);
-          vec.x = Ogre::Bitwise::halfToFloat(vertex[0]);
-          vec.y = Ogre::Bitwise::halfToFloat(vertex[1]);
-          vec.z = Ogre::Bitwise::halfToFloat(vertex[2]);
-        }
-        else if (requests[0].type == Ogre::VET_FLOAT3)
-        {
-          const float* vertex =
-            reinterpret_cast<const float*>(requests[0].data);
-          vec.x = *vertex++;
-          vec.y = *vertex++;
-          vec.z = *vertex++;
-        }
-        else
-          gzerr << "Vertex Buffer type error" << std::endl;
-
-        vec = (_orientation * (vec * _scale)) + _position;
-
-        Ogre::Vector4 vec4(vec.x, vec.y, vec.z, 1);
-        vec4 =  _projMatrix * _viewMatrix * vec4;
-
-        // homogeneous
-        vec.x = vec4.x / vec4.w;
-        vec.y = vec4.y / vec4.w;
-        vec.z = vec4.z;
+  Ogre::Matrix4 worldMatrix;
+  worldMatrix.makeTransform(_position, _scale, _orientation);
 
-        _minVertex.x = std::min(_minVertex.x, vec.x);
-        _minVertex.y = std::min(_minVertex.y, vec.y);
-        _minVertex.z = std::min(_minVertex.z, vec.z);
-
-        _maxVertex.x = std::max(_maxVertex.x, vec.x);
-        _maxVertex.y = std::max(_maxVertex.y, vec.y);
-        _maxVertex.z = std::max(_maxVertex.z, vec.z);
-
-        // get the next element
-        requests[0].data += requests[0].vertexBuffer->getBytesPerElement();
-      }
-      vao->unmapAsyncTickets(requests);
-    }
-  }
+  Ogre2BoundingBoxCameraPrivate::ProjectedBounds(
+      this->dataPtr->Positions(_mesh), _projMatrix * _viewMatrix * worldMatrix,
+      _minVertex, _maxVertex);
 }
 
 /////////////////////////////////////////////////
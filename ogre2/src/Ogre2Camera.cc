@@ -24,6 +24,8 @@
 #include "gz/rendering/ogre2/Ogre2SelectionBuffer.hh"
 #include "gz/rendering/Utils.hh"
 
+#include "Ogre2MeshLod.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
@@ -159,6 +161,7 @@ void Ogre2Camera::SetMaterial(const MaterialPtr &_material)
 void Ogre2Camera::Render()
 {
   GZ_PROFILE("Ogre2Camera::Render");
+  Ogre2MeshLod::UpdateCamera(*this, this->ogreCamera, this->ImageHeight());
   this->renderTexture->Render();
 }
 
@@ -220,6 +223,7 @@ void Ogre2Camera::CreateRenderTexture()
   this->renderTexture->SetHeight(this->ImageHeight());
   this->renderTexture->SetBackgroundColor(this->scene->BackgroundColor());
   this->renderTexture->SetVisibilityMask(this->visibilityMask);
+  this->renderTexture->SetReadbackLatency(this->ReadbackLatency());
 }
 
 //////////////////////////////////////////////////
@@ -276,6 +280,14 @@ void Ogre2Camera::SetShadowsDirty()
   this->SetShadowsNodeDefDirty();
 }
 
+//////////////////////////////////////////////////
+void Ogre2Camera::SetReadbackLatency(unsigned int _frames)
+{
+  BaseCamera::SetReadbackLatency(_frames);
+  if (this->renderTexture)
+    this->renderTexture->SetReadbackLatency(_frames);
+}
+
 //////////////////////////////////////////////////
 void Ogre2Camera::SetShadowsNodeDefDirty()
 {
@@ -362,6 +374,7 @@ RenderWindowPtr Ogre2Camera::CreateRenderWindow()
   renderWindow->SetDevicePixelRatio(1);
   renderWindow->SetCamera(this->ogreCamera);
   renderWindow->SetBackgroundColor(this->scene->BackgroundColor());
+  renderWindow->SetReadbackLatency(this->ReadbackLatency());
 
   this->renderTexture = renderWindow;
   return base;
@@ -0,0 +1,474 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Profiler.hh>
+
+#include "gz/rendering/Visual.hh"
+#include "gz/rendering/ogre2/Ogre2Heightmap.hh"
+
+#include "Ogre2CpuRayCaster.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Hlms/Pbs/OgreHlmsPbsDatablock.h>
+#include <OgreItem.h>
+#include <OgreMesh2.h>
+#include <OgreRay.h>
+#include <OgreSceneManager.h>
+#include <OgreSubItem.h>
+#include <OgreTextureGpu.h>
+#include <Threading/OgreUniformScalableTask.h>
+#include "Terra/Terra.h"
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+// Define this macro to force single threaded version (in case
+// you suspect there's a bug caused by multithreading) or
+// want to benchmark.
+// #define SINGLE_THREADED
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Number of neighbouring rays cast together
+static constexpr size_t kPacketSize = 32u;
+
+/// \brief Maximum number of ray marching steps per heightmap and ray
+static constexpr float kMaxHeightfieldSteps = 65536.0f;
+
+/// \brief Number of bisection steps refining a heightmap hit
+static constexpr unsigned int kHeightfieldRefineSteps = 16u;
+
+/// \brief Casts the packets of rays assigned to every worker thread
+class GZ_RENDERING_OGRE2_HIDDEN CpuRayCastTask final
+  : public Ogre::UniformScalableTask
+{
+  /// \brief Constructor
+  /// \param[in] _run Function casting the packet at the given index
+  /// \param[in] _packetCount Number of packets
+  public: CpuRayCastTask(std::function<void(size_t)> _run,
+                         size_t _packetCount)
+    : run(std::move(_run)), packetCount(_packetCount)
+  {
+  }
+
+  // Documentation inherited
+  public: void execute(size_t _threadId, size_t _numThreads) override
+  {
+    GZ_PROFILE("CpuRayCastTask::execute");
+    for (size_t p = _threadId; p < this->packetCount; p += _numThreads)
+      this->run(p);
+  }
+
+  /// \brief Function casting the packet at the given index
+  private: std::function<void(size_t)> run;
+
+  /// \brief Number of packets
+  private: size_t packetCount;
+};
+
+//////////////////////////////////////////////////
+bool Ogre2CpuRayCaster::Enabled(const Node &_sensor)
+{
+  static const bool envEnabled =
+      (std::getenv("GZ_RENDERING_OGRE2_CPU_RAY_SENSORS") != nullptr);
+
+  const std::string key = "cpu_ray_casting";
+  if (!_sensor.HasUserData(key))
+    return envEnabled;
+
+  Variant value = _sensor.UserData(key);
+  if (const bool *boolPtr = std::get_if<bool>(&value))
+    return *boolPtr;
+  if (const int *intPtr = std::get_if<int>(&value))
+    return *intPtr != 0;
+
+  gzerr << "Error casting user data: " << key << "\n";
+  return envEnabled;
+}
+
+//////////////////////////////////////////////////
+void Ogre2CpuRayCaster::Update(Ogre2Scene &_scene, uint32_t _visibilityMask)
+{
+  GZ_PROFILE("Ogre2CpuRayCaster::Update");
+  this->instances.clear();
+  this->heightfields.clear();
+
+  const std::string laserRetroKey = "laser_retro";
+  std::unordered_map<const Ogre::Mesh *,
+      std::shared_ptr<const Ogre2MeshBvh>> meshes;
+
+  auto itor = _scene.OgreSceneManager()->getMovableObjectIterator(
+      Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (itor.hasMoreElements())
+  {
+    Ogre::Item *item = static_cast<Ogre::Item *>(itor.getNext());
+    if (!item->isAttached() || !item->getVisible() ||
+        (item->getVisibilityFlags() & _visibilityMask) == 0u)
+    {
+      continue;
+    }
+
+    const Ogre::Mesh *ogreMesh = item->getMesh().get();
+    if (!ogreMesh)
+      continue;
+
+    auto meshIt = meshes.find(ogreMesh);
+    if (meshIt == meshes.end())
+    {
+      const common::Mesh *mesh = nullptr;
+      meshIt = meshes.emplace(ogreMesh,
+          _scene.MeshBvhCache().Bvh(*ogreMesh, mesh)).first;
+    }
+    if (!meshIt->second)
+      continue;
+
+    // the hierarchy is in mesh space, which a non affine transform does not
+    // map rays into
+    const Ogre::Matrix4 &transform = item->_getParentNodeFullTransform();
+    if (!transform.isAffine())
+      continue;
+
+    Instance instance;
+    instance.invTransform = transform.inverseAffine();
+    instance.invTransform.extract3x3Matrix(instance.invLinear);
+    instance.bounds = item->getLocalAabb();
+    instance.bounds.transformAffine(transform);
+    instance.bvh = meshIt->second;
+
+    Ogre::Any userAny = item->getUserObjectBindings().getUserAny();
+    if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
+    {
+      VisualPtr visual =
+          _scene.VisualById(Ogre::any_cast<unsigned int>(userAny));
+      if (visual && visual->HasUserData(laserRetroKey))
+      {
+        Variant value = visual->UserData(laserRetroKey);
+        if (const float *floatPtr = std::get_if<float>(&value))
+          instance.retro = *floatPtr;
+        else if (const double *doublePtr = std::get_if<double>(&value))
+          instance.retro = static_cast<float>(*doublePtr);
+        else if (const int *intPtr = std::get_if<int>(&value))
+          instance.retro = static_cast<float>(*intPtr);
+        else
+          gzerr << "Error casting user data: " << laserRetroKey << "\n";
+
+        // same range as the rasterized sensors
+        instance.retro = std::clamp(instance.retro, 0.0f, 2000.0f);
+      }
+    }
+
+    if (item->getNumSubItems() > 0u)
+    {
+      const Ogre::HlmsPbsDatablock *datablock =
+          dynamic_cast<const Ogre::HlmsPbsDatablock *>(
+          item->getSubItem(0)->getDatablock());
+      if (datablock)
+      {
+        const Ogre::Vector3 diffuse = datablock->getDiffuse();
+        instance.color = Ogre::ColourValue(diffuse.x, diffuse.y, diffuse.z);
+      }
+    }
+
+    this->instances.push_back(std::move(instance));
+  }
+
+  for (const auto &weakHeightmap : _scene.Heightmaps())
+  {
+    auto heightmap = weakHeightmap.lock();
+    if (!heightmap || !heightmap->Terra())
+      continue;
+
+    const Ogre::Terra *terra = heightmap->Terra();
+    if (!terra->getVisible() ||
+        (terra->getVisibilityFlags() & _visibilityMask) == 0u ||
+        !terra->getHeightMapTex())
+    {
+      continue;
+    }
+
+    // the terrain data is in Y up space, with the origin at its lowest
+    // corner
+    const Ogre::Vector3 &origin = terra->getTerrainOriginRaw();
+    const Ogre::Vector2 &size = terra->getXZDimensions();
+    Ogre::Vector3 minPoint = origin;
+    Ogre::Vector3 maxPoint = origin +
+        Ogre::Vector3(size.x, terra->getHeight(), size.y);
+
+    Heightfield field;
+    field.terra = terra;
+    if (terra->isZUp())
+    {
+      // Y up (x, y, z) is Z up (x, -z, y)
+      field.upAxis = 2u;
+      minPoint = Ogre::Vector3(origin.x, -maxPoint.z, origin.y);
+      maxPoint = Ogre::Vector3(maxPoint.x, -origin.z, maxPoint.y);
+    }
+    else
+    {
+      field.upAxis = 1u;
+    }
+    field.bounds.setExtents(minPoint, maxPoint);
+
+    const Ogre::TextureGpu *heightTex = terra->getHeightMapTex();
+    field.step = 0.5f * std::min(
+        size.x / static_cast<float>(std::max(heightTex->getWidth(), 1u)),
+        size.y / static_cast<float>(std::max(heightTex->getHeight(), 1u)));
+    field.step = std::max(field.step, 1e-4f);
+
+    this->heightfields.push_back(field);
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2CpuRayCaster::Cast(Ogre2Scene &_scene,
+    const Ogre::Vector3 &_origin,
+    const std::vector<Ogre::Vector3> &_directions,
+    const std::vector<float> &_minDistances, float _maxDistance,
+    std::vector<float> &_distances, std::vector<uint32_t> &_objects) const
+{
+  GZ_PROFILE("Ogre2CpuRayCaster::Cast");
+  const size_t rayCount = _directions.size();
+  _distances.resize(rayCount);
+  _objects.resize(rayCount);
+  if (rayCount == 0u)
+    return;
+
+  const size_t packetCount = (rayCount + kPacketSize - 1u) / kPacketSize;
+  auto castPacket = [&](size_t _packet)
+  {
+    const size_t begin = _packet * kPacketSize;
+    const size_t end = std::min(begin + kPacketSize, rayCount);
+    this->CastPacket(_origin, _directions.data(), _minDistances.data(),
+        _maxDistance, begin, end, _distances.data(), _objects.data());
+  };
+
+#ifndef SINGLE_THREADED
+  Ogre::SceneManager *sceneManager = _scene.OgreSceneManager();
+  if (packetCount > 1u && sceneManager->getNumWorkerThreads() > 1u)
+  {
+    CpuRayCastTask task(castPacket, packetCount);
+    sceneManager->executeUserScalableTask(&task, true);
+    return;
+  }
+#else
+  (void)_scene;
+#endif
+
+  for (size_t p = 0u; p < packetCount; ++p)
+    castPacket(p);
+}
+
+//////////////////////////////////////////////////
+void Ogre2CpuRayCaster::CastPacket(const Ogre::Vector3 &_origin,
+    const Ogre::Vector3 *_directions, const float *_minDistances,
+    float _maxDistance, size_t _begin, size_t _end, float *_distances,
+    uint32_t *_objects) const
+{
+  const size_t count = _end - _begin;
+  const Ogre::Vector3 *directions = _directions + _begin;
+  const float *minDistances = _minDistances + _begin;
+
+  // rays of the packet as a structure of arrays, so the bounds of an item
+  // are tested against all of them in a loop the compiler vectorizes
+  float invDir[3][kPacketSize];
+  float best[kPacketSize];
+  uint32_t objects[kPacketSize];
+  for (size_t r = 0u; r < count; ++r)
+  {
+    for (unsigned int c = 0u; c < 3u; ++c)
+    {
+      // avoid 0 * inf = NaN in the slab test for axis aligned rays
+      const float dc = std::abs(directions[r][c]) > 1e-30f ?
+          directions[r][c] :
+          (std::signbit(directions[r][c]) ? -1e-30f : 1e-30f);
+      invDir[c][r] = 1.0f / dc;
+    }
+    best[r] = _maxDistance;
+    objects[r] = kNoHit;
+  }
+
+  bool boxHit[kPacketSize];
+  for (size_t i = 0u; i < this->instances.size(); ++i)
+  {
+    const Instance &instance = this->instances[i];
+    const Ogre::Vector3 minPoint = instance.bounds.getMinimum();
+    const Ogre::Vector3 maxPoint = instance.bounds.getMaximum();
+
+    bool anyHit = false;
+    for (size_t r = 0u; r < count; ++r)
+    {
+      float tNear = minDistances[r];
+      float tFar = best[r];
+      for (unsigned int c = 0u; c < 3u; ++c)
+      {
+        const float t0 = (minPoint[c] - _origin[c]) * invDir[c][r];
+        const float t1 = (maxPoint[c] - _origin[c]) * invDir[c][r];
+        tNear = std::max(tNear, std::min(t0, t1));
+        tFar = std::min(tFar, std::max(t0, t1));
+      }
+      boxHit[r] = tNear <= tFar;
+      anyHit |= boxHit[r];
+    }
+    if (!anyHit)
+      continue;
+
+    for (size_t r = 0u; r < count; ++r)
+    {
+      if (!boxHit[r])
+        continue;
+
+      // start the ray at its min distance so that closer hits are ignored.
+      // The mesh space direction is not normalized so that distances along
+      // it are world space distances.
+      const Ogre::Vector3 start =
+          _origin + directions[r] * minDistances[r];
+      const Ogre::Ray meshRay(instance.invTransform * start,
+          instance.invLinear * directions[r]);
+      Ogre::Real distance = best[r] - minDistances[r];
+      if (distance > 0 && instance.bvh->Intersect(meshRay, distance))
+      {
+        best[r] = minDistances[r] + distance;
+        objects[r] = static_cast<uint32_t>(i);
+      }
+    }
+  }
+
+  for (size_t h = 0u; h < this->heightfields.size(); ++h)
+  {
+    for (size_t r = 0u; r < count; ++r)
+    {
+      float distance = best[r];
+      if (IntersectHeightfield(this->heightfields[h], _origin, directions[r],
+          minDistances[r], distance))
+      {
+        best[r] = distance;
+        objects[r] = static_cast<uint32_t>(this->instances.size() + h);
+      }
+    }
+  }
+
+  for (size_t r = 0u; r < count; ++r)
+  {
+    _distances[_begin + r] = objects[r] == kNoHit ?
+        std::numeric_limits<float>::infinity() : best[r];
+    _objects[_begin + r] = objects[r];
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2CpuRayCaster::IntersectHeightfield(const Heightfield &_field,
+    const Ogre::Vector3 &_origin, const Ogre::Vector3 &_direction,
+    float _minDistance, float &_distance)
+{
+  // clip the ray to the bounds of the terrain
+  const Ogre::Vector3 minPoint = _field.bounds.getMinimum();
+  const Ogre::Vector3 maxPoint = _field.bounds.getMaximum();
+  float tNear = _minDistance;
+  float tFar = _distance;
+  for (unsigned int c = 0u; c < 3u; ++c)
+  {
+    if (std::abs(_direction[c]) < 1e-30f)
+    {
+      if (_origin[c] < minPoint[c] || _origin[c] > maxPoint[c])
+        return false;
+      continue;
+    }
+    const float t0 = (minPoint[c] - _origin[c]) / _direction[c];
+    const float t1 = (maxPoint[c] - _origin[c]) / _direction[c];
+    tNear = std::max(tNear, std::min(t0, t1));
+    tFar = std::min(tFar, std::max(t0, t1));
+  }
+  if (tNear > tFar)
+    return false;
+
+  // height of a point of the ray above the terrain, or nothing if the
+  // point is outside of the terrain
+  const unsigned int up = _field.upAxis;
+  auto heightAbove = [&](float _t, float &_height) -> bool
+  {
+    const Ogre::Vector3 point = _origin + _direction * _t;
+    Ogre::Vector3 ground = point;
+    if (!_field.terra->getHeightAt(ground))
+      return false;
+    _height = point[up] - ground[up];
+    return true;
+  };
+
+  const float step = std::max(_field.step,
+      (tFar - tNear) / kMaxHeightfieldSteps);
+
+  // march until the ray goes from above to below the terrain. Rays
+  // starting below it would hit its back faces, which are not rendered.
+  float prevT = tNear;
+  float prevHeight = 0.0f;
+  bool prevValid = heightAbove(prevT, prevHeight);
+  while (prevT < tFar)
+  {
+    const float t = std::min(prevT + step, tFar);
+    float height = 0.0f;
+    const bool valid = heightAbove(t, height);
+    if (valid && prevValid && prevHeight > 0.0f && height <= 0.0f)
+    {
+      float above = prevT;
+      float below = t;
+      for (unsigned int i = 0u; i < kHeightfieldRefineSteps; ++i)
+      {
+        const float mid = 0.5f * (above + below);
+        float midHeight = 0.0f;
+        if (heightAbove(mid, midHeight) && midHeight <= 0.0f)
+          below = mid;
+        else
+          above = mid;
+      }
+      _distance = below;
+      return true;
+    }
+    prevT = t;
+    prevHeight = height;
+    prevValid = valid;
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////
+float Ogre2CpuRayCaster::Retro(uint32_t _object) const
+{
+  if (_object < this->instances.size())
+    return this->instances[_object].retro;
+  return 0.0f;
+}
+
+//////////////////////////////////////////////////
+Ogre::ColourValue Ogre2CpuRayCaster::Color(uint32_t _object) const
+{
+  if (_object < this->instances.size())
+    return this->instances[_object].color;
+  return Ogre::ColourValue::White;
+}
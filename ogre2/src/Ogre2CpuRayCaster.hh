@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2CPURAYCASTER_HH_
+#define GZ_RENDERING_OGRE2_OGRE2CPURAYCASTER_HH_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Node.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+#include "Ogre2MeshBvh.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Math/Simple/OgreAabb.h>
+#include <OgreColourValue.h>
+#include <OgreMatrix3.h>
+#include <OgreMatrix4.h>
+#include <OgreVector3.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace Ogre
+{
+  class Terra;
+}
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Casts rays against the scene on the CPU, used by Ogre2GpuRays
+    /// and Ogre2DepthCamera in place of rasterization when the sensor asks
+    /// for it, see Enabled.
+    ///
+    /// Update takes a snapshot of the visible items and heightmaps of the
+    /// scene. Items are intersected through the triangle hierarchy of their
+    /// mesh (Ogre2MeshBvh) shared with Ogre2RayQuery, so only items created
+    /// from a mesh in common::MeshManager are seen. Heightmaps are ray
+    /// marched on their height data.
+    ///
+    /// Cast splits the rays in packets of neighbouring rays that are spread
+    /// across the worker threads of the scene manager. Every packet tests
+    /// the world bounds of every item against all its rays at once and only
+    /// traverses the hierarchies of the items one of its rays hits.
+    class Ogre2CpuRayCaster
+    {
+      /// \brief Object index reported for rays that hit nothing
+      public: static constexpr uint32_t kNoHit = UINT32_MAX;
+
+      /// \brief Check whether a sensor should cast its rays on the CPU.
+      /// This is the case if the sensor has a "cpu_ray_casting" user data
+      /// set to true, or if it has no such user data and the
+      /// GZ_RENDERING_OGRE2_CPU_RAY_SENSORS environment variable is set.
+      /// \param[in] _sensor Sensor
+      /// \return True to cast rays on the CPU
+      public: static bool Enabled(const Node &_sensor);
+
+      /// \brief Take a snapshot of the objects rays can hit. The scene
+      /// graph must be up to date.
+      /// \param[in] _scene Scene
+      /// \param[in] _visibilityMask Only objects with a visibility flag in
+      /// the mask are hit
+      public: void Update(Ogre2Scene &_scene, uint32_t _visibilityMask);
+
+      /// \brief Cast rays from a common origin against the objects of the
+      /// last Update
+      /// \param[in] _scene Scene whose worker threads run the casts
+      /// \param[in] _origin Origin of the rays, in world space
+      /// \param[in] _directions Normalized direction of every ray, in world
+      /// space
+      /// \param[in] _minDistances Distance along every ray below which hits
+      /// are ignored
+      /// \param[in] _maxDistance Distance along the rays above which hits
+      /// are ignored
+      /// \param[out] _distances Distance to the closest hit of every ray,
+      /// infinity if it hit nothing
+      /// \param[out] _objects Object hit by every ray, kNoHit if it hit
+      /// nothing
+      public: void Cast(Ogre2Scene &_scene, const Ogre::Vector3 &_origin,
+                  const std::vector<Ogre::Vector3> &_directions,
+                  const std::vector<float> &_minDistances, float _maxDistance,
+                  std::vector<float> &_distances,
+                  std::vector<uint32_t> &_objects) const;
+
+      /// \brief Get the laser retro value of an object hit by a ray
+      /// \param[in] _object Object index returned by Cast
+      /// \return Laser retro value, 0 if the object has none
+      public: float Retro(uint32_t _object) const;
+
+      /// \brief Get the color of an object hit by a ray: the diffuse color
+      /// of its first material, unlit
+      /// \param[in] _object Object index returned by Cast
+      /// \return Color of the object
+      public: Ogre::ColourValue Color(uint32_t _object) const;
+
+      /// \brief Item snapshot taken by Update
+      private: struct Instance
+      {
+        /// \brief Inverse of the world transform of the item
+        Ogre::Matrix4 invTransform;
+
+        /// \brief Linear part of invTransform, maps directions to mesh
+        /// space
+        Ogre::Matrix3 invLinear;
+
+        /// \brief World bounds of the item
+        Ogre::Aabb bounds;
+
+        /// \brief Triangle hierarchy of the mesh of the item
+        std::shared_ptr<const Ogre2MeshBvh> bvh;
+
+        /// \brief Laser retro value of the visual owning the item
+        float retro = 0.0f;
+
+        /// \brief Diffuse color of the first material of the item
+        Ogre::ColourValue color = Ogre::ColourValue::White;
+      };
+
+      /// \brief Heightmap snapshot taken by Update
+      private: struct Heightfield
+      {
+        /// \brief Terrain, only its height data is read by the casts
+        const Ogre::Terra *terra = nullptr;
+
+        /// \brief World bounds of the terrain
+        Ogre::Aabb bounds;
+
+        /// \brief Index of the up axis, 1 for y up and 2 for z up
+        unsigned int upAxis = 2u;
+
+        /// \brief Ray marching step, half the size of a terrain cell
+        float step = 1.0f;
+      };
+
+      /// \brief Cast the rays of a packet
+      /// \param[in] _origin Origin of the rays
+      /// \param[in] _directions Directions of the rays
+      /// \param[in] _minDistances Min distances of the rays
+      /// \param[in] _maxDistance Max distance of the rays
+      /// \param[in] _begin First ray of the packet
+      /// \param[in] _end One past the last ray of the packet
+      /// \param[out] _distances Distances of the closest hits
+      /// \param[out] _objects Objects of the closest hits
+      private: void CastPacket(const Ogre::Vector3 &_origin,
+                   const Ogre::Vector3 *_directions,
+                   const float *_minDistances, float _maxDistance,
+                   size_t _begin, size_t _end, float *_distances,
+                   uint32_t *_objects) const;
+
+      /// \brief Find the closest point of a heightfield hit by a ray
+      /// \param[in] _field Heightfield
+      /// \param[in] _origin Origin of the ray
+      /// \param[in] _direction Normalized direction of the ray
+      /// \param[in] _minDistance Hits closer than this are ignored
+      /// \param[in, out] _distance Hits farther than this are ignored. Set
+      /// to the distance to the hit.
+      /// \return True if the heightfield was hit
+      private: static bool IntersectHeightfield(const Heightfield &_field,
+                   const Ogre::Vector3 &_origin,
+                   const Ogre::Vector3 &_direction, float _minDistance,
+                   float &_distance);
+
+      /// \brief Items of the last Update
+      private: std::vector<Instance> instances;
+
+      /// \brief Heightmaps of the last Update. Their object indices follow
+      /// the ones of the items.
+      private: std::vector<Heightfield> heightfields;
+    };
+    }
+  }
+}
+#endif
@@ -23,8 +23,13 @@
   #include <windows.h>
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <math.h>
+#include <memory>
+#include <vector>
 #include <gz/math/Helpers.hh>
 #include <gz/math/Matrix4.hh>
 
@@ -41,7 +46,9 @@
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2Sensor.hh"
 
+#include "Ogre2CpuRayCaster.hh"
 #include "Ogre2GpuReadbackTicket.hh"
+#include "Ogre2MeshLod.hh"
 #include "Ogre2ParticleNoiseListener.hh"
 
 #ifdef _MSC_VER
@@ -102,9 +109,9 @@ class gz::rendering::Ogre2DepthCameraPrivate
   /// \brief Outgoing depth data, used by newDepthFrame event.
   public: float *depthImage = nullptr;
 
-  /// \brief Persistent GPU->CPU readback ticket used by the non-legacy
+  /// \brief Persistent GPU->CPU readback ring used by the non-legacy
   /// PostRender path.
-  public: Ogre2GpuReadbackTicket depthReadback;
+  public: Ogre2GpuReadbackRing depthReadback;
 
   /// \brief maximum value used for data outside sensor range
   public: float dataMaxVal = gz::math::INF_D;
@@ -181,6 +188,31 @@ class gz::rendering::Ogre2DepthCameraPrivate
 
   /// \brief Pointer to the particle target definition in the workspace
   public: Ogre::CompositorTargetDef *particleTargetDef{nullptr};
+
+  /// \brief True if the current frame is cast on the CPU instead of being
+  /// rasterized, see Ogre2CpuRayCaster::Enabled
+  public: bool cpuRayCasting = false;
+
+  /// \brief CPU ray caster, created the first time the camera casts its
+  /// rays on the CPU
+  public: std::unique_ptr<Ogre2CpuRayCaster> cpuRayCaster;
+
+  /// \brief Direction of the ray of every pixel in the camera frame
+  /// (x forward, z up), row by row
+  public: std::vector<Ogre::Vector3> cpuRayDirections;
+
+  /// \brief Direction of the ray of every pixel in world space
+  public: std::vector<Ogre::Vector3> cpuWorldDirections;
+
+  /// \brief Min distance of every ray, zero so that geometry closer than
+  /// the near plane is hit as it is by the rasterized camera
+  public: std::vector<float> cpuMinDistances;
+
+  /// \brief Distance to the closest hit of every ray
+  public: std::vector<float> cpuDistances;
+
+  /// \brief Object hit by every ray
+  public: std::vector<uint32_t> cpuObjects;
 };
 
 using namespace gz;
@@ -1040,6 +1072,12 @@ void Ogre2DepthCamera::SetProjectionMatrix(const math::Matrix4d &_matrix)
 void Ogre2DepthCamera::Render()
 {
   GZ_PROFILE("Ogre2DepthCamera::Render");
+  if (this->dataPtr->cpuRayCasting)
+  {
+    this->RenderCpu();
+    return;
+  }
+
   // Our shaders rely on clamped values so enable it for this sensor
   //
   // TODO(anyone): Matias N. Goldberg (dark_sylinc) insists this is a hack
@@ -1048,6 +1086,7 @@ void Ogre2DepthCamera::Render()
   const bool bOldDepthClamp = this->ogreCamera->getNeedsDepthClamp();
   this->ogreCamera->_setNeedsDepthClamp(true);
 
+  Ogre2MeshLod::UpdateCamera(*this, this->ogreCamera, this->ImageHeight());
   this->scene->StartRendering(this->ogreCamera);
 
   // update the compositors
@@ -1069,6 +1108,14 @@ void Ogre2DepthCamera::Render()
 void Ogre2DepthCamera::PreRender()
 {
   GZ_PROFILE("Ogre2DepthCamera::PreRender");
+  this->dataPtr->cpuRayCasting = Ogre2CpuRayCaster::Enabled(*this);
+  if (this->dataPtr->cpuRayCasting)
+  {
+    if (this->dataPtr->cpuRayDirections.empty())
+      this->CreateCpuRays();
+    return;
+  }
+
   if (!this->dataPtr->ogreDepthTexture[0])
     this->CreateDepthTexture();
 
@@ -1206,7 +1253,19 @@ void Ogre2DepthCamera::PostRender()
   if (!this->dataPtr->depthImage)
     this->dataPtr->depthImage = new float[len * channelCount];
 
-  if (Ogre2UseLegacyReadback())
+  // publish into the subscriber supplied buffer if there is one
+  float *depthImage = static_cast<float *>(
+      this->OutputBuffer(len * sizeof(float)));
+  if (!depthImage)
+    depthImage = this->dataPtr->depthImage;
+
+  if (this->dataPtr->cpuRayCasting)
+  {
+    this->FillCpuBuffers(depthImage);
+    this->PublishFrameView(this->dataPtr->depthBuffer, width, height,
+        width * channelCount * bytesPerChannel, format);
+  }
+  else if (Ogre2UseLegacyReadback())
   {
     // Legacy A/B control: original Ogre::Image2 path, kept verbatim.
     Ogre::Image2 image;
@@ -1232,30 +1291,35 @@ void Ogre2DepthCamera::PostRender()
       for (unsigned int j = 0; j < width; ++j)
       {
         float x = this->dataPtr->depthBuffer[step + j*channelCount];
-        this->dataPtr->depthImage[i*width + j] = x;
+        depthImage[i*width + j] = x;
       }
     }
   }
   else
   {
     // Persistent-ticket path: map the staging buffer once and copy straight
-    // into the persistent buffers in a single fused pass.
+    // into the persistent buffers in a single fused pass. With a readback
+    // latency the mapped data belongs to an earlier frame.
+    this->dataPtr->depthReadback.SetLatency(this->ReadbackLatency());
     Ogre::TextureBox box = this->dataPtr->depthReadback.DownloadAndMap(
         this->dataPtr->ogreDepthTexture[1]);
     if (!box.data)
     {
-      gzerr << "Ogre2DepthCamera: GPU readback failed; dropping frame"
-            << std::endl;
+      if (!this->dataPtr->depthReadback.Filling())
+      {
+        gzerr << "Ogre2DepthCamera: GPU readback failed; dropping frame"
+              << std::endl;
+      }
       return;
     }
-    FillDepthBuffers(box, this->dataPtr->depthBuffer,
-        this->dataPtr->depthImage, width, height, channelCount,
-        bytesPerChannel);
+    this->PublishFrameView(box.data, width, height, box.bytesPerRow,
+        format);
+    FillDepthBuffers(box, this->dataPtr->depthBuffer, depthImage, width,
+        height, channelCount, bytesPerChannel);
     this->dataPtr->depthReadback.Unmap();
   }
 
-  this->dataPtr->newDepthFrame(
-        this->dataPtr->depthImage, width, height, 1, "FLOAT32");
+  this->dataPtr->newDepthFrame(depthImage, width, height, 1, "FLOAT32");
 
   // point cloud data
   if (this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u)
@@ -1266,6 +1330,149 @@ void Ogre2DepthCamera::PostRender()
   }
 }
 
+/////////////////////////////////////////////////
+void Ogre2DepthCamera::CreateCpuRays()
+{
+  // same projection as CreateDepthTexture
+  const double aspectRatio = this->AspectRatio();
+  const double angle = this->HFOV().Radian();
+  const double vfov =
+    this->LimitFOV(2.0 * atan(tan(angle / 2.0) / aspectRatio));
+  this->ogreCamera->setFOVy(Ogre::Radian((Ogre::Real)vfov));
+  this->ogreCamera->setAspectRatio((Ogre::Real)aspectRatio);
+
+  // unproject the center of every pixel, which also honors a custom
+  // projection matrix
+  const Ogre::Matrix4 invProjection =
+      this->ogreCamera->getProjectionMatrix().inverse();
+  const unsigned int width = this->ImageWidth();
+  const unsigned int height = this->ImageHeight();
+
+  // the rasterized camera clamps the depth of geometry closer than the near
+  // plane, which FillCpuBuffers reports as the min value. Rays are cast from
+  // the camera so that they hit that geometry too rather than seeing
+  // through it.
+  this->dataPtr->cpuRayDirections.resize(
+      static_cast<size_t>(width) * height);
+  this->dataPtr->cpuMinDistances.assign(
+      this->dataPtr->cpuRayDirections.size(), 0.0f);
+  for (unsigned int i = 0; i < height; ++i)
+  {
+    const Ogre::Real y = 1 - 2 * (i + Ogre::Real(0.5)) / height;
+    for (unsigned int j = 0; j < width; ++j)
+    {
+      const Ogre::Real x = 2 * (j + Ogre::Real(0.5)) / width - 1;
+      const Ogre::Vector3 viewPos = invProjection * Ogre::Vector3(x, y, -1);
+
+      // convert to z up, as depth_camera_fs does
+      const Ogre::Vector3 dir = Ogre::Vector3(
+          -viewPos.z, -viewPos.x, viewPos.y).normalisedCopy();
+      const size_t index = static_cast<size_t>(i) * width + j;
+      this->dataPtr->cpuRayDirections[index] = dir;
+    }
+  }
+
+  if (!this->dataPtr->cpuRayCaster)
+    this->dataPtr->cpuRayCaster = std::make_unique<Ogre2CpuRayCaster>();
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::RenderCpu()
+{
+  GZ_PROFILE("Ogre2DepthCamera::RenderCpu");
+  this->scene->StartRendering(nullptr);
+
+  const Ogre::Vector3 origin =
+      Ogre2Conversions::Convert(this->WorldPosition());
+  const Ogre::Quaternion rotation =
+      Ogre2Conversions::Convert(this->WorldRotation());
+  auto &worldDirections = this->dataPtr->cpuWorldDirections;
+  worldDirections.resize(this->dataPtr->cpuRayDirections.size());
+  for (size_t i = 0u; i < worldDirections.size(); ++i)
+    worldDirections[i] = rotation * this->dataPtr->cpuRayDirections[i];
+
+  this->dataPtr->cpuRayCaster->Update(*this->scene,
+    this->VisibilityMask() & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
+  this->dataPtr->cpuRayCaster->Cast(*this->scene, origin, worldDirections,
+      this->dataPtr->cpuMinDistances,
+      static_cast<float>(this->FarClipPlane()),
+      this->dataPtr->cpuDistances, this->dataPtr->cpuObjects);
+
+  // nothing was drawn but the frame still has to be ended
+  this->scene->FlushGpuCommandsAndStartNewFrame(0u, false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::FillCpuBuffers(float *_depthImage) const
+{
+  const float tolerance = 1e-6f;
+  const float nearPlane = static_cast<float>(this->NearClipPlane());
+  const float farPlane = static_cast<float>(this->FarClipPlane());
+  const float maxVal = this->dataPtr->dataMaxVal;
+  const float minVal = this->dataPtr->dataMinVal;
+  const math::Color &background = this->Scene()->BackgroundColor();
+  const Ogre::ColourValue backgroundColor(
+      background.R(), background.G(), background.B());
+
+  // packs a color as depth_camera_fs does
+  auto packColor = [](Ogre::ColourValue _color) -> float
+  {
+    auto toSRGB = [](float _x) -> float
+    {
+      return _x < 0.0031308f ? _x * 12.92f :
+          1.055f * std::pow(_x, 0.41666f) - 0.055f;
+    };
+    auto toByte = [](float _x) -> uint32_t
+    {
+      return static_cast<uint32_t>(
+          std::round(std::clamp(_x, 0.0f, 1.0f) * 255.0f));
+    };
+    const uint32_t rgba = (toByte(toSRGB(_color.r)) << 24u) +
+        (toByte(toSRGB(_color.g)) << 16u) +
+        (toByte(toSRGB(_color.b)) << 8u) + toByte(_color.a);
+    float packed;
+    std::memcpy(&packed, &rgba, sizeof(packed));
+    return packed;
+  };
+  const float backgroundPacked = packColor(backgroundColor);
+
+  for (size_t i = 0u; i < this->dataPtr->cpuDistances.size(); ++i)
+  {
+    const float distance = this->dataPtr->cpuDistances[i];
+    const uint32_t object = this->dataPtr->cpuObjects[i];
+    Ogre::Vector3 point = this->dataPtr->cpuRayDirections[i] *
+        (object == Ogre2CpuRayCaster::kNoHit ? farPlane : distance);
+    float color = backgroundPacked;
+
+    // same clamping as depth_camera_fs
+    if (point.length() > farPlane - tolerance)
+    {
+      if (std::isinf(maxVal))
+        point = Ogre::Vector3(maxVal);
+      else
+        point.x = maxVal;
+    }
+    else if (point.x < nearPlane + tolerance)
+    {
+      if (std::isinf(minVal))
+        point = Ogre::Vector3(minVal);
+      else
+        point.x = minVal;
+    }
+    else
+    {
+      color = packColor(this->dataPtr->cpuRayCaster->Color(object));
+    }
+
+    float *pixel = this->dataPtr->depthBuffer + i * 4u;
+    pixel[0] = point.x;
+    pixel[1] = point.y;
+    pixel[2] = point.z;
+    pixel[3] = color;
+    _depthImage[i] = point.x;
+  }
+}
+
 //////////////////////////////////////////////////
 const float *Ogre2DepthCamera::DepthData() const
 {
@@ -26,6 +26,12 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include "gz/common/Console.hh"
 #include <gz/common/Profiler.hh>
 
@@ -44,6 +50,7 @@
 #include <OgreSceneManager.h>
 #include <OgreSubMesh2.h>
 #include <Vao/OgreVaoManager.h>
+#include <Vao/OgreVertexArrayObject.h>
 #ifdef _MSC_VER
   #pragma warning(pop)
 #endif
@@ -51,15 +58,55 @@
 /// \brief Private implementation
 class gz::rendering::Ogre2DynamicRenderablePrivate
 {
+  /// \brief Mark a range of vertices as changed since the last update
+  /// \param[in] _begin First changed vertex
+  /// \param[in] _end One past the last changed vertex
+  public: void MarkDirty(size_t _begin, size_t _end);
+
+  /// \brief Mark all the vertices as changed since the last update
+  public: void MarkAllDirty();
+
   /// \brief list of colors at each point
   public: std::vector<gz::math::Color> colors;
 
-  /// \brief List of vertices for the mesh
-  public: std::vector<gz::math::Vector3d> vertices;
+  /// \brief Vertex data laid out as in the vertex buffer, 6 floats per
+  /// vertex: the position followed by the normal, or the color for points.
+  /// Holds at least one vertex, so an empty renderable draws a single
+  /// vertex at the origin.
+  public: std::vector<float> vbuffer;
+
+  /// \brief Number of points
+  public: size_t vertexCount = 0u;
 
   /// \brief Used to indicate if the lines require an update
   public: bool dirty = false;
 
+  /// \brief First vertex changed since the last update
+  public: size_t dirtyBegin = std::numeric_limits<size_t>::max();
+
+  /// \brief One past the last vertex changed since the last update
+  public: size_t dirtyEnd = 0u;
+
+  /// \brief True if the bounds need to be recomputed from all the vertices
+  /// on the next update, instead of grown to include the changed ones
+  public: bool resetBounds = true;
+
+  /// \brief True if the vao must be recreated on the next update, e.g.
+  /// because the render operation type changed
+  public: bool rebuildVao = false;
+
+  /// \brief Ogre keeps one copy of a dynamic vertex buffer per frame in
+  /// flight and every map writes to the next copy. This holds, per copy,
+  /// the range of vertices changed since that copy was last written, so
+  /// each map only uploads what that copy is missing.
+  public: std::vector<std::pair<size_t, size_t>> copyDirtyRanges;
+
+  /// \brief Index of the copy written by the last map
+  public: size_t currentCopy = 0u;
+
+  /// \brief Bounds of the vertices
+  public: Ogre::Aabb bounds;
+
   /// \brief Render operation type
   public: Ogre::OperationType operationType;
 
@@ -75,9 +122,6 @@ class gz::rendering::Ogre2DynamicRenderablePrivate
   /// \brief Ogre item created from the dynamic geometry
   public: Ogre::Item *ogreItem = nullptr;
 
-  /// \brief raw vertex buffer
-  public: float *vbuffer = nullptr;
-
   /// \brief Maximum capacity of the currently allocated vertex buffer.
   public: size_t vertexBufferCapacity = 0;
 
@@ -95,6 +139,22 @@ class gz::rendering::Ogre2DynamicRenderablePrivate
   public: Ogre::SceneManager *sceneManager = nullptr;
 };
 
+//////////////////////////////////////////////////
+void gz::rendering::Ogre2DynamicRenderablePrivate::MarkDirty(size_t _begin,
+    size_t _end)
+{
+  this->dirtyBegin = std::min(this->dirtyBegin, _begin);
+  this->dirtyEnd = std::max(this->dirtyEnd, _end);
+  this->dirty = true;
+}
+
+//////////////////////////////////////////////////
+void gz::rendering::Ogre2DynamicRenderablePrivate::MarkAllDirty()
+{
+  this->MarkDirty(0u, std::numeric_limits<size_t>::max());
+  this->resetBounds = true;
+}
+
 
 using namespace gz;
 using namespace rendering;
@@ -154,9 +214,6 @@ void Ogre2DynamicRenderable::Destroy()
 //////////////////////////////////////////////////
 void Ogre2DynamicRenderable::DestroyBuffer()
 {
-  if (this->dataPtr->vbuffer)
-    delete [] this->dataPtr->vbuffer;
-
   Ogre::RenderSystem *renderSystem =
       this->dataPtr->sceneManager->getDestinationRenderSystem();
   Ogre::VaoManager *vaoManager = renderSystem->getVaoManager();
@@ -177,7 +234,6 @@ void Ogre2DynamicRenderable::DestroyBuffer()
 
   this->dataPtr->vertexBuffer = nullptr;
   this->dataPtr->vao = nullptr;
-  this->dataPtr->vbuffer = nullptr;
 }
 
 //////////////////////////////////////////////////
@@ -203,7 +259,7 @@ void Ogre2DynamicRenderable::CreateDynamicMesh()
               "dynamic_renderable_" + std::to_string(dynamicRenderableId++),
               Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
   this->dataPtr->subMesh = mesh->createSubMesh();
-  this->dataPtr->dirty = true;
+  this->dataPtr->MarkAllDirty();
 
   // this creates the ogre2 dynamic geometry buffer
   this->UpdateBuffer();
@@ -227,9 +283,9 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     return;
 
   // Prepare vertex buffer
-  unsigned int newVertCapacity = this->dataPtr->vertexBufferCapacity;
+  size_t newVertCapacity = this->dataPtr->vertexBufferCapacity;
 
-  unsigned int vertexCount = this->dataPtr->vertices.size();
+  const size_t vertexCount = this->dataPtr->vertexCount;
   if ((vertexCount > this->dataPtr->vertexBufferCapacity) ||
       (!this->dataPtr->vertexBufferCapacity))
   {
@@ -247,7 +303,7 @@ void Ogre2DynamicRenderable::UpdateBuffer()
   else if (vertexCount < this->dataPtr->vertexBufferCapacity>>1)
   {
     // Make capacity the previous power of two
-    unsigned int newCapacity = newVertCapacity >>1;
+    size_t newCapacity = newVertCapacity >>1;
     while (vertexCount < newCapacity)
     {
       newVertCapacity = newCapacity;
@@ -255,17 +311,21 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     }
   }
 
+  // an empty renderable still draws one vertex
+  const size_t drawCount = std::max<size_t>(vertexCount, 1u);
+  if (this->dataPtr->vbuffer.size() < drawCount * 6)
+    this->dataPtr->vbuffer.resize(drawCount * 6, 0.0f);
+
   // recreate vao if needed
-  if (newVertCapacity != this->dataPtr->vertexBufferCapacity)
+  const bool recreateVao = this->dataPtr->rebuildVao ||
+      newVertCapacity != this->dataPtr->vertexBufferCapacity;
+  if (recreateVao)
   {
     this->dataPtr->vertexBufferCapacity = newVertCapacity;
+    this->dataPtr->rebuildVao = false;
 
     this->DestroyBuffer();
 
-    unsigned int size = this->dataPtr->vertexBufferCapacity * 6;
-    this->dataPtr->vbuffer = new float[size];
-    memset(this->dataPtr->vbuffer, 0, size * sizeof(float));
-
     this->dataPtr->subMesh->mVao[Ogre::VpNormal].clear();
     this->dataPtr->subMesh->mVao[Ogre::VpShadow].clear();
 
@@ -276,10 +336,10 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     vertexElements.push_back(
         Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_NORMAL));
 
-    // create vertex buffer
+    // create vertex buffer, every copy is filled by the maps below
     this->dataPtr->vertexBuffer = vaoManager->createVertexBuffer(
         vertexElements, this->dataPtr->vertexBufferCapacity,
-        Ogre::BT_DYNAMIC_PERSISTENT, this->dataPtr->vbuffer, false);
+        Ogre::BT_DYNAMIC_PERSISTENT, nullptr, false);
 
     Ogre::VertexBufferPackedVec vertexBuffers;
     vertexBuffers.push_back(this->dataPtr->vertexBuffer);
@@ -293,62 +353,76 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     this->dataPtr->subMesh->mVao[Ogre::VpNormal].push_back(this->dataPtr->vao);
     // Use the same geometry for shadow casting.
     this->dataPtr->subMesh->mVao[Ogre::VpShadow].push_back(this->dataPtr->vao);
-  }
 
-  // map buffer and update the geometry
-  Ogre::Aabb bbox;
-  float * RESTRICT_ALIAS vertices = reinterpret_cast<float * RESTRICT_ALIAS>(
-      this->dataPtr->vertexBuffer->map(
-      0, this->dataPtr->vertexBuffer->getNumElements()));
-
-  // fill vertices
-  for (unsigned int i = 0; i < vertexCount; ++i)
-  {
-    unsigned int idx = i*6;
-    Ogre::Vector3 v = Ogre2Conversions::Convert(this->dataPtr->vertices[i]);
-    vertices[idx] = v.x;
-    vertices[idx+1] = v.y;
-    vertices[idx+2] = v.z;
-
-    bbox.merge(v);
+    this->dataPtr->copyDirtyRanges.assign(
+        vaoManager->getDynamicBufferMultiplier(),
+        {0u, std::numeric_limits<size_t>::max()});
+    this->dataPtr->currentCopy = 0u;
   }
 
-  // fill the rest of the buffer with the position of the last vertex to avoid
-  // the geometry connecting back to 0, 0, 0
-  if (vertexCount > 0 && vertexCount < this->dataPtr->vertexBufferCapacity)
+  // regenerate the normals or colors of the changed vertices
+  size_t begin = std::min(this->dataPtr->dirtyBegin, drawCount);
+  size_t end = std::min(this->dataPtr->dirtyEnd, drawCount);
+  if (begin < end)
   {
-    math::Vector3d lastVertex = this->dataPtr->vertices[vertexCount-1];
-    for (unsigned int i = vertexCount; i < this->dataPtr->vertexBufferCapacity;
-        ++i)
+    this->GenerateNormals(this->dataPtr->operationType, begin, end);
+    this->GenerateColors(this->dataPtr->operationType, begin, end);
+
+    for (auto &range : this->dataPtr->copyDirtyRanges)
     {
-      unsigned int idx = i * 6;
-      vertices[idx] = lastVertex.X();
-      vertices[idx+1] = lastVertex.Y();
-      vertices[idx+2] = lastVertex.Z();
-
-      vertices[idx+3] = 0;
-      vertices[idx+4] = 0;
-      vertices[idx+5] = 1;
+      range.first = std::min(range.first, begin);
+      range.second = std::max(range.second, end);
     }
   }
 
-  // fill normals
-  this->GenerateNormals(this->dataPtr->operationType, this->dataPtr->vertices,
-      vertices);
+  // Bounds only grow when a few vertices change, they are recomputed
+  // when all the vertices are replaced
+  const float *vbuffer = this->dataPtr->vbuffer.data();
+  if (this->dataPtr->resetBounds)
+  {
+    this->dataPtr->bounds = Ogre::Aabb();
+    begin = 0u;
+    end = vertexCount;
+    this->dataPtr->resetBounds = false;
+  }
+  for (size_t i = begin; i < std::min(end, vertexCount); ++i)
+  {
+    this->dataPtr->bounds.merge(
+        Ogre::Vector3(vbuffer[i*6], vbuffer[i*6+1], vbuffer[i*6+2]));
+  }
 
-  // fill colors for points
-  this->GenerateColors(this->dataPtr->operationType, this->dataPtr->vertices,
-      vertices);
+  // upload what the next copy of the vertex buffer is missing
+  const size_t nextCopy = (this->dataPtr->currentCopy + 1u) %
+      this->dataPtr->copyDirtyRanges.size();
+  auto &range = this->dataPtr->copyDirtyRanges[nextCopy];
+  const size_t uploadBegin = std::min(range.first, drawCount);
+  const size_t uploadEnd = std::min(range.second, drawCount);
+  if (uploadBegin < uploadEnd)
+  {
+    float * RESTRICT_ALIAS vertices = reinterpret_cast<float * RESTRICT_ALIAS>(
+        this->dataPtr->vertexBuffer->map(uploadBegin, uploadEnd - uploadBegin));
+    memcpy(vertices, vbuffer + uploadBegin * 6,
+        (uploadEnd - uploadBegin) * 6 * sizeof(float));
+    this->dataPtr->vertexBuffer->unmap(Ogre::UO_KEEP_PERSISTENT);
+
+    range = {std::numeric_limits<size_t>::max(), 0u};
+    this->dataPtr->currentCopy = nextCopy;
+  }
 
-  // unmap buffer
-  this->dataPtr->vertexBuffer->unmap(Ogre::UO_KEEP_PERSISTENT);
+  // only draw the vertices in use
+  this->dataPtr->vao->setPrimitiveRange(0u,
+      static_cast<uint32_t>(drawCount));
 
   // Set the bounds to get frustum culling and LOD to work correctly.
   Ogre::Mesh *mesh = this->dataPtr->subMesh->mParent;
-  mesh->_setBounds(bbox, true);
+  mesh->_setBounds(this->dataPtr->bounds, true);
 
   // update item aabb
-  if (this->dataPtr->ogreItem)
+  if (this->dataPtr->ogreItem && !recreateVao)
+  {
+    this->dataPtr->ogreItem->setLocalAabb(mesh->getAabb());
+  }
+  else if (this->dataPtr->ogreItem)
   {
     bool castShadows = this->dataPtr->ogreItem->getCastShadows();
     auto lowLevelMat = this->dataPtr->ogreItem->getSubItem(0)->getMaterial();
@@ -376,12 +450,15 @@ void Ogre2DynamicRenderable::UpdateBuffer()
     }
   }
 
+  this->dataPtr->dirtyBegin = std::numeric_limits<size_t>::max();
+  this->dataPtr->dirtyEnd = 0u;
   this->dataPtr->dirty = false;
 }
 
 //////////////////////////////////////////////////
 void Ogre2DynamicRenderable::SetOperationType(MarkerType _opType)
 {
+  const Ogre::OperationType prevOperationType = this->dataPtr->operationType;
   switch (_opType)
   {
     case MT_POINTS:
@@ -412,6 +489,15 @@ void Ogre2DynamicRenderable::SetOperationType(MarkerType _opType)
       gzerr << "Unknown render operation type[" << _opType << "]\n";
       return;
   }
+
+  // the vao is created for one operation type and the normal slots of the
+  // vertices hold normals or colors depending on it
+  if (this->dataPtr->vao &&
+      this->dataPtr->operationType != prevOperationType)
+  {
+    this->dataPtr->rebuildVao = true;
+    this->dataPtr->MarkAllDirty();
+  }
 }
 
 //////////////////////////////////////////////////
@@ -453,7 +539,14 @@ MarkerType Ogre2DynamicRenderable::OperationType() const
 void Ogre2DynamicRenderable::AddPoint(const math::Vector3d &_pt,
                                       const math::Color &_color)
 {
-  this->dataPtr->vertices.push_back(_pt);
+  const size_t index = this->dataPtr->vertexCount++;
+  if (this->dataPtr->vbuffer.size() < (index + 1) * 6)
+    this->dataPtr->vbuffer.resize((index + 1) * 6, 0.0f);
+
+  float *vertex = this->dataPtr->vbuffer.data() + index * 6;
+  vertex[0] = static_cast<float>(_pt.X());
+  vertex[1] = static_cast<float>(_pt.Y());
+  vertex[2] = static_cast<float>(_pt.Z());
 
   // todo(anyone)
   // setting material works but vertex coloring only works for points
@@ -461,7 +554,7 @@ void Ogre2DynamicRenderable::AddPoint(const math::Vector3d &_pt,
   // https://forums.ogre3d.org/viewtopic.php?t=93627#p539276
   this->dataPtr->colors.push_back(_color);
 
-  this->dataPtr->dirty = true;
+  this->dataPtr->MarkDirty(index, index + 1);
 }
 
 /////////////////////////////////////////////////
@@ -475,16 +568,76 @@ void Ogre2DynamicRenderable::AddPoint(double _x, double _y, double _z,
 void Ogre2DynamicRenderable::SetPoint(unsigned int _index,
                                       const math::Vector3d &_value)
 {
-  if (_index >= this->dataPtr->vertices.size())
+  if (_index >= this->dataPtr->vertexCount)
   {
     gzerr << "Point index[" << _index << "] is out of bounds[0-"
-           << this->dataPtr->vertices.size()-1 << "]\n";
+           << static_cast<int64_t>(this->dataPtr->vertexCount) - 1 << "]\n";
     return;
   }
 
-  this->dataPtr->vertices[_index] = _value;
+  float *vertex = this->dataPtr->vbuffer.data() + _index * 6;
+  vertex[0] = static_cast<float>(_value.X());
+  vertex[1] = static_cast<float>(_value.Y());
+  vertex[2] = static_cast<float>(_value.Z());
+
+  this->dataPtr->MarkDirty(_index, _index + 1);
+}
+
+/////////////////////////////////////////////////
+void Ogre2DynamicRenderable::SetPoints(const float *_points, size_t _count,
+                                       const math::Color &_color)
+{
+  GZ_PROFILE("Ogre2DynamicRenderable::SetPoints");
+  const size_t prevCount = this->dataPtr->vertexCount;
+  if (this->dataPtr->vbuffer.size() < _count * 6)
+    this->dataPtr->vbuffer.resize(_count * 6, 0.0f);
+
+  // only the points that changed are marked dirty, so a path that grows
+  // by a few points every frame only uploads the new ones
+  size_t changedBegin = std::numeric_limits<size_t>::max();
+  size_t changedEnd = 0u;
+  float *vbuffer = this->dataPtr->vbuffer.data();
+  const size_t common = std::min(prevCount, _count);
+  for (size_t i = 0; i < common; ++i)
+  {
+    const float *point = _points + i * 3;
+    float *vertex = vbuffer + i * 6;
+    if (vertex[0] != point[0] || vertex[1] != point[1] ||
+        vertex[2] != point[2] || this->dataPtr->colors[i] != _color)
+    {
+      vertex[0] = point[0];
+      vertex[1] = point[1];
+      vertex[2] = point[2];
+      this->dataPtr->colors[i] = _color;
+      changedBegin = std::min(changedBegin, i);
+      changedEnd = i + 1;
+    }
+  }
+
+  for (size_t i = common; i < _count; ++i)
+  {
+    vbuffer[i * 6] = _points[i * 3];
+    vbuffer[i * 6 + 1] = _points[i * 3 + 1];
+    vbuffer[i * 6 + 2] = _points[i * 3 + 2];
+  }
+  this->dataPtr->colors.resize(_count, _color);
+  this->dataPtr->vertexCount = _count;
+
+  if (_count > common)
+  {
+    changedBegin = std::min(changedBegin, common);
+    changedEnd = _count;
+  }
 
-  this->dataPtr->dirty = true;
+  if (changedBegin < changedEnd)
+    this->dataPtr->MarkDirty(changedBegin, changedEnd);
+
+  // removed points only change the number of vertices drawn
+  if (_count < prevCount)
+  {
+    this->dataPtr->resetBounds = true;
+    this->dataPtr->dirty = true;
+  }
 }
 
 /////////////////////////////////////////////////
@@ -494,7 +647,7 @@ void Ogre2DynamicRenderable::SetColor(unsigned int _index,
   if (_index >= this->dataPtr->colors.size())
   {
     gzerr << "Point color index[" << _index << "] is out of bounds[0-"
-           << this->dataPtr->colors.size()-1 << "]\n";
+           << static_cast<int64_t>(this->dataPtr->colors.size()) - 1 << "]\n";
     return;
   }
 
@@ -505,41 +658,47 @@ void Ogre2DynamicRenderable::SetColor(unsigned int _index,
   // https://forums.ogre3d.org/viewtopic.php?t=93627#p539276
   this->dataPtr->colors[_index] = _color;
 
-  this->dataPtr->dirty = true;
+  this->dataPtr->MarkDirty(_index, _index + 1);
 }
 
 /////////////////////////////////////////////////
 math::Vector3d Ogre2DynamicRenderable::Point(
     const unsigned int _index) const
 {
-  if (_index >= this->dataPtr->vertices.size())
+  if (_index >= this->dataPtr->vertexCount)
   {
     gzerr << "Point index[" << _index << "] is out of bounds[0-"
-           << this->dataPtr->vertices.size()-1 << "]\n";
+           << static_cast<int64_t>(this->dataPtr->vertexCount) - 1 << "]\n";
 
     return math::Vector3d(math::INF_D,
                                     math::INF_D,
                                     math::INF_D);
   }
 
-  return this->dataPtr->vertices[_index];
+  const float *vertex = this->dataPtr->vbuffer.data() + _index * 6;
+  return math::Vector3d(vertex[0], vertex[1], vertex[2]);
 }
 
 /////////////////////////////////////////////////
 unsigned int Ogre2DynamicRenderable::PointCount() const
 {
-  return this->dataPtr->vertices.size();
+  return static_cast<unsigned int>(this->dataPtr->vertexCount);
 }
 
 /////////////////////////////////////////////////
 void Ogre2DynamicRenderable::Clear()
 {
-  if (this->dataPtr->vertices.empty() && this->dataPtr->colors.empty())
+  if (this->dataPtr->vertexCount == 0u && this->dataPtr->colors.empty())
     return;
 
-  this->dataPtr->vertices.clear();
+  this->dataPtr->vertexCount = 0u;
   this->dataPtr->colors.clear();
-  this->dataPtr->dirty = true;
+
+  // the single vertex drawn while empty sits at the origin
+  if (this->dataPtr->vbuffer.size() >= 6u)
+    std::fill(this->dataPtr->vbuffer.begin(),
+        this->dataPtr->vbuffer.begin() + 6, 0.0f);
+  this->dataPtr->MarkAllDirty();
 }
 
 //////////////////////////////////////////////////
@@ -574,10 +733,11 @@ void Ogre2DynamicRenderable::SetMaterial(MaterialPtr _material, bool _unique)
 
 //////////////////////////////////////////////////
 void Ogre2DynamicRenderable::GenerateNormals(Ogre::OperationType _opType,
-  const std::vector<math::Vector3d> &_vertices, float *_vbuffer)
+  size_t &_begin, size_t &_end)
 {
   GZ_PROFILE("Ogre2DynamicRenderable::GenerateNormals");
-  unsigned int vertexCount = _vertices.size();
+  const size_t vertexCount = this->dataPtr->vertexCount;
+  float *_vbuffer = this->dataPtr->vbuffer.data();
   // Each vertex occupies 6 elements in the vbuffer float array:
   // vbuffer[i]   : position x
   // vbuffer[i+1] : position y
@@ -585,26 +745,45 @@ void Ogre2DynamicRenderable::GenerateNormals(Ogre::OperationType _opType,
   // vbuffer[i+3] : normal x
   // vbuffer[i+4] : normal y
   // vbuffer[i+5] : normal z
+  auto vertex = [&](size_t _index)
+  {
+    return math::Vector3d(_vbuffer[_index * 6], _vbuffer[_index * 6 + 1],
+        _vbuffer[_index * 6 + 2]);
+  };
+  auto clearNormals = [&](size_t _from, size_t _to)
+  {
+    for (size_t i = _from; i < _to; ++i)
+    {
+      _vbuffer[i * 6 + 3] = 0.0f;
+      _vbuffer[i * 6 + 4] = 0.0f;
+      _vbuffer[i * 6 + 5] = 0.0f;
+    }
+  };
+
   switch (_opType)
   {
     case Ogre::OperationType::OT_POINT_LIST:
+      return;
     case Ogre::OperationType::OT_LINE_LIST:
     case Ogre::OperationType::OT_LINE_STRIP:
+      clearNormals(_begin, _end);
       return;
     case Ogre::OperationType::OT_TRIANGLE_LIST:
     {
-      if (vertexCount < 3)
-        return;
+      // only the triangles holding the changed vertices are affected
+      _begin = _begin / 3 * 3;
+      _end = std::max(_end, std::min((_end + 2) / 3 * 3, vertexCount));
+      clearNormals(_begin, _end);
 
-      for (unsigned int i = 0; i < vertexCount / 3; ++i)
+      const size_t end = std::min(_end, vertexCount);
+      for (size_t idx = _begin; idx + 3 <= end; idx += 3)
       {
-        unsigned int idx = i*3;
-        unsigned int idx1 = idx * 6;
-        unsigned int idx2 = idx1 + 6;
-        unsigned int idx3 = idx2 + 6;
-        math::Vector3d v1 = _vertices[idx];
-        math::Vector3d v2 = _vertices[idx+1];
-        math::Vector3d v3 = _vertices[idx+2];
+        size_t idx1 = idx * 6;
+        size_t idx2 = idx1 + 6;
+        size_t idx3 = idx2 + 6;
+        math::Vector3d v1 = vertex(idx);
+        math::Vector3d v2 = vertex(idx+1);
+        math::Vector3d v3 = vertex(idx+2);
         math::Vector3d n = (v1 - v2).Cross((v1 - v3));
 
         _vbuffer[idx1+3] = n.X();
@@ -622,32 +801,36 @@ void Ogre2DynamicRenderable::GenerateNormals(Ogre::OperationType _opType,
     }
     case Ogre::OperationType::OT_TRIANGLE_STRIP:
     {
+      // normals are averaged along the whole strip
+      _begin = 0u;
+      _end = std::max<size_t>(vertexCount, 1u);
+      clearNormals(_begin, _end);
       if (vertexCount < 3)
         return;
 
       bool even = false;
-      for (unsigned int i = 0; i < vertexCount - 2; ++i)
+      for (size_t i = 0; i < vertexCount - 2; ++i)
       {
         math::Vector3d v1;
         math::Vector3d v2;
-        math::Vector3d v3 = _vertices[i+2];
+        math::Vector3d v3 = vertex(i+2);
 
         // For odd n, vertices n, n+1, and n+2 define triangle n.
         // For even n, vertices n+1, n, and n+2 define triangle n.
-        unsigned int idx1;
-        unsigned int idx2;
-        unsigned int idx3 = (i+2) * 6;
+        size_t idx1;
+        size_t idx2;
+        size_t idx3 = (i+2) * 6;
         if (even)
         {
-          v1 = _vertices[i+1];
-          v2 = _vertices[i];
+          v1 = vertex(i+1);
+          v2 = vertex(i);
           idx1 = (i+1) * 6;
           idx2 = i*6;
         }
         else
         {
-          v1 = _vertices[i];
-          v2 = _vertices[i+1];
+          v1 = vertex(i);
+          v2 = vertex(i+1);
           idx1 = i*6;
           idx2 = (i+1) * 6;
         }
@@ -680,18 +863,22 @@ void Ogre2DynamicRenderable::GenerateNormals(Ogre::OperationType _opType,
     }
     case Ogre::OperationType::OT_TRIANGLE_FAN:
     {
+      // normals are averaged around the whole fan
+      _begin = 0u;
+      _end = std::max<size_t>(vertexCount, 1u);
+      clearNormals(_begin, _end);
       if (vertexCount < 3)
         return;
 
-      unsigned int idx1 = 0;
-      math::Vector3d v1 = _vertices[0];
+      size_t idx1 = 0;
+      math::Vector3d v1 = vertex(0);
 
-      for (unsigned int i = 0; i < vertexCount - 2; ++i)
+      for (size_t i = 0; i < vertexCount - 2; ++i)
       {
-        unsigned int idx2 = (i+1) * 6;
-        unsigned int idx3 = idx2 + 6;
-        math::Vector3d v2 = _vertices[i+1];
-        math::Vector3d v3 = _vertices[i+2];
+        size_t idx2 = (i+1) * 6;
+        size_t idx3 = idx2 + 6;
+        math::Vector3d v2 = vertex(i+1);
+        math::Vector3d v3 = vertex(i+2);
         math::Vector3d n = (v1 - v2).Cross((v1 - v3));
 
         math::Vector3d n1(_vbuffer[idx1+3], _vbuffer[idx1+4], _vbuffer[idx1+5]);
@@ -725,10 +912,10 @@ void Ogre2DynamicRenderable::GenerateNormals(Ogre::OperationType _opType,
 
 //////////////////////////////////////////////////
 void Ogre2DynamicRenderable::GenerateColors(Ogre::OperationType _opType,
-  const std::vector<math::Vector3d> &_vertices, float *_vbuffer)
+  size_t _begin, size_t _end)
 {
   // Skip if colors haven't been setup per-vertex correctly.
-  if (_vertices.size() != this->dataPtr->colors.size())
+  if (this->dataPtr->vertexCount != this->dataPtr->colors.size())
     return;
 
   // Each vertex occupies 6 elements in the vbuffer float array. Normally,
@@ -744,12 +931,13 @@ void Ogre2DynamicRenderable::GenerateColors(Ogre::OperationType _opType,
   {
     case Ogre::OperationType::OT_POINT_LIST:
     {
-      for (unsigned int i = 0; i < this->dataPtr->vertexBufferCapacity; ++i)
+      float *_vbuffer = this->dataPtr->vbuffer.data();
+      const size_t end = std::min(_end, this->dataPtr->colors.size());
+      for (size_t i = _begin; i < end; ++i)
       {
-        math::Color color = i < this->dataPtr->colors.size() ?
-            this->dataPtr->colors[i] : this->dataPtr->colors.back();
+        const math::Color &color = this->dataPtr->colors[i];
 
-        unsigned int idx = i * 6;
+        size_t idx = i * 6;
         _vbuffer[idx+3] = color.R();
         _vbuffer[idx+4] = color.G();
         _vbuffer[idx+5] = color.B();
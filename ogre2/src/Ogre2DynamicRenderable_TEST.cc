@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <gz/math/Vector3.hh>
+
+#include "gz/rendering/RenderEngine.hh"
+#include "gz/rendering/RenderingIface.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/ogre2/Ogre2DynamicRenderable.hh"
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+
+#include <OgreMesh2.h>
+#include <OgreSubMesh2.h>
+#include <Vao/OgreVertexArrayObject.h>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Get the number of vertices a dynamic renderable draws
+/// \param[in] _renderable Dynamic renderable
+/// \return Number of vertices in the draw range of its vao
+static size_t DrawCount(const Ogre2DynamicRenderable &_renderable)
+{
+  Ogre::Item *item = dynamic_cast<Ogre::Item *>(_renderable.OgreObject());
+  if (!item)
+    return 0u;
+  return item->getMesh()->getSubMesh(0u)->mVao[Ogre::VpNormal][0u]->
+      getPrimitiveCount();
+}
+
+/// \brief Expect the local bounds of a dynamic renderable to span the
+/// given corners
+/// \param[in] _renderable Dynamic renderable
+/// \param[in] _min Expected min corner
+/// \param[in] _max Expected max corner
+static void ExpectBounds(const Ogre2DynamicRenderable &_renderable,
+    const math::Vector3d &_min, const math::Vector3d &_max)
+{
+  const Ogre::Aabb aabb = _renderable.OgreObject()->getLocalAabb();
+  const Ogre::Vector3 min = aabb.getMinimum();
+  const Ogre::Vector3 max = aabb.getMaximum();
+  EXPECT_NEAR(_min.X(), min.x, 1e-5);
+  EXPECT_NEAR(_min.Y(), min.y, 1e-5);
+  EXPECT_NEAR(_min.Z(), min.z, 1e-5);
+  EXPECT_NEAR(_max.X(), max.x, 1e-5);
+  EXPECT_NEAR(_max.Y(), max.y, 1e-5);
+  EXPECT_NEAR(_max.Z(), max.z, 1e-5);
+}
+
+/////////////////////////////////////////////////
+TEST(Ogre2DynamicRenderableTest, SetPoints)
+{
+  RenderEngine *engine = rendering::engine("ogre2");
+  if (!engine)
+    GTEST_SKIP() << "Engine 'ogre2' could not be loaded";
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  auto renderable = std::make_unique<Ogre2DynamicRenderable>(scene);
+  ASSERT_NE(nullptr, renderable->OgreObject());
+
+  auto point = [](const std::vector<float> &_points, size_t _index)
+  {
+    return math::Vector3d(_points[_index * 3], _points[_index * 3 + 1],
+        _points[_index * 3 + 2]);
+  };
+
+  // a path that grows by one point per update
+  std::vector<float> points;
+  for (unsigned int i = 0; i < 100u; ++i)
+  {
+    points.push_back(0.01f * i);
+    points.push_back(0.0f);
+    points.push_back(1.0f);
+  }
+  renderable->SetPoints(points.data(), points.size() / 3);
+  renderable->Update();
+  ASSERT_EQ(100u, renderable->PointCount());
+  for (unsigned int i = 0; i < renderable->PointCount(); ++i)
+    EXPECT_EQ(point(points, i), renderable->Point(i));
+  EXPECT_EQ(100u, DrawCount(*renderable));
+  ExpectBounds(*renderable, point(points, 0u), point(points, 99u));
+
+  points.push_back(10.0f);
+  points.push_back(1.0f);
+  points.push_back(1.0f);
+  renderable->SetPoints(points.data(), points.size() / 3);
+  renderable->Update();
+  ASSERT_EQ(101u, renderable->PointCount());
+  for (unsigned int i = 0; i < renderable->PointCount(); ++i)
+    EXPECT_EQ(point(points, i), renderable->Point(i));
+  EXPECT_EQ(101u, DrawCount(*renderable));
+  ExpectBounds(*renderable, point(points, 0u), point(points, 100u));
+
+  // moving a single point grows the bounds
+  renderable->SetPoint(10u, math::Vector3d(0, 0, 5));
+  renderable->Update();
+  EXPECT_EQ(math::Vector3d(0, 0, 5), renderable->Point(10u));
+  EXPECT_EQ(point(points, 9u), renderable->Point(9u));
+  EXPECT_EQ(point(points, 11u), renderable->Point(11u));
+  ExpectBounds(*renderable, math::Vector3d(0, 0, 1),
+      math::Vector3d(10, 1, 5));
+
+  // shrinking the path draws fewer vertices and recomputes the bounds
+  renderable->SetPoints(points.data(), 10u);
+  renderable->Update();
+  ASSERT_EQ(10u, renderable->PointCount());
+  for (unsigned int i = 0; i < renderable->PointCount(); ++i)
+    EXPECT_EQ(point(points, i), renderable->Point(i));
+  EXPECT_EQ(10u, DrawCount(*renderable));
+  ExpectBounds(*renderable, point(points, 0u), point(points, 9u));
+
+  // switching the operation type keeps the points
+  renderable->SetOperationType(MT_POINTS);
+  renderable->Update();
+  EXPECT_EQ(MT_POINTS, renderable->OperationType());
+  ASSERT_EQ(10u, renderable->PointCount());
+  EXPECT_EQ(point(points, 9u), renderable->Point(9u));
+  EXPECT_EQ(10u, DrawCount(*renderable));
+
+  // an empty renderable still draws one vertex
+  renderable->Clear();
+  renderable->Update();
+  EXPECT_EQ(0u, renderable->PointCount());
+  EXPECT_EQ(1u, DrawCount(*renderable));
+
+  renderable.reset();
+  engine->DestroyScene(scene);
+  ASSERT_TRUE(rendering::unloadEngine(engine->Name()));
+}
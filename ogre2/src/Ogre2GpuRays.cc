@@ -15,7 +15,16 @@
  *
 */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
 #include <variant>
+#include <vector>
 
 #include <gz/math/Vector2.hh>
 #include <gz/math/Vector3.hh>
@@ -37,7 +46,9 @@
 #include "gz/rendering/ogre2/Ogre2Sensor.hh"
 #include "gz/rendering/ogre2/Ogre2Visual.hh"
 
+#include "Ogre2CpuRayCaster.hh"
 #include "Ogre2GzHlmsSphericalClipMinDistance.hh"
+#include "Ogre2MeshLod.hh"
 #include "Ogre2ParticleNoiseListener.hh"
 #include "Terra/Hlms/PbsListener/OgreHlmsPbsTerraShadows.h"
 
@@ -53,6 +64,7 @@
 #include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
 #include <OgreDepthBuffer.h>
 #include <OgreItem.h>
+#include <OgreRenderSystemCapabilities.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #include <OgreTechnique.h>
@@ -84,6 +96,12 @@ class GZ_RENDERING_OGRE2_HIDDEN
   /// \brief destructor
   public: virtual ~Ogre2LaserRetroMaterialSwitcher() = default;
 
+  /// \brief Set the sensor the projection and clamping settings are taken
+  /// from
+  /// \param[in] _gpuRays Gpu rays sensor
+  /// \param[in] _ogreCamera camera to obtain projection settings from
+  public: void SetGpuRays(Ogre2GpuRays *_gpuRays, Ogre::Camera *_ogreCamera);
+
   /// \brief Called when each pass is about to be executed.
   /// \param[in] _pass Ogre pass which is about to execute
   private: virtual void passPreExecute(
@@ -113,6 +131,142 @@ class GZ_RENDERING_OGRE2_HIDDEN
   private:
     std::vector<std::pair<Ogre::SubItem *, Ogre::MaterialPtr>> materialMap;
 };
+
+/// \brief Cubemap faces rendered by the 1st pass. Gpu rays sensors whose
+/// 1st pass would render the same images share one, see
+/// Ogre2GpuRays::CanShareCubemap: the faces are rendered once per frame by
+/// the first of them to render and every sensor only runs its own 2nd pass.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2GpuRaysCubemap
+{
+  /// \brief Destructor, destroys the cubemap camera, textures and
+  /// workspaces
+  public: ~Ogre2GpuRaysCubemap();
+
+  /// \brief Unique name prefix of the cubemap camera and textures. The
+  /// cubemap outlives the sensor that created it when other sensors still
+  /// share it, so its resources are not named after that sensor.
+  public: std::string name;
+
+  /// \brief Scene manager the cubemap camera was created in
+  public: Ogre::SceneManager *sceneManager = nullptr;
+
+  /// \brief Cubemap camera, attached to the first user
+  public: Ogre::Camera *cubeCam{nullptr};
+
+  /// \brief Temporary texture where to render a side of the cubemap
+  /// during GpuRays1stPass. Shared across all active faces to save memory
+  public: Ogre::TextureGpu *colorTexture = nullptr;
+
+  /// \brief Temporary texture where to render a side of the cubemap
+  /// during GpuRays1stPass. Shared across all active faces to save memory
+  public: Ogre::TextureGpu *depthTexture = nullptr;
+
+  /// \brief Temporary texture where to render a side of the cubemap
+  /// during GpuRays1stPass. Shared across all active faces to save memory
+  public: Ogre::TextureGpu *particleTexture = nullptr;
+
+  /// \brief Temporary texture where to render a side of the cubemap
+  /// during GpuRays1stPass. Shared across all active faces to save memory
+  public: Ogre::TextureGpu *particleDepthTexture = nullptr;
+
+  /// \brief Set of cubemap faces needed by any of the users
+  public: std::set<unsigned int> cubeFaceIdx;
+
+  /// \brief 1st pass compositor workspace. One for each cubemap camera
+  public: Ogre::CompositorWorkspace *ogreCompositorWorkspace1st[6] = {};
+
+  /// \brief An array of first pass textures. One for each cubemap camera.
+  public: Ogre::TextureGpu *firstPassTextures[6] = {};
+
+  /// \brief Pointer to material switcher
+  public: std::unique_ptr<Ogre2LaserRetroMaterialSwitcher>
+      laserRetroMaterialSwitcher[6];
+
+  /// \brief Sensors sampling the cubemap. The first one owns the cubemap
+  /// camera and provides the settings of the 1st pass.
+  public: std::vector<Ogre2GpuRays *> users;
+
+  /// \brief Ogre frame number the faces were last rendered in
+  public: unsigned long renderedFrame =
+      std::numeric_limits<unsigned long>::max();
+};
+
+/// \brief Rays sampled by the 2nd pass: min and max horizontal angles, min
+/// and max vertical angles, horizontal and vertical ray counts
+using Ogre2GpuRaysSampleKey = std::tuple<double, double, double, double,
+    unsigned int, unsigned int>;
+
+/// \brief Cubemap face and uv coordinates sampled by every ray of the 2nd
+/// pass, see Ogre2GpuRays::CreateSampleTexture
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2GpuRaysSampleTable
+{
+  /// \brief u, v, face index and an unused value for every ray
+  public: std::vector<float> data;
+
+  /// \brief Cubemap faces sampled by any of the rays
+  public: std::set<unsigned int> cubeFaceIdx;
+};
+
+/// \brief Sampling texture uploaded from a table, shared by all the gpu
+/// rays sensors sampling the same rays
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2GpuRaysSampleTexture
+{
+  /// \brief Destructor, destroys the texture
+  public: ~Ogre2GpuRaysSampleTexture();
+
+  /// \brief Rays the texture was created for
+  public: Ogre2GpuRaysSampleKey key;
+
+  /// \brief Table the texture was uploaded from
+  public: std::shared_ptr<const Ogre2GpuRaysSampleTable> table;
+
+  /// \brief RGBA32F texture holding the table
+  public: Ogre::TextureGpu *texture = nullptr;
+};
+
+/// \brief Process wide cache of the sampling tables and textures. Tables
+/// are kept after their texture is destroyed so that recreating a sensor
+/// only uploads the table again. Only used from the render thread.
+class GZ_RENDERING_OGRE2_HIDDEN Ogre2GpuRaysSampleCache
+{
+  /// \brief Cached table and texture of some rays
+  public: struct Entry
+  {
+    /// \brief The table
+    std::shared_ptr<const Ogre2GpuRaysSampleTable> table;
+
+    /// \brief Texture uploaded from the table, if a sensor still uses it
+    std::weak_ptr<Ogre2GpuRaysSampleTexture> texture;
+
+    /// \brief Value of useCount the entry was last looked up at
+    uint64_t lastUse = 0u;
+  };
+
+  /// \brief Get the cache
+  /// \return The cache
+  public: static Ogre2GpuRaysSampleCache &Instance();
+
+  /// \brief Get the entry of some rays, creating an empty one if needed
+  /// \param[in] _key Rays
+  /// \return The entry
+  public: Entry &Find(const Ogre2GpuRaysSampleKey &_key);
+
+  /// \brief Drop the least recently used entries no sensor uses until at
+  /// most kMaxUnusedEntries of them remain
+  public: void Prune();
+
+  /// \brief Number of unused entries kept
+  public: static constexpr size_t kMaxUnusedEntries = 16u;
+
+  /// \brief Entries indexed by rays
+  public: std::map<Ogre2GpuRaysSampleKey, Entry> entries;
+
+  /// \brief Number of lookups so far
+  public: uint64_t useCount = 0u;
+
+  /// \brief Number of textures created so far, used to name them
+  public: uint64_t textureCount = 0u;
+};
 }
 }
 }
@@ -135,31 +289,21 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
   /// \brief Outgoing gpu rays data, used by newGpuRaysFrame event.
   public: float *gpuRaysScan = nullptr;
 
-  /// \brief Persistent GPU->CPU readback ticket used by the non-legacy
-  /// PostRender path.
-  public: Ogre2GpuReadbackTicket gpuRaysReadback;
-
-  /// \brief Cubemap camera
-  public: Ogre::Camera *cubeCam{nullptr};
-
-  /// \brief Texture packed with cubemap face and uv data
-  public: Ogre::TextureGpu *cubeUVTexture = nullptr;
-
-  /// \brief Temporary texture where to render a side of the cubemap
-  /// during GpuRays1stPass. Shared across all active faces to save memory
-  public: Ogre::TextureGpu *colorTexture = nullptr;
+  /// \brief True if the latest scan was written to the subscriber supplied
+  /// output buffer instead of gpuRaysScan
+  public: bool scanInOutputBuffer = false;
 
-  /// \brief Temporary texture where to render a side of the cubemap
-  /// during GpuRays1stPass. Shared across all active faces to save memory
-  public: Ogre::TextureGpu *depthTexture = nullptr;
+  /// \brief Persistent GPU->CPU readback ring used by the non-legacy
+  /// PostRender path.
+  public: Ogre2GpuReadbackRing gpuRaysReadback;
 
-  /// \brief Temporary texture where to render a side of the cubemap
-  /// during GpuRays1stPass. Shared across all active faces to save memory
-  public: Ogre::TextureGpu *particleTexture = nullptr;
+  /// \brief Cubemap faces rendered by the 1st pass, possibly shared with
+  /// co-located sensors
+  public: std::shared_ptr<Ogre2GpuRaysCubemap> cubemap;
 
-  /// \brief Temporary texture where to render a side of the cubemap
-  /// during GpuRays1stPass. Shared across all active faces to save memory
-  public: Ogre::TextureGpu *particleDepthTexture = nullptr;
+  /// \brief Texture packed with cubemap face and uv data, shared with the
+  /// sensors sampling the same rays
+  public: std::shared_ptr<Ogre2GpuRaysSampleTexture> sampleTexture;
 
   /// \brief Set of cubemap faces that are needed to generate the final
   /// range data
@@ -168,18 +312,20 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
   /// \brief Main pass definition (used for visibility mask manipulation).
   public: Ogre::CompositorPassSceneDef *mainPassSceneDef = nullptr;
 
-  /// \brief 1st pass compositor workspace. One for each cubemap camera
-  public: Ogre::CompositorWorkspace *ogreCompositorWorkspace1st[6];
-
   /// \brief 2nd pass compositor workspace.
   public: Ogre::CompositorWorkspace *ogreCompositorWorkspace2nd = nullptr;
 
-  /// \brief An array of first pass textures. One for each cubemap camera.
-  public: Ogre::TextureGpu * firstPassTextures[6];
-
   /// \brief Second pass texture.
   public: Ogre::TextureGpu * secondPassTexture = nullptr;
 
+  /// \brief Single channel texture holding the 2nd pass output tightly
+  /// packed in the RGB layout published by the sensor. Null if the packing
+  /// pass is not used, see SetupPackPass.
+  public: Ogre::TextureGpu *packedTexture = nullptr;
+
+  /// \brief Compositor workspace of the packing pass.
+  public: Ogre::CompositorWorkspace *ogreCompositorWorkspacePack = nullptr;
+
   /// \brief Pointer to the ogre camera
   public: Ogre::Camera *ogreCamera = nullptr;
 
@@ -198,10 +344,6 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
   /// \brief Dummy render texture for the gpu rays
   public: RenderTexturePtr renderTexture;
 
-  /// \brief Pointer to material switcher
-  public: std::unique_ptr<Ogre2LaserRetroMaterialSwitcher>
-      laserRetroMaterialSwitcher[6];
-
   /// \brief Near clip plane for cube camera
   public: float nearClipCube = 0.0;
 
@@ -221,6 +363,30 @@ class GZ_RENDERING_OGRE2_HIDDEN gz::rendering::Ogre2GpuRaysPrivate
 
   /// \brief Pointer to the particle target definition in the workspace
   public: Ogre::CompositorTargetDef *particleTargetDef{nullptr};
+
+  /// \brief True if the current frame is cast on the CPU instead of being
+  /// rasterized, see Ogre2CpuRayCaster::Enabled
+  public: bool cpuRayCasting = false;
+
+  /// \brief CPU ray caster, created the first time the sensor casts its
+  /// rays on the CPU
+  public: std::unique_ptr<Ogre2CpuRayCaster> cpuRayCaster;
+
+  /// \brief Direction of every ray in the sensor frame, in the order of
+  /// the published scan
+  public: std::vector<Ogre::Vector3> cpuRayDirections;
+
+  /// \brief Direction of every ray in world space
+  public: std::vector<Ogre::Vector3> cpuWorldDirections;
+
+  /// \brief Distance below which the hits of every ray are ignored
+  public: std::vector<float> cpuMinDistances;
+
+  /// \brief Distance to the closest hit of every ray
+  public: std::vector<float> cpuDistances;
+
+  /// \brief Object hit by every ray
+  public: std::vector<uint32_t> cpuObjects;
 };
 
 using namespace gz;
@@ -233,6 +399,96 @@ static const uint32_t kLaserRetro1stPassQuad = 9526u;
 /// \brief standard deviation of particle noise
 static const double kParticleStddev = 0.01;
 
+/// \brief Largest distance, in meters, and quaternion difference between the
+/// poses of sensors sharing a cubemap
+static const double kCubemapPoseTolerance = 1e-4;
+
+//////////////////////////////////////////////////
+Ogre2GpuRaysCubemap::~Ogre2GpuRaysCubemap()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  auto textureGpuManager = ogreRoot->getRenderSystem()->getTextureGpuManager();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  // remove 1st pass textures, material, compositors
+  for (auto i : this->cubeFaceIdx)
+  {
+    if (this->ogreCompositorWorkspace1st[i])
+    {
+      ogreCompMgr->removeWorkspace(this->ogreCompositorWorkspace1st[i]);
+      this->ogreCompositorWorkspace1st[i] = nullptr;
+    }
+    if (this->firstPassTextures[i])
+    {
+      textureGpuManager->destroyTexture(this->firstPassTextures[i]);
+      this->firstPassTextures[i] = nullptr;
+    }
+  }
+
+  for (Ogre::TextureGpu *texture : {this->colorTexture, this->depthTexture,
+      this->particleTexture, this->particleDepthTexture})
+  {
+    if (texture)
+      textureGpuManager->destroyTexture(texture);
+  }
+
+  if (this->sceneManager && this->cubeCam)
+    this->sceneManager->destroyCamera(this->cubeCam);
+}
+
+//////////////////////////////////////////////////
+Ogre2GpuRaysSampleTexture::~Ogre2GpuRaysSampleTexture()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  if (!this->texture || !ogreRoot)
+    return;
+
+  ogreRoot->getRenderSystem()->getTextureGpuManager()->destroyTexture(
+      this->texture);
+}
+
+//////////////////////////////////////////////////
+Ogre2GpuRaysSampleCache &Ogre2GpuRaysSampleCache::Instance()
+{
+  static Ogre2GpuRaysSampleCache cache;
+  return cache;
+}
+
+//////////////////////////////////////////////////
+Ogre2GpuRaysSampleCache::Entry &Ogre2GpuRaysSampleCache::Find(
+    const Ogre2GpuRaysSampleKey &_key)
+{
+  Entry &entry = this->entries[_key];
+  entry.lastUse = ++this->useCount;
+  return entry;
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRaysSampleCache::Prune()
+{
+  while (true)
+  {
+    auto oldest = this->entries.end();
+    size_t unusedCount = 0u;
+    for (auto it = this->entries.begin(); it != this->entries.end(); ++it)
+    {
+      if (!it->second.texture.expired())
+        continue;
+      ++unusedCount;
+      if (oldest == this->entries.end() ||
+          it->second.lastUse < oldest->second.lastUse)
+      {
+        oldest = it;
+      }
+    }
+    if (unusedCount <= kMaxUnusedEntries)
+      return;
+    this->entries.erase(oldest);
+  }
+}
+
 //////////////////////////////////////////////////
 Ogre2LaserRetroMaterialSwitcher::Ogre2LaserRetroMaterialSwitcher(
   Ogre2ScenePtr _scene, Ogre2GpuRays *_gpuRays, Ogre::Camera *_ogreCamera)
@@ -242,6 +498,14 @@ Ogre2LaserRetroMaterialSwitcher::Ogre2LaserRetroMaterialSwitcher(
   this->ogreCamera = _ogreCamera;
 }
 
+//////////////////////////////////////////////////
+void Ogre2LaserRetroMaterialSwitcher::SetGpuRays(Ogre2GpuRays *_gpuRays,
+    Ogre::Camera *_ogreCamera)
+{
+  this->gpuRays = _gpuRays;
+  this->ogreCamera = _ogreCamera;
+}
+
 //////////////////////////////////////////////////
 void Ogre2LaserRetroMaterialSwitcher::passPreExecute(
   Ogre::CompositorPass *_pass)
@@ -557,13 +821,6 @@ Ogre2GpuRays::Ogre2GpuRays()
 {
   // r = depth, g = retro, and b = n/a
   this->channels = 3u;
-
-  for (unsigned int i = 0; i < this->dataPtr->kCubeCameraCount; ++i)
-  {
-    this->dataPtr->ogreCompositorWorkspace1st[i] = nullptr;
-    this->dataPtr->laserRetroMaterialSwitcher[i] = nullptr;
-    this->dataPtr->firstPassTextures[i] = nullptr;
-  }
 }
 
 //////////////////////////////////////////////////
@@ -598,86 +855,119 @@ void Ogre2GpuRays::Destroy()
     this->dataPtr->gpuRaysScan = nullptr;
   }
 
+  this->DestroyGpuRaysTextures();
+  this->dataPtr->sampleTexture.reset();
+
+  if (this->scene)
+  {
+    Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
+    if (ogreSceneManager)
+    {
+      ogreSceneManager->destroyCamera(this->dataPtr->ogreCamera);
+      this->dataPtr->ogreCamera = nullptr;
+    }
+  }
+
+  // call base node destroy to remove parent
+  Ogre2Node::Destroy();
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::DestroyGpuRaysTextures()
+{
+  this->dataPtr->gpuRaysReadback.Destroy();
+
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   auto textureGpuManager = ogreRoot->getRenderSystem()->getTextureGpuManager();
 
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
 
-  // remove 1st pass textures, material, compositors
-  for (auto i : this->dataPtr->cubeFaceIdx)
+  // remove 2nd pass texture, material, compositor
+  if (this->dataPtr->ogreCompositorWorkspace2nd)
   {
-    if (this->dataPtr->ogreCompositorWorkspace1st[i])
-    {
-      ogreCompMgr->removeWorkspace(
-          this->dataPtr->ogreCompositorWorkspace1st[i]);
-      this->dataPtr->ogreCompositorWorkspace1st[i] = nullptr;
-    }
-    if (this->dataPtr->firstPassTextures[i])
-    {
-      textureGpuManager->destroyTexture(this->dataPtr->firstPassTextures[i]);
-      this->dataPtr->firstPassTextures[i] = nullptr;
-    }
+    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace2nd);
+    this->dataPtr->ogreCompositorWorkspace2nd = nullptr;
   }
-  this->dataPtr->particleTargetDef = nullptr;
 
-  // remove 2nd pass texture, material, compositor
   if (this->dataPtr->secondPassTexture)
   {
     textureGpuManager->destroyTexture(this->dataPtr->secondPassTexture);
     this->dataPtr->secondPassTexture = nullptr;
   }
 
-  if (this->dataPtr->ogreCompositorWorkspace2nd)
+  // remove packing pass texture and compositor
+  if (this->dataPtr->ogreCompositorWorkspacePack)
   {
-    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace2nd);
-    this->dataPtr->ogreCompositorWorkspace2nd = nullptr;
+    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspacePack);
+    this->dataPtr->ogreCompositorWorkspacePack = nullptr;
   }
 
-  if (this->dataPtr->cubeUVTexture)
+  if (this->dataPtr->packedTexture)
   {
-    textureGpuManager->destroyTexture(this->dataPtr->cubeUVTexture);
-    this->dataPtr->cubeUVTexture = nullptr;
+    textureGpuManager->destroyTexture(this->dataPtr->packedTexture);
+    this->dataPtr->packedTexture = nullptr;
   }
-  if (this->dataPtr->colorTexture)
-  {
-    textureGpuManager->destroyTexture(this->dataPtr->colorTexture);
-    this->dataPtr->colorTexture = nullptr;
-  }
-  if (this->dataPtr->depthTexture)
-  {
-    textureGpuManager->destroyTexture(this->dataPtr->depthTexture);
-    this->dataPtr->depthTexture = nullptr;
-  }
-  if (this->dataPtr->particleTexture)
-  {
-    textureGpuManager->destroyTexture(this->dataPtr->particleTexture);
-    this->dataPtr->particleTexture = nullptr;
-  }
-  if (this->dataPtr->particleDepthTexture)
+
+  // the sampling texture only depends on the rays and is kept so that the
+  // textures can be recreated without uploading it again, see
+  // CreateSampleTexture
+
+  // remove 1st pass textures, material, compositors unless other sensors
+  // still use them
+  this->ReleaseCubemap();
+  this->dataPtr->particleTargetDef = nullptr;
+  this->dataPtr->cubeFaceIdx.clear();
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::ReleaseCubemap()
+{
+  std::shared_ptr<Ogre2GpuRaysCubemap> cubemap;
+  cubemap.swap(this->dataPtr->cubemap);
+  if (!cubemap)
+    return;
+
+  std::vector<Ogre2GpuRays *> &users = cubemap->users;
+  const bool owner = !users.empty() && users.front() == this;
+  users.erase(std::remove(users.begin(), users.end(), this), users.end());
+
+  // the last user destroys the cubemap when the pointer goes out of scope,
+  // otherwise the cubemap camera is handed over to the next user
+  if (!owner || users.empty())
+    return;
+
+  Ogre2GpuRays *newOwner = users.front();
+  cubemap->cubeCam->detachFromParent();
+  newOwner->ogreNode->attachObject(cubemap->cubeCam);
+  for (auto &switcher : cubemap->laserRetroMaterialSwitcher)
   {
-    textureGpuManager->destroyTexture(this->dataPtr->particleDepthTexture);
-    this->dataPtr->particleDepthTexture = nullptr;
+    if (switcher)
+      switcher->SetGpuRays(newOwner, newOwner->dataPtr->ogreCamera);
   }
+}
 
-  if (this->scene)
+/////////////////////////////////////////////////
+bool Ogre2GpuRays::CanShareCubemap(const Ogre2GpuRays &_other) const
+{
+  // the 1st pass renders the range and retro of the faces from the pose of
+  // the sensor, clamped to its clip planes
+  if (!math::equal(this->NearClipPlane(), _other.NearClipPlane()) ||
+      !math::equal(this->FarClipPlane(), _other.FarClipPlane()) ||
+      this->dataMinVal != _other.dataMinVal ||
+      this->dataMaxVal != _other.dataMaxVal ||
+      this->VisibilityMask() != _other.VisibilityMask() ||
+      this->dataPtr->w1st != _other.dataPtr->w1st ||
+      this->dataPtr->h1st != _other.dataPtr->h1st)
   {
-    Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
-    if (ogreSceneManager)
-    {
-      ogreSceneManager->destroyCamera(this->dataPtr->ogreCamera);
-      this->dataPtr->ogreCamera = nullptr;
-
-      if (this->dataPtr->cubeCam)
-      {
-        ogreSceneManager->destroyCamera(this->dataPtr->cubeCam);
-        this->dataPtr->cubeCam = nullptr;
-      }
-    }
+    return false;
   }
 
-  // call base node destroy to remove parent
-  Ogre2Node::Destroy();
+  const math::Pose3d pose = this->WorldPose();
+  const math::Pose3d otherPose = _other.WorldPose();
+  return pose.Pos().Equal(otherPose.Pos(), kCubemapPoseTolerance) &&
+      (pose.Rot().Equal(otherPose.Rot(), kCubemapPoseTolerance) ||
+       pose.Rot().Equal(-otherPose.Rot(), kCubemapPoseTolerance));
 }
 
 /////////////////////////////////////////////////
@@ -830,6 +1120,45 @@ void Ogre2GpuRays::CreateSampleTexture()
   double vmin = this->VerticalAngleMin().Radian();
   double vmax = this->VerticalAngleMax().Radian();
 
+  // identical sensors, e.g. the ones of a fleet of robots, share the
+  // texture. The table only depends on the rays: uv coordinates are
+  // normalized so the size of the cubemap faces does not matter.
+  const Ogre2GpuRaysSampleKey key(min, max, vmin, vmax,
+      this->dataPtr->w2nd, this->dataPtr->h2nd);
+  std::shared_ptr<Ogre2GpuRaysSampleTexture> &sampleTexture =
+      this->dataPtr->sampleTexture;
+  if (!sampleTexture || sampleTexture->key != key)
+  {
+    Ogre2GpuRaysSampleCache &cache = Ogre2GpuRaysSampleCache::Instance();
+    Ogre2GpuRaysSampleCache::Entry &entry = cache.Find(key);
+    sampleTexture = entry.texture.lock();
+    if (!sampleTexture)
+    {
+      if (!entry.table)
+        entry.table = this->CreateSampleTable();
+      sampleTexture = std::make_shared<Ogre2GpuRaysSampleTexture>();
+      sampleTexture->key = key;
+      sampleTexture->table = entry.table;
+      sampleTexture->texture = this->UploadSampleTable(*entry.table,
+          "GpuRaysSampleTex_" + std::to_string(cache.textureCount++));
+      entry.texture = sampleTexture;
+    }
+    cache.Prune();
+  }
+
+  this->dataPtr->cubeFaceIdx = sampleTexture->table->cubeFaceIdx;
+}
+
+/////////////////////////////////////////////////////////
+std::shared_ptr<const Ogre2GpuRaysSampleTable>
+    Ogre2GpuRays::CreateSampleTable()
+{
+  GZ_PROFILE("Ogre2GpuRays::CreateSampleTable");
+  double min = this->AngleMin().Radian();
+  double max = this->AngleMax().Radian();
+  double vmin = this->VerticalAngleMin().Radian();
+  double vmax = this->VerticalAngleMax().Radian();
+
   double hAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(), max - min);
   double vAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
       vmax - vmin);
@@ -840,47 +1169,17 @@ void Ogre2GpuRays::CreateSampleTexture()
   if (this->dataPtr->h2nd > 1)
     vStep = vAngle / static_cast<double>(this->dataPtr->h2nd-1);
 
-  // create an RGB texture (cubeUVTex) to pack info that tells the shaders how
-  // to sample from the cubemap textures.
+  // pack info that tells the shaders how to sample from the cubemap
+  // textures.
   // Each pixel packs the follow data:
   //   R: u coordinate on the cubemap face
   //   G: v coordinate on the cubemap face
   //   B: cubemap face index
   //   A: unused
-  // this texture is passed to the 2nd pass fragment shader
-  auto engine = Ogre2RenderEngine::Instance();
-  auto ogreRoot = engine->OgreRoot();
-  Ogre::TextureGpuManager *textureMgr =
-    ogreRoot->getRenderSystem()->getTextureGpuManager();
-  std::string texName = this->Name() + "_samplerTex";
-  this->dataPtr->cubeUVTexture =
-    textureMgr->createOrRetrieveTexture(
-      texName,
-      Ogre::GpuPageOutStrategy::SaveToSystemRam,
-      Ogre::TextureFlags::ManualTexture,
-      Ogre::TextureTypes::Type2D,
-      Ogre::BLANKSTRING,
-      0u);
-
-  this->dataPtr->cubeUVTexture->setTextureType(Ogre::TextureTypes::Type2D);
-  this->dataPtr->cubeUVTexture->setResolution(
-    this->dataPtr->w2nd, this->dataPtr->h2nd);
-  this->dataPtr->cubeUVTexture->setNumMipmaps(1u);
-  this->dataPtr->cubeUVTexture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
-
-  const Ogre::uint32 rowAlignment = 1u;
-  const size_t dataSize = Ogre::PixelFormatGpuUtils::getSizeBytes(
-    this->dataPtr->cubeUVTexture->getWidth(),
-    this->dataPtr->cubeUVTexture->getHeight(),
-    this->dataPtr->cubeUVTexture->getDepth(),
-    this->dataPtr->cubeUVTexture->getNumSlices(),
-    this->dataPtr->cubeUVTexture->getPixelFormat(),
-    rowAlignment);
-
-  const size_t bytesPerRow =
-    this->dataPtr->cubeUVTexture->_getSysRamCopyBytesPerRow( 0 );
-  float *pDest = reinterpret_cast<float*>(
-    OGRE_MALLOC_SIMD(dataSize, Ogre::MEMCATEGORY_RESOURCE));
+  auto table = std::make_shared<Ogre2GpuRaysSampleTable>();
+  table->data.resize(
+      static_cast<size_t>(this->dataPtr->w2nd) * this->dataPtr->h2nd * 4u);
+  float *pDest = table->data.data();
 
   double v = vmin;
   int index = 0;
@@ -897,7 +1196,7 @@ void Ogre2GpuRays::CreateSampleTexture()
       math::Vector3d dir = yaw * pitch * ray;
       unsigned int faceIdx;
       math::Vector2d uv = this->SampleCubemap(dir, faceIdx);
-      this->dataPtr->cubeFaceIdx.insert(faceIdx);
+      table->cubeFaceIdx.insert(faceIdx);
       // gzdbg << "p(" << pitch << ") y(" << yaw << "): " << dir << " | "
       //       << uv << " | " << faceIdx << std::endl;
       // u
@@ -912,110 +1211,93 @@ void Ogre2GpuRays::CreateSampleTexture()
     }
     v += vStep;
   }
-  this->dataPtr->cubeUVTexture->_transitionTo(
+  return table;
+}
+
+/////////////////////////////////////////////////////////
+Ogre::TextureGpu *Ogre2GpuRays::UploadSampleTable(
+    const Ogre2GpuRaysSampleTable &_table, const std::string &_name)
+{
+  // create an RGB texture (cubeUVTex) holding the table.
+  // this texture is passed to the 2nd pass fragment shader
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::TextureGpuManager *textureMgr =
+    ogreRoot->getRenderSystem()->getTextureGpuManager();
+  Ogre::TextureGpu *texture =
+    textureMgr->createOrRetrieveTexture(
+      _name,
+      Ogre::GpuPageOutStrategy::SaveToSystemRam,
+      Ogre::TextureFlags::ManualTexture,
+      Ogre::TextureTypes::Type2D,
+      Ogre::BLANKSTRING,
+      0u);
+
+  texture->setTextureType(Ogre::TextureTypes::Type2D);
+  texture->setResolution(this->dataPtr->w2nd, this->dataPtr->h2nd);
+  texture->setNumMipmaps(1u);
+  texture->setPixelFormat(Ogre::PFG_RGBA32_FLOAT);
+
+  const Ogre::uint32 rowAlignment = 1u;
+  const size_t dataSize = Ogre::PixelFormatGpuUtils::getSizeBytes(
+    texture->getWidth(),
+    texture->getHeight(),
+    texture->getDepth(),
+    texture->getNumSlices(),
+    texture->getPixelFormat(),
+    rowAlignment);
+
+  const size_t bytesPerRow = texture->_getSysRamCopyBytesPerRow( 0 );
+  float *pDest = reinterpret_cast<float*>(
+    OGRE_MALLOC_SIMD(dataSize, Ogre::MEMCATEGORY_RESOURCE));
+  std::copy(_table.data.begin(), _table.data.end(), pDest);
+
+  texture->_transitionTo(
     Ogre::GpuResidency::Resident,
     reinterpret_cast<Ogre::uint8*>(pDest) );
   // We have to upload the data via a StagingTexture, which acts as an
   // intermediate stash memory that is both visible to CPU and GPU.
   Ogre::StagingTexture *stagingTexture = textureMgr->getStagingTexture(
-    this->dataPtr->cubeUVTexture->getWidth(),
-    this->dataPtr->cubeUVTexture->getHeight(),
-    this->dataPtr->cubeUVTexture->getDepth(),
-    this->dataPtr->cubeUVTexture->getNumSlices(),
-    this->dataPtr->cubeUVTexture->getPixelFormat() );
+    texture->getWidth(),
+    texture->getHeight(),
+    texture->getDepth(),
+    texture->getNumSlices(),
+    texture->getPixelFormat() );
   stagingTexture->startMapRegion();
   // Map region of the staging texture. This function can be called from
   // any thread after startMapRegion has already been called.
   Ogre::TextureBox texBox = stagingTexture->mapRegion(
-    this->dataPtr->cubeUVTexture->getWidth(),
-    this->dataPtr->cubeUVTexture->getHeight(),
-    this->dataPtr->cubeUVTexture->getDepth(),
-    this->dataPtr->cubeUVTexture->getNumSlices(),
-    this->dataPtr->cubeUVTexture->getPixelFormat());
+    texture->getWidth(),
+    texture->getHeight(),
+    texture->getDepth(),
+    texture->getNumSlices(),
+    texture->getPixelFormat());
 
   texBox.copyFrom(
     pDest,
-    this->dataPtr->cubeUVTexture->getWidth(),
-    this->dataPtr->cubeUVTexture->getHeight(),
+    texture->getWidth(),
+    texture->getHeight(),
     bytesPerRow);
   stagingTexture->stopMapRegion();
-  stagingTexture->upload(texBox, this->dataPtr->cubeUVTexture, 0, 0, 0, true);
+  stagingTexture->upload(texBox, texture, 0, 0, 0, true);
   // Tell the TextureGpuManager we're done with this StagingTexture.
   // Otherwise it will leak.
   textureMgr->removeStagingTexture(stagingTexture);
   stagingTexture = 0;
   // Do not free the pointer if texture's paging strategy is
   // GpuPageOutStrategy::AlwaysKeepSystemRamCopy
+  return texture;
 }
 
 /////////////////////////////////////////////////////////
 void Ogre2GpuRays::Setup1stPass()
 {
-  // Create tmp textures
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   Ogre::TextureGpuManager *textureMgr =
     ogreRoot->getRenderSystem()->getTextureGpuManager();
 
-  GZ_ASSERT(!this->dataPtr->colorTexture &&       //
-              !this->dataPtr->depthTexture &&     //
-              !this->dataPtr->particleTexture &&  //
-              !this->dataPtr->particleDepthTexture,
-            "Textures not destroyed!");
-
-  Ogre::CompositorChannelVec compoChannels;
-  compoChannels.reserve(5u);
-
-  std::string texName;
-
-  texName = this->Name() + "_colorTexture";
-  this->dataPtr->colorTexture = textureMgr->createTexture(
-    texName, texName, Ogre::GpuPageOutStrategy::Discard,
-    Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
-  this->dataPtr->colorTexture->setResolution(this->dataPtr->w1st,
-                                             this->dataPtr->h1st);
-  this->dataPtr->colorTexture->setNumMipmaps(1u);
-  this->dataPtr->colorTexture->setPixelFormat(Ogre::PFG_R16_UNORM);
-  this->dataPtr->colorTexture->scheduleTransitionTo(
-    Ogre::GpuResidency::Resident);
-
-  texName = this->Name() + "_depthTexture";
-  this->dataPtr->depthTexture = textureMgr->createTexture(
-    texName, texName, Ogre::GpuPageOutStrategy::Discard,
-    Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
-  this->dataPtr->depthTexture->setResolution(this->dataPtr->w1st,
-                                             this->dataPtr->h1st);
-  this->dataPtr->depthTexture->setNumMipmaps(1u);
-  this->dataPtr->depthTexture->setPixelFormat(Ogre::PFG_D32_FLOAT);
-  this->dataPtr->depthTexture->scheduleTransitionTo(
-    Ogre::GpuResidency::Resident);
-
-  texName = this->Name() + "_particleTexture";
-  this->dataPtr->particleTexture = textureMgr->createTexture(
-    texName, texName, Ogre::GpuPageOutStrategy::Discard,
-    Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
-  this->dataPtr->particleTexture->setResolution(this->dataPtr->w1st / 2u,
-                                             this->dataPtr->h1st/ 2u);
-  this->dataPtr->particleTexture->setNumMipmaps(1u);
-  this->dataPtr->particleTexture->setPixelFormat(Ogre::PFG_RGBA8_UNORM);
-  this->dataPtr->particleTexture->scheduleTransitionTo(
-    Ogre::GpuResidency::Resident);
-
-  texName = this->Name() + "_particleDepthTexture";
-  this->dataPtr->particleDepthTexture = textureMgr->createTexture(
-    texName, texName, Ogre::GpuPageOutStrategy::Discard,
-    Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
-  this->dataPtr->particleDepthTexture->setResolution(this->dataPtr->w1st / 2u,
-                                                     this->dataPtr->h1st / 2u);
-  this->dataPtr->particleDepthTexture->setNumMipmaps(1u);
-  this->dataPtr->particleDepthTexture->setPixelFormat(Ogre::PFG_D32_FLOAT);
-  this->dataPtr->particleDepthTexture->scheduleTransitionTo(
-    Ogre::GpuResidency::Resident);
-
-  compoChannels.push_back(this->dataPtr->colorTexture);
-  compoChannels.push_back(this->dataPtr->depthTexture);
-  compoChannels.push_back(this->dataPtr->particleTexture);
-  compoChannels.push_back(this->dataPtr->particleDepthTexture);
+  GZ_ASSERT(!this->dataPtr->cubemap, "Cubemap not released!");
 
   // Create 1st pass compositor
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
@@ -1047,49 +1329,139 @@ void Ogre2GpuRays::Setup1stPass()
            << " for " << this->Name();
   }
 
-  // create cubemap cameras and render to texture using 1st pass compositor
-  Ogre::SceneManager *ogreSceneManager = this->scene->OgreSceneManager();
-  this->dataPtr->cubeCam = ogreSceneManager->createCamera(
-      this->Name() + "_env");
-  this->dataPtr->cubeCam->detachFromParent();
-  this->ogreNode->attachObject(this->dataPtr->cubeCam);
-  this->dataPtr->cubeCam->setFOVy(Ogre::Degree(90));
-  this->dataPtr->cubeCam->setAspectRatio(1);
-  this->dataPtr->cubeCam->setNearClipDistance(this->dataPtr->nearClipCube);
-  this->dataPtr->cubeCam->setFarClipDistance(this->FarClipPlane());
-  this->dataPtr->cubeCam->setFixedYawAxis(false);
+  // reuse the cubemap of a co-located sensor whose 1st pass renders the
+  // same faces
+  for (unsigned int i = 0u; i < this->scene->SensorCount(); ++i)
+  {
+    Ogre2GpuRaysPtr other = std::dynamic_pointer_cast<Ogre2GpuRays>(
+        this->scene->SensorByIndex(i));
+    if (other && other.get() != this && other->dataPtr->cubemap &&
+        this->CanShareCubemap(*other))
+    {
+      this->dataPtr->cubemap = other->dataPtr->cubemap;
+      break;
+    }
+  }
+
+  std::string texName;
+  if (!this->dataPtr->cubemap)
+  {
+    // Create tmp textures
+    static unsigned int cubemapCounter = 0u;
+    auto cubemap = std::make_shared<Ogre2GpuRaysCubemap>();
+    cubemap->name = "GpuRaysCubemap_" + std::to_string(cubemapCounter++);
+
+    texName = cubemap->name + "_colorTexture";
+    cubemap->colorTexture = textureMgr->createTexture(
+      texName, texName, Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
+    cubemap->colorTexture->setResolution(this->dataPtr->w1st,
+                                         this->dataPtr->h1st);
+    cubemap->colorTexture->setNumMipmaps(1u);
+    cubemap->colorTexture->setPixelFormat(Ogre::PFG_R16_UNORM);
+    cubemap->colorTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+    texName = cubemap->name + "_depthTexture";
+    cubemap->depthTexture = textureMgr->createTexture(
+      texName, texName, Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
+    cubemap->depthTexture->setResolution(this->dataPtr->w1st,
+                                         this->dataPtr->h1st);
+    cubemap->depthTexture->setNumMipmaps(1u);
+    cubemap->depthTexture->setPixelFormat(Ogre::PFG_D32_FLOAT);
+    cubemap->depthTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+    texName = cubemap->name + "_particleTexture";
+    cubemap->particleTexture = textureMgr->createTexture(
+      texName, texName, Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
+    cubemap->particleTexture->setResolution(this->dataPtr->w1st / 2u,
+                                            this->dataPtr->h1st / 2u);
+    cubemap->particleTexture->setNumMipmaps(1u);
+    cubemap->particleTexture->setPixelFormat(Ogre::PFG_RGBA8_UNORM);
+    cubemap->particleTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
 
+    texName = cubemap->name + "_particleDepthTexture";
+    cubemap->particleDepthTexture = textureMgr->createTexture(
+      texName, texName, Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::RenderToTexture, Ogre::TextureTypes::Type2D);
+    cubemap->particleDepthTexture->setResolution(this->dataPtr->w1st / 2u,
+                                                 this->dataPtr->h1st / 2u);
+    cubemap->particleDepthTexture->setNumMipmaps(1u);
+    cubemap->particleDepthTexture->setPixelFormat(Ogre::PFG_D32_FLOAT);
+    cubemap->particleDepthTexture->scheduleTransitionTo(
+      Ogre::GpuResidency::Resident);
+
+    // create cubemap camera and render to texture using 1st pass compositor
+    cubemap->sceneManager = this->scene->OgreSceneManager();
+    cubemap->cubeCam = cubemap->sceneManager->createCamera(
+        cubemap->name + "_env");
+    cubemap->cubeCam->detachFromParent();
+    this->ogreNode->attachObject(cubemap->cubeCam);
+    cubemap->cubeCam->setFOVy(Ogre::Degree(90));
+    cubemap->cubeCam->setAspectRatio(1);
+    cubemap->cubeCam->setNearClipDistance(this->dataPtr->nearClipCube);
+    cubemap->cubeCam->setFarClipDistance(this->FarClipPlane());
+    cubemap->cubeCam->setFixedYawAxis(false);
+
+    this->dataPtr->cubemap = cubemap;
+  }
+
+  Ogre2GpuRaysCubemap &cubemap = *this->dataPtr->cubemap;
+  cubemap.users.push_back(this);
+
+  // the 1st pass settings are taken from the sensor owning the camera
+  Ogre2GpuRays *owner = cubemap.users.front();
+
+  Ogre::CompositorChannelVec compoChannels;
+  compoChannels.reserve(5u);
+  compoChannels.push_back(cubemap.colorTexture);
+  compoChannels.push_back(cubemap.depthTexture);
+  compoChannels.push_back(cubemap.particleTexture);
+  compoChannels.push_back(cubemap.particleDepthTexture);
+
+  // add the faces this sensor needs that the cubemap does not render yet
   for (auto i : this->dataPtr->cubeFaceIdx)
   {
+    if (cubemap.firstPassTextures[i])
+      continue;
+    cubemap.cubeFaceIdx.insert(i);
+
+    // the new face has not been rendered this frame yet
+    cubemap.renderedFrame = std::numeric_limits<unsigned long>::max();
+
     // create render texture - these textures pack the range data
     // that will be used in the 2nd pass
-    texName = this->Name() + "_first_pass_" + std::to_string(i);
-    this->dataPtr->firstPassTextures[i] =
-      textureMgr->createOrRetrieveTexture(
-        texName,
+    texName = cubemap.name + "_first_pass_" + std::to_string(i);
+    cubemap.firstPassTextures[i] =
+      textureMgr->createTexture(
+        texName, texName,
         Ogre::GpuPageOutStrategy::Discard,
         Ogre::TextureFlags::RenderToTexture,
         Ogre::TextureTypes::Type2D);
 
-    this->dataPtr->firstPassTextures[i]->setResolution(
+    cubemap.firstPassTextures[i]->setResolution(
       this->dataPtr->w1st, this->dataPtr->h1st);
-    this->dataPtr->firstPassTextures[i]->setNumMipmaps(1u);
-    this->dataPtr->firstPassTextures[i]->setPixelFormat(
+    cubemap.firstPassTextures[i]->setNumMipmaps(1u);
+    cubemap.firstPassTextures[i]->setPixelFormat(
       Ogre::PFG_RG32_FLOAT);
-    this->dataPtr->firstPassTextures[i]->_setDepthBufferDefaults(
+    cubemap.firstPassTextures[i]->_setDepthBufferDefaults(
       Ogre::DepthBuffer::POOL_NO_DEPTH, false, Ogre::PFG_UNKNOWN);
 
-    this->dataPtr->firstPassTextures[i]->scheduleTransitionTo(
+    cubemap.firstPassTextures[i]->scheduleTransitionTo(
       Ogre::GpuResidency::Resident);
 
-    compoChannels.push_back(this->dataPtr->firstPassTextures[i]);
+    compoChannels.push_back(cubemap.firstPassTextures[i]);
 
     // create compositor workspace
-    this->dataPtr->ogreCompositorWorkspace1st[i] =
+    cubemap.ogreCompositorWorkspace1st[i] =
         ogreCompMgr->addWorkspace(
           this->scene->OgreSceneManager(),
           compoChannels,
-          this->dataPtr->cubeCam,
+          cubemap.cubeCam,
           wsDefName,
           false, -1, 0, 0, Ogre::Vector4::ZERO, 0x00,
           this->dataPtr->kGpuRaysExecutionMask);
@@ -1098,11 +1470,11 @@ void Ogre2GpuRays::Setup1stPass()
 
     // add laser retro material switcher to workspace listener
     // so we can switch to use GORM_SOLID_COLOR
-    this->dataPtr->laserRetroMaterialSwitcher[i].reset(
-      new Ogre2LaserRetroMaterialSwitcher(this->scene, this,
-                                          this->dataPtr->ogreCamera));
-    this->dataPtr->ogreCompositorWorkspace1st[i]->addListener(
-      this->dataPtr->laserRetroMaterialSwitcher[i].get());
+    cubemap.laserRetroMaterialSwitcher[i].reset(
+      new Ogre2LaserRetroMaterialSwitcher(this->scene, owner,
+                                          owner->dataPtr->ogreCamera));
+    cubemap.ogreCompositorWorkspace1st[i]->addListener(
+      cubemap.laserRetroMaterialSwitcher[i].get());
   }
 }
 
@@ -1140,12 +1512,14 @@ void Ogre2GpuRays::Setup2ndPass()
   // The compositor needs to know about them so it can perform
   // the propier barrier and transitions on advanced APIs like Vulkan
   compoChannels.push_back(this->dataPtr->secondPassTexture);
-  compoChannels.push_back(this->dataPtr->cubeUVTexture);
+  compoChannels.push_back(this->dataPtr->sampleTexture->texture);
+  Ogre::TextureGpu **firstPassTextures =
+      this->dataPtr->cubemap->firstPassTextures;
   for (size_t i = 0u; i < 6u; ++i)
   {
-    if(this->dataPtr->firstPassTextures[i])
+    if(firstPassTextures[i])
     {
-      compoChannels.push_back(this->dataPtr->firstPassTextures[i]);
+      compoChannels.push_back(firstPassTextures[i]);
     }
     else
     {
@@ -1153,7 +1527,7 @@ void Ogre2GpuRays::Setup2ndPass()
       // Ogre complaining. The material pass won't be accessing those
       // indices anyway
       compoChannels.push_back(
-        this->dataPtr->firstPassTextures[*this->dataPtr->cubeFaceIdx.begin()]);
+        firstPassTextures[*this->dataPtr->cubeFaceIdx.begin()]);
     }
   }
 
@@ -1179,6 +1553,72 @@ void Ogre2GpuRays::Setup2ndPass()
         false);
 }
 
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::SetupPackPass()
+{
+  // The packing pass only feeds the persistent-ticket readback path
+  if (Ogre2UseLegacyReadback())
+    return;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::RenderSystem *renderSystem = ogreRoot->getRenderSystem();
+
+  // The packed texture is Channels() times wider than the 2nd pass texture.
+  // Keep reading back the RGBA texture if that exceeds the device limit.
+  const unsigned int packedWidth = this->dataPtr->w2nd * this->Channels();
+  const Ogre::RenderSystemCapabilities *caps =
+      renderSystem->getCapabilities();
+  if (caps && packedWidth > caps->getMaxTextureResolution2D())
+  {
+    gzdbg << "Packed gpu rays texture width [" << packedWidth
+          << "] exceeds the maximum texture size. Reading back unpacked data"
+          << std::endl;
+    return;
+  }
+
+  Ogre::TextureGpuManager *textureMgr = renderSystem->getTextureGpuManager();
+  this->dataPtr->packedTexture =
+    textureMgr->createOrRetrieveTexture(
+      this->Name() + "_packed",
+      Ogre::GpuPageOutStrategy::Discard,
+      Ogre::TextureFlags::RenderToTexture,
+      Ogre::TextureTypes::Type2D);
+
+  this->dataPtr->packedTexture->setResolution(packedWidth,
+      this->dataPtr->h2nd);
+  this->dataPtr->packedTexture->setNumMipmaps(1u);
+  this->dataPtr->packedTexture->setPixelFormat(Ogre::PFG_R32_FLOAT);
+  this->dataPtr->packedTexture->_setDepthBufferDefaults(
+    Ogre::DepthBuffer::POOL_NO_DEPTH, false, Ogre::PFG_UNKNOWN);
+
+  this->dataPtr->packedTexture->scheduleTransitionTo(
+    Ogre::GpuResidency::Resident);
+
+  Ogre::CompositorChannelVec compoChannels;
+  compoChannels.push_back(this->dataPtr->packedTexture);
+  compoChannels.push_back(this->dataPtr->secondPassTexture);
+
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  const std::string wsDefName = "GpuRaysPackWorkspace";
+  Ogre::CompositorWorkspaceDef *wsDef =
+      ogreCompMgr->getWorkspaceDefinition(wsDefName);
+  if (!wsDef)
+  {
+    gzerr << "Unable to find workspace definition [" << wsDefName << "] "
+           << " for " << this->Name();
+  }
+
+  this->dataPtr->ogreCompositorWorkspacePack =
+      ogreCompMgr->addWorkspace(
+        this->scene->OgreSceneManager(),
+        compoChannels,
+        this->dataPtr->ogreCamera,
+        wsDefName,
+        false);
+}
+
 /////////////////////////////////////////////////////////
 void Ogre2GpuRays::CreateGpuRaysTextures()
 {
@@ -1195,6 +1635,7 @@ void Ogre2GpuRays::CreateGpuRaysTextures()
   this->CreateSampleTexture();
   this->Setup1stPass();
   this->Setup2ndPass();
+  this->SetupPackPass();
 }
 
 /////////////////////////////////////////////////
@@ -1207,37 +1648,38 @@ void Ogre2GpuRays::UpdateRenderTarget1stPass()
     this->VisibilityMask() & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
 
   // update the compositors
-  for (auto i : this->dataPtr->cubeFaceIdx)
+  Ogre2GpuRaysCubemap &cubemap = *this->dataPtr->cubemap;
+  for (auto i : cubemap.cubeFaceIdx)
   {
-    this->dataPtr->cubeCam->setOrientation(Ogre::Quaternion::IDENTITY);
-    this->dataPtr->cubeCam->yaw(Ogre::Degree(-90));
-    this->dataPtr->cubeCam->roll(Ogre::Degree(-90));
+    cubemap.cubeCam->setOrientation(Ogre::Quaternion::IDENTITY);
+    cubemap.cubeCam->yaw(Ogre::Degree(-90));
+    cubemap.cubeCam->roll(Ogre::Degree(-90));
     // orient camera to its corresponding cubemap face
     if (i == 0)
-      this->dataPtr->cubeCam->yaw(Ogre::Degree(-90));
+      cubemap.cubeCam->yaw(Ogre::Degree(-90));
     else if (i == 1)
-      this->dataPtr->cubeCam->yaw(Ogre::Degree(90));
+      cubemap.cubeCam->yaw(Ogre::Degree(90));
     else if (i == 2)
-      this->dataPtr->cubeCam->pitch(Ogre::Degree(90));
+      cubemap.cubeCam->pitch(Ogre::Degree(90));
     else if (i == 3)
-      this->dataPtr->cubeCam->pitch(Ogre::Degree(-90));
+      cubemap.cubeCam->pitch(Ogre::Degree(-90));
     else if (i == 5)
-      this->dataPtr->cubeCam->yaw(Ogre::Degree(180));
+      cubemap.cubeCam->yaw(Ogre::Degree(180));
 
-    this->scene->UpdateAllHeightmaps(this->dataPtr->cubeCam);
+    this->scene->UpdateAllHeightmaps(cubemap.cubeCam);
 
-    this->dataPtr->ogreCompositorWorkspace1st[i]->setEnabled(true);
+    cubemap.ogreCompositorWorkspace1st[i]->setEnabled(true);
 
-    this->dataPtr->ogreCompositorWorkspace1st[i]->_validateFinalTarget();
-    this->dataPtr->ogreCompositorWorkspace1st[i]->_beginUpdate(false);
-    this->dataPtr->ogreCompositorWorkspace1st[i]->_update();
-    this->dataPtr->ogreCompositorWorkspace1st[i]->_endUpdate(false);
+    cubemap.ogreCompositorWorkspace1st[i]->_validateFinalTarget();
+    cubemap.ogreCompositorWorkspace1st[i]->_beginUpdate(false);
+    cubemap.ogreCompositorWorkspace1st[i]->_update();
+    cubemap.ogreCompositorWorkspace1st[i]->_endUpdate(false);
 
     swappedTargets.clear();
-    this->dataPtr->ogreCompositorWorkspace1st[i]->_swapFinalTarget(
+    cubemap.ogreCompositorWorkspace1st[i]->_swapFinalTarget(
           swappedTargets );
 
-    this->dataPtr->ogreCompositorWorkspace1st[i]->setEnabled(false);
+    cubemap.ogreCompositorWorkspace1st[i]->setEnabled(false);
   }
 }
 
@@ -1254,10 +1696,33 @@ void Ogre2GpuRays::UpdateRenderTarget2ndPass()
   this->dataPtr->ogreCompositorWorkspace2nd->_swapFinalTarget(swappedTargets);
 }
 
+/////////////////////////////////////////////////
+void Ogre2GpuRays::UpdatePackPass()
+{
+  if (!this->dataPtr->ogreCompositorWorkspacePack)
+    return;
+
+  this->dataPtr->ogreCompositorWorkspacePack->_validateFinalTarget();
+  this->dataPtr->ogreCompositorWorkspacePack->_beginUpdate(false);
+  this->dataPtr->ogreCompositorWorkspacePack->_update();
+  this->dataPtr->ogreCompositorWorkspacePack->_endUpdate(false);
+
+  Ogre::vector<Ogre::TextureGpu *>::type swappedTargets;
+  swappedTargets.reserve(2u);
+  this->dataPtr->ogreCompositorWorkspacePack->_swapFinalTarget(
+      swappedTargets);
+}
+
 //////////////////////////////////////////////////
 void Ogre2GpuRays::Render()
 {
   GZ_PROFILE("Ogre2GpuRays::Render");
+  if (this->dataPtr->cpuRayCasting)
+  {
+    this->RenderCpu();
+    return;
+  }
+
   this->scene->StartRendering(this->dataPtr->ogreCamera);
 
   auto engine = Ogre2RenderEngine::Instance();
@@ -1272,18 +1737,48 @@ void Ogre2GpuRays::Render()
 
   hlmsCustomizations.minDistanceClip =
       static_cast<float>(this->NearClipPlane());
-  this->UpdateRenderTarget1stPass();
+
+  // the faces of a shared cubemap are only rendered by the first of its
+  // sensors to render in a frame
+  uint8_t numPasses = 0u;
+  const unsigned long frame = engine->OgreRoot()->getNextFrameNumber();
+  if (this->dataPtr->cubemap->renderedFrame != frame)
+  {
+    Ogre2MeshLod::UpdateCamera(*this, this->dataPtr->cubemap->cubeCam,
+        this->dataPtr->h1st);
+    this->UpdateRenderTarget1stPass();
+    this->dataPtr->cubemap->renderedFrame = frame;
+    numPasses = 6u;
+  }
   this->UpdateRenderTarget2ndPass();
+  this->UpdatePackPass();
   hlmsCustomizations.minDistanceClip = -1;
 
-  this->scene->FlushGpuCommandsAndStartNewFrame(6u, false);
+  this->scene->FlushGpuCommandsAndStartNewFrame(numPasses, false);
 }
 
 //////////////////////////////////////////////////
 void Ogre2GpuRays::PreRender()
 {
   GZ_PROFILE("Ogre2GpuRays::PreRender");
-  if (!this->dataPtr->cubeUVTexture)
+  this->dataPtr->cpuRayCasting = Ogre2CpuRayCaster::Enabled(*this);
+  if (this->dataPtr->cpuRayCasting)
+  {
+    if (this->dataPtr->cpuRayDirections.empty())
+      this->CreateCpuRays();
+    return;
+  }
+
+  // stop sharing the cubemap of a sensor this one no longer matches, e.g.
+  // after one of them moved
+  if (this->dataPtr->cubemap &&
+      this->dataPtr->cubemap->users.front() != this &&
+      !this->CanShareCubemap(*this->dataPtr->cubemap->users.front()))
+  {
+    this->DestroyGpuRaysTextures();
+  }
+
+  if (!this->dataPtr->cubemap)
     this->CreateGpuRaysTextures();
 
   if (this->dataPtr->particleTargetDef)
@@ -1333,6 +1828,25 @@ namespace
       }
     }
   }
+
+  /// \brief Copy one mapped readback box of the packed texture into the
+  /// scan buffer. The box already holds the published RGB layout, so this is
+  /// a single memcpy unless the rows are padded.
+  void CopyPackedGpuRaysScan(const Ogre::TextureBox &_box, float *_scan,
+      unsigned int _width, unsigned int _height, unsigned int _channels)
+  {
+    const size_t rowBytes = _width * _channels * sizeof(float);
+    const unsigned char *src = static_cast<const unsigned char *>(_box.data);
+    if (_box.bytesPerRow == rowBytes)
+    {
+      memcpy(_scan, src, rowBytes * _height);
+      return;
+    }
+
+    unsigned char *dst = reinterpret_cast<unsigned char *>(_scan);
+    for (unsigned int row = 0; row < _height; ++row)
+      memcpy(dst + row * rowBytes, src + row * _box.bytesPerRow, rowBytes);
+  }
 }  // namespace
 
 //////////////////////////////////////////////////
@@ -1355,7 +1869,21 @@ void Ogre2GpuRays::PostRender()
     this->dataPtr->gpuRaysScan = new float[outputLen];
   }
 
-  if (Ogre2UseLegacyReadback())
+  // write the scan straight into the subscriber supplied buffer if there
+  // is one. SetOutputBuffer copies it back before the buffer is replaced,
+  // so Data() and Copy() never read a buffer that may have been released.
+  float *gpuRaysScan = static_cast<float *>(
+      this->OutputBuffer(outputLen * sizeof(float)));
+  if (!gpuRaysScan)
+    gpuRaysScan = this->dataPtr->gpuRaysScan;
+
+  if (this->dataPtr->cpuRayCasting)
+  {
+    this->FillCpuScan(gpuRaysScan);
+    this->PublishFrameView(gpuRaysScan, width, height,
+        width * this->Channels() * sizeof(float), PF_FLOAT32_RGB);
+  }
+  else if (Ogre2UseLegacyReadback())
   {
     // Legacy A/B control: original Ogre::Image2 path, kept verbatim.
     Ogre::Image2 image;
@@ -1372,29 +1900,53 @@ void Ogre2GpuRays::PostRender()
       {
         unsigned int idx = rowIdx + column * this->Channels();
         unsigned int rawIdx = rawDataRowIdx + column * rawChannelCount;
-        this->dataPtr->gpuRaysScan[idx] = bufferTmp[rawIdx];
-        this->dataPtr->gpuRaysScan[idx + 1] = bufferTmp[rawIdx + 1];
-        this->dataPtr->gpuRaysScan[idx + 2] = bufferTmp[rawIdx + 2];
+        gpuRaysScan[idx] = bufferTmp[rawIdx];
+        gpuRaysScan[idx + 1] = bufferTmp[rawIdx + 1];
+        gpuRaysScan[idx + 2] = bufferTmp[rawIdx + 2];
       }
     }
   }
   else
   {
-    // Persistent-ticket path: map the staging buffer once and repack RGBA->RGB
-    // in a single fused pass.
+    // Persistent-ticket path: map the staging buffer once and copy it into
+    // the scan buffer. If the packing pass ran, the GPU already wrote the
+    // published RGB layout and the copy is a plain memcpy; otherwise repack
+    // RGBA->RGB in a single fused pass. With a readback latency the mapped
+    // data belongs to an earlier frame.
+    Ogre::TextureGpu *readbackTexture = this->dataPtr->packedTexture ?
+        this->dataPtr->packedTexture : this->dataPtr->secondPassTexture;
+    this->dataPtr->gpuRaysReadback.SetLatency(this->ReadbackLatency());
     Ogre::TextureBox box = this->dataPtr->gpuRaysReadback.DownloadAndMap(
-        this->dataPtr->secondPassTexture);
+        readbackTexture);
     if (!box.data)
     {
-      gzerr << "Ogre2GpuRays: GPU readback failed; dropping frame" << std::endl;
+      if (!this->dataPtr->gpuRaysReadback.Filling())
+      {
+        gzerr << "Ogre2GpuRays: GPU readback failed; dropping frame"
+              << std::endl;
+      }
       return;
     }
-    FillGpuRaysScan(box, this->dataPtr->gpuRaysScan, width, height,
-        this->Channels(), rawChannelCount, bytesPerChannel);
+    if (this->dataPtr->packedTexture)
+    {
+      this->PublishFrameView(box.data, width, height, box.bytesPerRow,
+          PF_FLOAT32_RGB);
+      CopyPackedGpuRaysScan(box, gpuRaysScan, width, height,
+          this->Channels());
+    }
+    else
+    {
+      this->PublishFrameView(box.data, width, height, box.bytesPerRow,
+          format);
+      FillGpuRaysScan(box, gpuRaysScan, width, height,
+          this->Channels(), rawChannelCount, bytesPerChannel);
+    }
     this->dataPtr->gpuRaysReadback.Unmap();
   }
+  this->dataPtr->scanInOutputBuffer =
+      gpuRaysScan != this->dataPtr->gpuRaysScan;
 
-  this->dataPtr->newGpuRaysFrame(this->dataPtr->gpuRaysScan,
+  this->dataPtr->newGpuRaysFrame(gpuRaysScan,
       width, height, this->Channels(), "PF_FLOAT32_RGB");
 
   // Uncomment to debug output
@@ -1416,9 +1968,106 @@ void Ogre2GpuRays::PostRender()
   // }
 }
 
+/////////////////////////////////////////////////
+void Ogre2GpuRays::CreateCpuRays()
+{
+  this->ConfigureCamera();
+
+  double min = this->AngleMin().Radian();
+  double max = this->AngleMax().Radian();
+  double vmin = this->VerticalAngleMin().Radian();
+  double vmax = this->VerticalAngleMax().Radian();
+
+  double hAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(), max - min);
+  double vAngle = std::max(this->dataPtr->kMinAllowedAngle.Radian(),
+      vmax - vmin);
+
+  // same rays as the ones sampled from the cubemap, see CreateSampleTexture
+  double hStep = this->dataPtr->w2nd > 1u ?
+      hAngle / static_cast<double>(this->dataPtr->w2nd - 1) : 0.0;
+  double vStep = this->dataPtr->h2nd > 1u ?
+      vAngle / static_cast<double>(this->dataPtr->h2nd - 1) : 0.0;
+
+  const size_t rayCount =
+      static_cast<size_t>(this->dataPtr->w2nd) * this->dataPtr->h2nd;
+  this->dataPtr->cpuRayDirections.clear();
+  this->dataPtr->cpuRayDirections.reserve(rayCount);
+  for (unsigned int i = 0; i < this->dataPtr->h2nd; ++i)
+  {
+    const double v = vmin + i * vStep;
+    for (unsigned int j = 0; j < this->dataPtr->w2nd; ++j)
+    {
+      const double h = min + j * hStep;
+      this->dataPtr->cpuRayDirections.push_back(Ogre::Vector3(
+          static_cast<Ogre::Real>(std::cos(v) * std::cos(h)),
+          static_cast<Ogre::Real>(std::cos(v) * std::sin(h)),
+          static_cast<Ogre::Real>(std::sin(v))));
+    }
+  }
+
+  // the rasterized sensor clips everything closer than the near plane
+  // distance, in every direction
+  this->dataPtr->cpuMinDistances.assign(rayCount,
+      static_cast<float>(this->NearClipPlane()));
+
+  if (!this->dataPtr->cpuRayCaster)
+    this->dataPtr->cpuRayCaster = std::make_unique<Ogre2CpuRayCaster>();
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::RenderCpu()
+{
+  GZ_PROFILE("Ogre2GpuRays::RenderCpu");
+  this->scene->StartRendering(nullptr);
+
+  const Ogre::Vector3 origin =
+      Ogre2Conversions::Convert(this->WorldPosition());
+  const Ogre::Quaternion rotation =
+      Ogre2Conversions::Convert(this->WorldRotation());
+  auto &worldDirections = this->dataPtr->cpuWorldDirections;
+  worldDirections.resize(this->dataPtr->cpuRayDirections.size());
+  for (size_t i = 0u; i < worldDirections.size(); ++i)
+    worldDirections[i] = rotation * this->dataPtr->cpuRayDirections[i];
+
+  this->dataPtr->cpuRayCaster->Update(*this->scene,
+    this->VisibilityMask() & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
+  this->dataPtr->cpuRayCaster->Cast(*this->scene, origin, worldDirections,
+      this->dataPtr->cpuMinDistances,
+      static_cast<float>(this->FarClipPlane()),
+      this->dataPtr->cpuDistances, this->dataPtr->cpuObjects);
+
+  // nothing was drawn but the frame still has to be ended
+  this->scene->FlushGpuCommandsAndStartNewFrame(0u, false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::FillCpuScan(float *_scan) const
+{
+  const double nearPlane = this->NearClipPlane();
+  const double farPlane = this->FarClipPlane();
+  const unsigned int channels = this->Channels();
+  for (size_t i = 0u; i < this->dataPtr->cpuDistances.size(); ++i)
+  {
+    // same clamping as gpu_rays_1st_pass_fs
+    const float distance = this->dataPtr->cpuDistances[i];
+    float range = distance;
+    if (distance > farPlane)
+      range = this->dataMaxVal;
+    else if (distance < nearPlane)
+      range = this->dataMinVal;
+
+    _scan[i * channels] = range;
+    _scan[i * channels + 1] =
+        this->dataPtr->cpuRayCaster->Retro(this->dataPtr->cpuObjects[i]);
+    _scan[i * channels + 2] = 0.0f;
+  }
+}
+
 //////////////////////////////////////////////////
 const float* Ogre2GpuRays::Data() const
 {
+  if (this->dataPtr->scanInOutputBuffer)
+    return static_cast<const float *>(this->outputBuffer);
   return this->dataPtr->gpuRaysScan;
 }
 
@@ -1428,10 +2077,26 @@ void Ogre2GpuRays::Copy(float *_dataDest)
   unsigned int width = this->dataPtr->w2nd;
   unsigned int height = this->dataPtr->h2nd;
 
-  memcpy(_dataDest, this->dataPtr->gpuRaysScan,
+  memcpy(_dataDest, this->Data(),
     width * height * 3 * sizeof(float));
 }
 
+//////////////////////////////////////////////////
+void Ogre2GpuRays::SetOutputBuffer(void *_buffer, size_t _size)
+{
+  // the subscriber may release the buffer once it is replaced, keep the
+  // latest scan in the internal buffer
+  if (this->dataPtr->scanInOutputBuffer && this->dataPtr->gpuRaysScan)
+  {
+    memcpy(this->dataPtr->gpuRaysScan, this->outputBuffer,
+        this->dataPtr->w2nd * this->dataPtr->h2nd * this->Channels() *
+        sizeof(float));
+  }
+  this->dataPtr->scanInOutputBuffer = false;
+
+  BaseGpuRays::SetOutputBuffer(_buffer, _size);
+}
+
 /////////////////////////////////////////////////
 void Ogre2GpuRays::Set1stTextureSize(
     const unsigned int _w, const unsigned int _h)
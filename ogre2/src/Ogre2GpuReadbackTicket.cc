@@ -79,19 +79,19 @@ void Ogre2GpuReadbackTicket::Destroy()
   this->width = 0u;
   this->height = 0u;
   this->format = Ogre::PFG_UNKNOWN;
+  this->pending = false;
 }
 
 //////////////////////////////////////////////////
-Ogre::TextureBox Ogre2GpuReadbackTicket::DownloadAndMap(
-    Ogre::TextureGpu *_texture)
+bool Ogre2GpuReadbackTicket::Download(Ogre::TextureGpu *_texture,
+    bool _accurateTracking)
 {
-  Ogre::TextureBox box;  // default-constructed: data == nullptr
   if (!_texture)
-    return box;
+    return false;
 
   auto textureMgr = ReadbackTextureManager();
   if (!textureMgr)
-    return box;
+    return false;
 
   const unsigned int w = _texture->getWidth();
   const unsigned int h = _texture->getHeight();
@@ -118,24 +118,53 @@ Ogre::TextureBox Ogre2GpuReadbackTicket::DownloadAndMap(
     this->format = fmt;
   }
 
+  this->pending = false;
   if (!this->ticket)
-    return box;
+    return false;
 
   if (this->mapped)
   {
-    gzwarn << "Ogre2GpuReadbackTicket::DownloadAndMap() called while still "
+    gzwarn << "Ogre2GpuReadbackTicket::Download() called while still "
               "mapped; unmapping previous frame first." << std::endl;
     this->ticket->unmap();
     this->mapped = false;
   }
 
-  // Blocking download (accurateTracking=true): map() waits on the fence.
-  this->ticket->download(_texture, 0u, true);
+  this->ticket->download(_texture, 0u, _accurateTracking);
+  this->pending = true;
+  return true;
+}
+
+//////////////////////////////////////////////////
+Ogre::TextureBox Ogre2GpuReadbackTicket::Map()
+{
+  Ogre::TextureBox box;  // default-constructed: data == nullptr
+  if (!this->ticket || !this->pending)
+    return box;
+
+  // map() waits on the transfer fence if the download is still in flight.
   box = this->ticket->map(0u);
   this->mapped = true;
+  this->pending = false;
   return box;
 }
 
+//////////////////////////////////////////////////
+bool Ogre2GpuReadbackTicket::Pending() const
+{
+  return this->pending;
+}
+
+//////////////////////////////////////////////////
+Ogre::TextureBox Ogre2GpuReadbackTicket::DownloadAndMap(
+    Ogre::TextureGpu *_texture)
+{
+  // Blocking download (accurateTracking=true): map() waits on the fence.
+  if (!this->Download(_texture, true))
+    return Ogre::TextureBox();
+  return this->Map();
+}
+
 //////////////////////////////////////////////////
 void Ogre2GpuReadbackTicket::Unmap()
 {
@@ -146,6 +175,100 @@ void Ogre2GpuReadbackTicket::Unmap()
   }
 }
 
+//////////////////////////////////////////////////
+void Ogre2GpuReadbackRing::SetLatency(unsigned int _frames)
+{
+  if (_frames == this->latency)
+    return;
+  this->Destroy();
+  this->latency = _frames;
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2GpuReadbackRing::Latency() const
+{
+  return this->latency;
+}
+
+//////////////////////////////////////////////////
+Ogre::TextureBox Ogre2GpuReadbackRing::DownloadAndMap(
+    Ogre::TextureGpu *_texture)
+{
+  if (!_texture)
+    return Ogre::TextureBox();
+
+  // In-flight downloads of a different geometry are useless to the caller,
+  // so flush the ring whenever the source texture changes.
+  const unsigned int w = _texture->getWidth();
+  const unsigned int h = _texture->getHeight();
+  const Ogre::PixelFormatGpu fmt = _texture->getPixelFormat();
+  if (this->width != w || this->height != h || this->format != fmt)
+  {
+    this->Destroy();
+    this->width = w;
+    this->height = h;
+    this->format = fmt;
+  }
+
+  this->Unmap();
+
+  const unsigned int count = this->latency + 1u;
+  if (this->tickets.size() != count)
+  {
+    this->tickets.clear();
+    for (unsigned int i = 0u; i < count; ++i)
+    {
+      this->tickets.push_back(std::make_unique<Ogre2GpuReadbackTicket>());
+    }
+    this->head = 0u;
+  }
+
+  // Only a zero latency ring needs a dedicated fence; deeper rings map
+  // downloads that were queued frames ago.
+  const unsigned int writeIdx = this->head;
+  if (!this->tickets[writeIdx]->Download(_texture, this->latency == 0u))
+    return Ogre::TextureBox();
+  this->head = (this->head + 1u) % count;
+  if (this->queued <= this->latency)
+    ++this->queued;
+
+  // The oldest download sits right after the one just queued.
+  const unsigned int readIdx = this->head;
+  Ogre::TextureBox box = this->tickets[readIdx]->Map();
+  if (box.data)
+    this->mappedIdx = static_cast<int>(readIdx);
+  return box;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2GpuReadbackRing::Filling() const
+{
+  return this->latency > 0u && this->queued <= this->latency;
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuReadbackRing::Unmap()
+{
+  if (this->mappedIdx < 0)
+    return;
+  this->tickets[this->mappedIdx]->Unmap();
+  this->mappedIdx = -1;
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuReadbackRing::Destroy()
+{
+  this->Unmap();
+  for (auto &t : this->tickets)
+    t->Destroy();
+  this->tickets.clear();
+  this->head = 0u;
+  this->queued = 0u;
+  this->width = 0u;
+  this->height = 0u;
+  this->format = Ogre::PFG_UNKNOWN;
+}
+
 //////////////////////////////////////////////////
 bool gz::rendering::Ogre2UseLegacyReadback()
 {
@@ -17,6 +17,9 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2GPUREADBACKTICKET_HH_
 #define GZ_RENDERING_OGRE2_OGRE2GPUREADBACKTICKET_HH_
 
+#include <memory>
+#include <vector>
+
 #include "gz/rendering/config.hh"
 
 #ifdef _MSC_VER
@@ -61,6 +64,26 @@ namespace gz
       /// \return Mapped TextureBox; box.data is nullptr on failure.
       public: Ogre::TextureBox DownloadAndMap(Ogre::TextureGpu *_texture);
 
+      /// \brief Queue a GPU->CPU download of \p _texture (mip 0, slice 0) into
+      /// the persistent ticket without mapping it. The ticket is lazily
+      /// (re)created as in DownloadAndMap().
+      /// \param[in] _texture Source GPU texture.
+      /// \param[in] _accurateTracking True to track the transfer with its own
+      /// fence so Map() can run in the same frame; false lets Ogre reuse the
+      /// frame fence, which is cheaper when the ticket is mapped frames later.
+      /// \return True if the download was queued.
+      public: bool Download(Ogre::TextureGpu *_texture,
+          bool _accurateTracking);
+
+      /// \brief Map the download previously queued by Download(). Blocks only
+      /// if the transfer has not completed yet.
+      /// \return Mapped TextureBox; box.data is nullptr if nothing is pending.
+      public: Ogre::TextureBox Map();
+
+      /// \brief Whether a download has been queued and not yet mapped.
+      /// \return True if Map() would return data.
+      public: bool Pending() const;
+
       /// \brief Unmap the ticket previously mapped by DownloadAndMap().
       /// Safe to call when nothing is mapped.
       public: void Unmap();
@@ -85,6 +108,73 @@ namespace gz
 
       /// \brief True while the ticket is currently mapped.
       private: bool mapped{false};
+
+      /// \brief True while a download is queued but not yet mapped.
+      private: bool pending{false};
+    };
+
+    /// \brief Ring of Ogre2GpuReadbackTicket objects that pipelines GPU->CPU
+    /// readback over several frames. With a latency of N frames, frame k's
+    /// download is queued and the already-completed download of frame k-N is
+    /// mapped, so the CPU no longer waits on the GPU fence. A latency of 0
+    /// behaves exactly like a single blocking Ogre2GpuReadbackTicket.
+    /// Render-thread use only; NOT thread-safe.
+    class Ogre2GpuReadbackRing
+    {
+      /// \brief Set the number of frames of readback latency. Changing the
+      /// latency drops any in-flight downloads.
+      /// \param[in] _frames Frames of latency, 0 for blocking readback.
+      public: void SetLatency(unsigned int _frames);
+
+      /// \brief Get the number of frames of readback latency.
+      /// \return Frames of latency.
+      public: unsigned int Latency() const;
+
+      /// \brief Queue this frame's download of \p _texture and map the
+      /// oldest download in the ring. The caller MUST read the data out
+      /// honoring TextureBox::bytesPerRow and then call Unmap().
+      /// \param[in] _texture Source GPU texture.
+      /// \return Mapped TextureBox; box.data is nullptr on failure or while
+      /// the ring is still filling up, see Filling().
+      public: Ogre::TextureBox DownloadAndMap(Ogre::TextureGpu *_texture);
+
+      /// \brief Whether the ring has not yet queued enough frames to deliver
+      /// one. Lets callers tell a priming frame apart from a failure.
+      /// \return True while the first Latency() frames are in flight.
+      public: bool Filling() const;
+
+      /// \brief Unmap the ticket mapped by DownloadAndMap(). Safe to call when
+      /// nothing is mapped.
+      public: void Unmap();
+
+      /// \brief Destroy all tickets in the ring. Call from the owner's
+      /// Destroy() while the render engine is still alive.
+      public: void Destroy();
+
+      /// \brief Tickets in the ring, Latency() + 1 of them once created.
+      private: std::vector<std::unique_ptr<Ogre2GpuReadbackTicket>> tickets;
+
+      /// \brief Index of the ticket that receives the next download.
+      private: unsigned int head{0u};
+
+      /// \brief Number of downloads queued since the ring was last flushed,
+      /// saturating at Latency() + 1.
+      private: unsigned int queued{0u};
+
+      /// \brief Index of the currently mapped ticket, or -1 if none.
+      private: int mappedIdx{-1};
+
+      /// \brief Frames of readback latency.
+      private: unsigned int latency{0u};
+
+      /// \brief Cached source texture width; a change flushes the ring.
+      private: unsigned int width{0u};
+
+      /// \brief Cached source texture height; see width.
+      private: unsigned int height{0u};
+
+      /// \brief Cached source texture format; see width.
+      private: Ogre::PixelFormatGpu format{Ogre::PFG_UNKNOWN};
     };
 
     /// \brief Whether to use the legacy Ogre::Image2::convertFromTexture
@@ -25,6 +25,12 @@
 #endif
 #endif
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Profiler.hh>
 
@@ -41,9 +47,15 @@
 #endif
 #include <OgreItem.h>
 #include <OgreMaterialManager.h>
+#include <OgreMesh2.h>
+#include <OgreMeshManager2.h>
 #include <OgreRoot.h>
+#include <OgreSceneManager.h>
 #include <OgreSceneNode.h>
+#include <OgreSubMesh2.h>
 #include <OgreTechnique.h>
+#include <Vao/OgreVaoManager.h>
+#include <Vao/OgreVertexArrayObject.h>
 #ifdef _MSC_VER
   #pragma warning(pop)
 #endif
@@ -75,6 +87,13 @@ class gz::rendering::Ogre2LidarVisualPrivate
   /// \brief The current lidar points data
   public: std::vector<double> lidarPoints;
 
+  /// \brief The current lidar points data, when set in single precision
+  public: std::vector<float> lidarRanges;
+
+  /// \brief True if the current data is in lidarRanges rather than in
+  /// lidarPoints
+  public: bool rangesAreFloat = false;
+
   /// \brief True if new points data is received
   public: bool receivedData = false;
 
@@ -84,6 +103,25 @@ class gz::rendering::Ogre2LidarVisualPrivate
   /// \brief Pointer to point cloud material.
   /// Used when LidarVisualType = LVT_POINTS.
   public: Ogre::MaterialPtr pointsMat;
+
+  /// \brief Material of the points placed by the GPU.
+  /// Used when LidarVisualType = LVT_GPU_POINTS.
+  public: Ogre::MaterialPtr gpuPointsMat;
+
+  /// \brief Mesh of the points placed by the GPU. Its vertices hold the
+  /// direction of every ray in one buffer and its range in another one.
+  public: Ogre::MeshPtr gpuPointsMesh;
+
+  /// \brief Item of the points placed by the GPU
+  public: Ogre::Item *gpuPointsItem = nullptr;
+
+  /// \brief Vertex buffer holding the range of every ray, the only data
+  /// uploaded on every update
+  public: Ogre::VertexBufferPacked *gpuRangeBuffer = nullptr;
+
+  /// \brief Ray counts, angles and orientation the ray directions of the
+  /// points placed by the GPU were computed for
+  public: std::vector<double> gpuDirectionsKey;
 };
 
 using namespace gz;
@@ -110,6 +148,7 @@ void Ogre2LidarVisual::PreRender()
 //////////////////////////////////////////////////
 void Ogre2LidarVisual::Destroy()
 {
+  this->DestroyGpuPoints();
   BaseLidarVisual::Destroy();
   for (auto &ray : this->dataPtr->noHitRayStrips)
   {
@@ -142,7 +181,9 @@ void Ogre2LidarVisual::Destroy()
   }
 
   this->dataPtr->lidarPoints.clear();
+  this->dataPtr->lidarRanges.clear();
   this->dataPtr->pointsMat.setNull();
+  this->dataPtr->gpuPointsMat.setNull();
 }
 
 //////////////////////////////////////////////////
@@ -172,6 +213,9 @@ void Ogre2LidarVisual::Create()
   this->dataPtr->pointsMat =
       Ogre::MaterialManager::getSingleton().getByName(
       "PointCloudPoint");
+  this->dataPtr->gpuPointsMat =
+      Ogre::MaterialManager::getSingleton().getByName(
+      "LidarGpuPoint");
 
   this->ClearPoints();
   this->dataPtr->receivedData = false;
@@ -181,6 +225,8 @@ void Ogre2LidarVisual::Create()
 void Ogre2LidarVisual::ClearPoints()
 {
   this->dataPtr->lidarPoints.clear();
+  this->dataPtr->lidarRanges.clear();
+  this->dataPtr->rangesAreFloat = false;
   this->ClearVisualData();
   this->dataPtr->receivedData = false;
 }
@@ -193,12 +239,35 @@ void Ogre2LidarVisual::ClearVisualData()
   this->dataPtr->rayLines.clear();
   this->dataPtr->rayStrips.clear();
   this->dataPtr->points.clear();
+  this->DestroyGpuPoints();
 }
 
 //////////////////////////////////////////////////
 void Ogre2LidarVisual::SetPoints(const std::vector<double> &_points)
 {
   this->dataPtr->lidarPoints = _points;
+  this->dataPtr->lidarRanges.clear();
+  this->dataPtr->rangesAreFloat = false;
+  this->dataPtr->receivedData = true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2LidarVisual::SetPoints(const float *_ranges, unsigned int _count,
+    unsigned int _stride)
+{
+  auto &ranges = this->dataPtr->lidarRanges;
+  ranges.resize(_count);
+  if (_stride == 1u)
+  {
+    std::copy(_ranges, _ranges + _count, ranges.begin());
+  }
+  else
+  {
+    for (unsigned int i = 0; i < _count; ++i)
+      ranges[i] = _ranges[static_cast<size_t>(i) * _stride];
+  }
+  this->dataPtr->lidarPoints.clear();
+  this->dataPtr->rangesAreFloat = true;
   this->dataPtr->receivedData = true;
 }
 
@@ -212,13 +281,42 @@ void Ogre2LidarVisual::Update()
     return;
   }
 
-  if (!this->dataPtr->receivedData || this->dataPtr->lidarPoints.size() == 0)
+  if (!this->dataPtr->receivedData || this->PointCount() == 0)
   {
     gzwarn << "New lidar data not received. Exiting update function"
             << std::endl;
     return;
   }
 
+  if (this->horizontalCount > 1)
+  {
+    this->horizontalAngleStep =
+        (this->maxHorizontalAngle - this->minHorizontalAngle) /
+              (this->horizontalCount - 1);
+  }
+
+  if (this->verticalCount > 1)
+  {
+    this->verticalAngleStep =
+        (this->maxVerticalAngle - this->minVerticalAngle) /
+              (this->verticalCount - 1);
+  }
+
+  if (this->lidarVisualType == LidarVisualType::LVT_GPU_POINTS)
+  {
+    this->UpdateGpuPoints();
+    return;
+  }
+
+  // the lines and strips below are built from double precision ranges
+  if (this->dataPtr->rangesAreFloat)
+  {
+    this->dataPtr->lidarPoints.assign(this->dataPtr->lidarRanges.begin(),
+        this->dataPtr->lidarRanges.end());
+    this->dataPtr->lidarRanges.clear();
+    this->dataPtr->rangesAreFloat = false;
+  }
+
   bool clearVisuals = false;
 
   if (this->lidarVisualType != this->dataPtr->lidarVisType
@@ -244,20 +342,6 @@ void Ogre2LidarVisual::Update()
   double horizontalAngle = this->minHorizontalAngle;
   double verticalAngle = this->minVerticalAngle;
 
-  if (this->horizontalCount > 1)
-  {
-    this->horizontalAngleStep =
-        (this->maxHorizontalAngle - this->minHorizontalAngle) /
-              (this->horizontalCount - 1);
-  }
-
-  if (this->verticalCount > 1)
-  {
-    this->verticalAngleStep =
-        (this->maxVerticalAngle - this->minVerticalAngle) /
-              (this->verticalCount - 1);
-  }
-
   if (this->dataPtr->lidarPoints.size() !=
                   this->verticalCount * this->horizontalCount)
   {
@@ -505,15 +589,203 @@ void Ogre2LidarVisual::Update()
   this->SetVisible(this->dataPtr->visible);
 }
 
+//////////////////////////////////////////////////
+void Ogre2LidarVisual::UpdateGpuPoints()
+{
+  GZ_PROFILE("Ogre2LidarVisual::UpdateGpuPoints");
+  if (this->dataPtr->lidarVisType != LidarVisualType::LVT_GPU_POINTS)
+  {
+    this->ClearVisualData();
+    this->dataPtr->lidarVisType = LidarVisualType::LVT_GPU_POINTS;
+  }
+  this->dataPtr->receivedData = false;
+
+  const unsigned int count = this->verticalCount * this->horizontalCount;
+  if (this->PointCount() != count)
+  {
+    gzwarn << "Size of lidar data inconsistent with rays."
+            << " Exiting update function."
+            << std::endl;
+    return;
+  }
+
+  // the ray directions only change with the lidar parameters
+  const math::Quaterniond &rot = this->offset.Rot();
+  std::vector<double> key = {
+      static_cast<double>(this->horizontalCount),
+      static_cast<double>(this->verticalCount),
+      this->minHorizontalAngle, this->horizontalAngleStep,
+      this->minVerticalAngle, this->verticalAngleStep,
+      rot.W(), rot.X(), rot.Y(), rot.Z()};
+  if (!this->dataPtr->gpuPointsItem || key != this->dataPtr->gpuDirectionsKey)
+  {
+    this->DestroyGpuPoints();
+    this->dataPtr->gpuDirectionsKey = key;
+    this->CreateGpuPoints();
+    if (!this->dataPtr->gpuPointsItem)
+      return;
+  }
+
+  // upload the ranges, the vertex shader places the points
+  float *ranges = static_cast<float *>(
+      this->dataPtr->gpuRangeBuffer->map(0u, count));
+  if (this->dataPtr->rangesAreFloat)
+  {
+    memcpy(ranges, this->dataPtr->lidarRanges.data(), count * sizeof(float));
+  }
+  else
+  {
+    for (unsigned int i = 0; i < count; ++i)
+      ranges[i] = static_cast<float>(this->dataPtr->lidarPoints[i]);
+  }
+  this->dataPtr->gpuRangeBuffer->unmap(Ogre::UO_KEEP_PERSISTENT);
+
+  // parameters read by the LidarGpuPoint vertex program
+  const math::Vector3d &origin = this->offset.Pos();
+  const math::Color color =
+      this->Scene()->Material("Lidar/BlueRay")->Diffuse();
+  Ogre::SubItem *subItem = this->dataPtr->gpuPointsItem->getSubItem(0);
+  subItem->setCustomParameter(10u, Ogre::Vector4(
+      static_cast<Ogre::Real>(origin.X()),
+      static_cast<Ogre::Real>(origin.Y()),
+      static_cast<Ogre::Real>(origin.Z()),
+      this->displayNonHitting ? 1.0f : 0.0f));
+  subItem->setCustomParameter(11u, Ogre::Vector4(
+      color.R(), color.G(), color.B(), static_cast<Ogre::Real>(this->size)));
+  subItem->setCustomParameter(12u, Ogre::Vector4(
+      static_cast<Ogre::Real>(this->maxRange), 0.0f, 0.0f, 0.0f));
+
+  // all the points lie within max range of the origin
+  if (std::isfinite(this->maxRange))
+  {
+    this->dataPtr->gpuPointsItem->setLocalAabb(Ogre::Aabb(
+        Ogre2Conversions::Convert(origin),
+        Ogre::Vector3(static_cast<Ogre::Real>(this->maxRange))));
+  }
+  else
+  {
+    this->dataPtr->gpuPointsItem->setLocalAabb(Ogre::Aabb::BOX_INFINITE);
+  }
+
+  this->SetVisible(this->dataPtr->visible);
+}
+
+//////////////////////////////////////////////////
+void Ogre2LidarVisual::CreateGpuPoints()
+{
+  if (!this->dataPtr->gpuPointsMat)
+  {
+    gzerr << "LidarGpuPoint material not found, unable to display lidar "
+          << "points on the GPU" << std::endl;
+    return;
+  }
+
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  Ogre::VaoManager *vaoManager =
+      sceneManager->getDestinationRenderSystem()->getVaoManager();
+
+  // direction of every ray, computed as the rays of the other types
+  const unsigned int count = this->verticalCount * this->horizontalCount;
+  std::vector<float> directions(static_cast<size_t>(count) * 3u);
+  double verticalAngle = this->minVerticalAngle;
+  for (unsigned int j = 0; j < this->verticalCount; ++j)
+  {
+    double horizontalAngle = this->minHorizontalAngle;
+    for (unsigned int i = 0; i < this->horizontalCount; ++i)
+    {
+      gz::math::Quaterniond ray(
+        gz::math::Vector3d(0.0, -verticalAngle, horizontalAngle));
+      gz::math::Vector3d axis = this->offset.Rot() * ray *
+        gz::math::Vector3d(1.0, 0.0, 0.0);
+
+      const size_t idx = (static_cast<size_t>(j) * this->horizontalCount + i)
+          * 3u;
+      directions[idx] = static_cast<float>(axis.X());
+      directions[idx + 1] = static_cast<float>(axis.Y());
+      directions[idx + 2] = static_cast<float>(axis.Z());
+      horizontalAngle += this->horizontalAngleStep;
+    }
+    verticalAngle += this->verticalAngleStep;
+  }
+
+  Ogre::VertexElement2Vec directionElements;
+  directionElements.push_back(
+      Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_POSITION));
+  Ogre::VertexBufferPacked *directionBuffer = vaoManager->createVertexBuffer(
+      directionElements, count, Ogre::BT_IMMUTABLE, directions.data(),
+      false);
+
+  Ogre::VertexElement2Vec rangeElements;
+  rangeElements.push_back(
+      Ogre::VertexElement2(Ogre::VET_FLOAT1, Ogre::VES_TEXTURE_COORDINATES));
+  this->dataPtr->gpuRangeBuffer = vaoManager->createVertexBuffer(
+      rangeElements, count, Ogre::BT_DYNAMIC_PERSISTENT, nullptr, false);
+
+  Ogre::VertexBufferPackedVec vertexBuffers;
+  vertexBuffers.push_back(directionBuffer);
+  vertexBuffers.push_back(this->dataPtr->gpuRangeBuffer);
+  Ogre::VertexArrayObject *vao = vaoManager->createVertexArrayObject(
+      vertexBuffers, nullptr, Ogre::OT_POINT_LIST);
+
+  static unsigned int gpuPointsId = 0u;
+  this->dataPtr->gpuPointsMesh = Ogre::MeshManager::getSingleton().createManual(
+      "lidar_gpu_points_" + std::to_string(gpuPointsId++),
+      Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+  Ogre::SubMesh *subMesh = this->dataPtr->gpuPointsMesh->createSubMesh();
+  subMesh->mVao[Ogre::VpNormal].push_back(vao);
+  subMesh->mVao[Ogre::VpShadow].push_back(vao);
+  this->dataPtr->gpuPointsMesh->_setBounds(Ogre::Aabb::BOX_INFINITE, false);
+
+  this->dataPtr->gpuPointsItem = sceneManager->createItem(
+      this->dataPtr->gpuPointsMesh, Ogre::SCENE_DYNAMIC);
+  this->dataPtr->gpuPointsItem->setCastShadows(false);
+  this->dataPtr->gpuPointsItem->getSubItem(0)->setMaterial(
+      this->dataPtr->gpuPointsMat);
+  this->ogreNode->attachObject(this->dataPtr->gpuPointsItem);
+}
+
+//////////////////////////////////////////////////
+void Ogre2LidarVisual::DestroyGpuPoints()
+{
+  if (this->dataPtr->gpuPointsItem)
+  {
+    this->scene->OgreSceneManager()->destroyItem(
+        this->dataPtr->gpuPointsItem);
+    this->dataPtr->gpuPointsItem = nullptr;
+  }
+
+  if (this->dataPtr->gpuPointsMesh)
+  {
+    Ogre::VaoManager *vaoManager = this->scene->OgreSceneManager()->
+        getDestinationRenderSystem()->getVaoManager();
+    Ogre::SubMesh *subMesh = this->dataPtr->gpuPointsMesh->getSubMesh(0);
+    subMesh->destroyVaos(subMesh->mVao[Ogre::VpNormal], vaoManager);
+    subMesh->mVao[Ogre::VpShadow].clear();
+    Ogre::MeshManager::getSingleton().remove(
+        this->dataPtr->gpuPointsMesh->getName());
+    this->dataPtr->gpuPointsMesh.reset();
+  }
+
+  this->dataPtr->gpuRangeBuffer = nullptr;
+  this->dataPtr->gpuDirectionsKey.clear();
+}
+
 //////////////////////////////////////////////////
 unsigned int Ogre2LidarVisual::PointCount() const
 {
+  if (this->dataPtr->rangesAreFloat)
+    return this->dataPtr->lidarRanges.size();
   return this->dataPtr->lidarPoints.size();
 }
 
 //////////////////////////////////////////////////
 std::vector<double> Ogre2LidarVisual::Points() const
 {
+  if (this->dataPtr->rangesAreFloat)
+  {
+    return std::vector<double>(this->dataPtr->lidarRanges.begin(),
+        this->dataPtr->lidarRanges.end());
+  }
   return this->dataPtr->lidarPoints;
 }
 
@@ -294,6 +294,13 @@ void Ogre2Marker::SetPoint(unsigned int _index,
   this->dataPtr->dynamicRenderable->SetPoint(_index, _value);
 }
 
+//////////////////////////////////////////////////
+void Ogre2Marker::SetPoints(const float *_points, size_t _count,
+    const math::Color &_color)
+{
+  this->dataPtr->dynamicRenderable->SetPoints(_points, _count, _color);
+}
+
 //////////////////////////////////////////////////
 void Ogre2Marker::AddPoint(const math::Vector3d &_pt,
     const math::Color &_color)
@@ -38,8 +38,12 @@
 #include "gz/rendering/ogre2/Ogre2Conversions.hh"
 #include "gz/rendering/ogre2/Ogre2Mesh.hh"
 #include "gz/rendering/ogre2/Ogre2Material.hh"
+#include "gz/rendering/ogre2/Ogre2MeshFactory.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/ogre2/Ogre2Storage.hh"
 
+#include "Ogre2MeshBvh.hh"
+
 /// brief Private implementation of the Ogre2Mesh class
 class gz::rendering::Ogre2MeshPrivate
 {
@@ -96,6 +100,66 @@ void Ogre2Mesh::Destroy()
   this->material.reset();
 }
 
+//////////////////////////////////////////////////
+bool Ogre2Mesh::IsLoaded() const
+{
+  return this->loaded;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Mesh::ReplaceOgreItem(Ogre::Item *_item,
+    const std::string &_meshName)
+{
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  Ogre::Item *oldItem = this->ogreItem;
+  Ogre::SceneNode *ogreNode = oldItem->getParentSceneNode();
+  const bool isStatic = oldItem->isStatic();
+
+  // carry over what the visual set on the item when attaching it
+  _item->getUserObjectBindings().setUserAny(
+      oldItem->getUserObjectBindings().getUserAny());
+  _item->setName(oldItem->getName());
+  _item->setVisibilityFlags(oldItem->getVisibilityFlags());
+  _item->setCastShadows(oldItem->getCastShadows());
+  _item->setRenderQueueGroup(oldItem->getRenderQueueGroup());
+  _item->setVisible(oldItem->getVisible());
+
+  if (ogreNode)
+  {
+    if (isStatic)
+      oldItem->setStatic(false);
+    ogreNode->detachObject(oldItem);
+  }
+
+  // items must be destroyed before the materials of their submeshes
+  ogreScene->OgreSceneManager()->destroyItem(oldItem);
+  this->SubMeshes()->DestroyAll();
+
+  this->ogreItem = _item;
+  Ogre2SubMeshStoreFactory subMeshFactory(ogreScene, this->ogreItem);
+  this->subMeshes = subMeshFactory.Create();
+  for (unsigned int i = 0; i < this->subMeshes->Size(); ++i)
+  {
+    Ogre2SubMeshPtr subMesh = std::dynamic_pointer_cast<Ogre2SubMesh>(
+        this->subMeshes->GetById(i));
+    subMesh->SetMeshName(_meshName);
+  }
+
+  // this only sets the material on the new submeshes if it is unchanged
+  if (this->material)
+    this->SetMaterial(this->material, false);
+
+  if (ogreNode)
+  {
+    ogreNode->attachObject(this->ogreItem);
+    if (isStatic)
+    {
+      this->ogreItem->setStatic(true);
+      ogreScene->OgreSceneManager()->notifyStaticDirty(ogreNode);
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 bool Ogre2Mesh::HasSkeleton() const
 {
@@ -319,6 +383,7 @@ void Ogre2SubMesh::Destroy()
         {
           Ogre::v1::MeshManager::getSingleton().remove(
             this->dataPtr->subMeshName);
+          this->scene->MeshBvhCache().Remove(this->dataPtr->subMeshName);
           Ogre::MeshManager::getSingleton().remove(this->dataPtr->subMeshName);
           break;
         }
@@ -0,0 +1,452 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <gz/common/Console.hh>
+#include <gz/common/MeshManager.hh>
+#include <gz/common/Profiler.hh>
+#include <gz/common/SubMesh.hh>
+
+#include "Ogre2MeshBvh.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreMeshManager2.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Maximum number of triangles in a leaf
+static constexpr size_t kLeafSize = 4u;
+
+/// \brief Capacity of the traversal stack. Every node splits its largest
+/// range in halves first, so a node at depth d holds at most 1 / 2^(d-1) of
+/// the triangles and the depth stays below 33 for any mesh whose leaves fit
+/// the int32_t child indices. Up to three siblings are pushed per level.
+static constexpr size_t kStackSize = 128u;
+
+//////////////////////////////////////////////////
+Ogre2MeshBvh::Ogre2MeshBvh(const common::Mesh &_mesh)
+{
+  GZ_PROFILE("Ogre2MeshBvh::Ogre2MeshBvh");
+  for (unsigned int i = 0; i < _mesh.SubMeshCount(); ++i)
+  {
+    auto submesh = _mesh.SubMeshByIndex(i).lock();
+    if (!submesh || submesh->VertexCount() < 3u)
+      continue;
+
+    const unsigned int vertexCount = submesh->VertexCount();
+    const unsigned int indexCount = submesh->IndexCount();
+    const math::Vector3d *vertices = submesh->VertexPtr();
+    const unsigned int *indices = submesh->IndexPtr();
+
+    this->buildTriangles.reserve(
+        this->buildTriangles.size() + indexCount / 3u);
+    for (unsigned int k = 0; k + 2u < indexCount; k += 3u)
+    {
+      if (indices[k] >= vertexCount || indices[k + 1u] >= vertexCount ||
+          indices[k + 2u] >= vertexCount)
+      {
+        continue;
+      }
+
+      BuildTriangle tri;
+      for (unsigned int v = 0; v < 3u; ++v)
+      {
+        const math::Vector3d &vertex = vertices[indices[k + v]];
+        for (unsigned int c = 0; c < 3u; ++c)
+          tri.v[v][c] = static_cast<float>(vertex[c]);
+      }
+      for (unsigned int c = 0; c < 3u; ++c)
+      {
+        tri.min[c] = std::min({tri.v[0][c], tri.v[1][c], tri.v[2][c]});
+        tri.max[c] = std::max({tri.v[0][c], tri.v[1][c], tri.v[2][c]});
+        tri.centroid[c] = (tri.v[0][c] + tri.v[1][c] + tri.v[2][c]) / 3.0f;
+      }
+      this->buildTriangles.push_back(tri);
+    }
+  }
+
+  this->triangleCount = this->buildTriangles.size();
+  if (this->triangleCount == 0u)
+    return;
+
+  if (this->triangleCount <= kLeafSize)
+    this->root = this->BuildLeaf(0u, this->triangleCount);
+  else
+    this->root = this->BuildNode(0u, this->triangleCount, 1u);
+
+  if (3u * this->maxDepth + 2u > kStackSize)
+  {
+    gzerr << "Mesh BVH of depth " << this->maxDepth << " exceeds the "
+          << "traversal stack, ray queries will miss the mesh" << std::endl;
+    this->root = kEmpty;
+  }
+
+  // the triangles now live in the leaves
+  std::vector<BuildTriangle>().swap(this->buildTriangles);
+}
+
+//////////////////////////////////////////////////
+int32_t Ogre2MeshBvh::BuildNode(size_t _begin, size_t _end,
+    unsigned int _depth)
+{
+  this->maxDepth = std::max(this->maxDepth, _depth);
+
+  // split the range in up to four children, always splitting the largest
+  // range in two halves along the longest axis of its centroids
+  std::pair<size_t, size_t> ranges[4];
+  size_t rangeCount = 1u;
+  ranges[0] = {_begin, _end};
+  while (rangeCount < 4u)
+  {
+    size_t largest = 0u;
+    for (size_t i = 1u; i < rangeCount; ++i)
+    {
+      if (ranges[i].second - ranges[i].first >
+          ranges[largest].second - ranges[largest].first)
+      {
+        largest = i;
+      }
+    }
+
+    const size_t begin = ranges[largest].first;
+    const size_t end = ranges[largest].second;
+    if (end - begin <= kLeafSize)
+      break;
+
+    float cmin[3];
+    float cmax[3];
+    for (unsigned int c = 0; c < 3u; ++c)
+    {
+      cmin[c] = std::numeric_limits<float>::max();
+      cmax[c] = std::numeric_limits<float>::lowest();
+    }
+    for (size_t t = begin; t < end; ++t)
+    {
+      for (unsigned int c = 0; c < 3u; ++c)
+      {
+        cmin[c] = std::min(cmin[c], this->buildTriangles[t].centroid[c]);
+        cmax[c] = std::max(cmax[c], this->buildTriangles[t].centroid[c]);
+      }
+    }
+    unsigned int axis = 0u;
+    if (cmax[1] - cmin[1] > cmax[axis] - cmin[axis])
+      axis = 1u;
+    if (cmax[2] - cmin[2] > cmax[axis] - cmin[axis])
+      axis = 2u;
+
+    const size_t mid = begin + (end - begin) / 2u;
+    std::nth_element(this->buildTriangles.begin() + begin,
+        this->buildTriangles.begin() + mid,
+        this->buildTriangles.begin() + end,
+        [axis](const BuildTriangle &_a, const BuildTriangle &_b)
+        {
+          return _a.centroid[axis] < _b.centroid[axis];
+        });
+
+    ranges[largest] = {begin, mid};
+    ranges[rangeCount++] = {mid, end};
+  }
+
+  const int32_t index = static_cast<int32_t>(this->nodes.size());
+  this->nodes.emplace_back();
+
+  // the node is stored after its children are built, building them grows
+  // the node array
+  Node node;
+  for (size_t i = 0u; i < 4u; ++i)
+  {
+    node.minX[i] = node.minY[i] = node.minZ[i] = 0.0f;
+    node.maxX[i] = node.maxY[i] = node.maxZ[i] = 0.0f;
+    node.child[i] = kEmpty;
+    if (i >= rangeCount)
+      continue;
+
+    const size_t begin = ranges[i].first;
+    const size_t end = ranges[i].second;
+    float bmin[3];
+    float bmax[3];
+    for (unsigned int c = 0; c < 3u; ++c)
+    {
+      bmin[c] = std::numeric_limits<float>::max();
+      bmax[c] = std::numeric_limits<float>::lowest();
+    }
+    for (size_t t = begin; t < end; ++t)
+    {
+      for (unsigned int c = 0; c < 3u; ++c)
+      {
+        bmin[c] = std::min(bmin[c], this->buildTriangles[t].min[c]);
+        bmax[c] = std::max(bmax[c], this->buildTriangles[t].max[c]);
+      }
+    }
+    node.minX[i] = bmin[0];
+    node.minY[i] = bmin[1];
+    node.minZ[i] = bmin[2];
+    node.maxX[i] = bmax[0];
+    node.maxY[i] = bmax[1];
+    node.maxZ[i] = bmax[2];
+
+    if (end - begin <= kLeafSize)
+      node.child[i] = this->BuildLeaf(begin, end);
+    else
+      node.child[i] = this->BuildNode(begin, end, _depth + 1u);
+  }
+  this->nodes[index] = node;
+
+  return index;
+}
+
+//////////////////////////////////////////////////
+int32_t Ogre2MeshBvh::BuildLeaf(size_t _begin, size_t _end)
+{
+  Leaf leaf;
+  for (size_t i = 0u; i < kLeafSize; ++i)
+  {
+    const bool used = _begin + i < _end;
+    for (unsigned int c = 0; c < 3u; ++c)
+    {
+      if (used)
+      {
+        const BuildTriangle &tri = this->buildTriangles[_begin + i];
+        leaf.v0[c][i] = tri.v[0][c];
+        leaf.e1[c][i] = tri.v[1][c] - tri.v[0][c];
+        leaf.e2[c][i] = tri.v[2][c] - tri.v[0][c];
+      }
+      else
+      {
+        leaf.v0[c][i] = 0.0f;
+        leaf.e1[c][i] = 0.0f;
+        leaf.e2[c][i] = 0.0f;
+      }
+    }
+  }
+
+  this->leaves.push_back(leaf);
+  return -static_cast<int32_t>(this->leaves.size());
+}
+
+//////////////////////////////////////////////////
+bool Ogre2MeshBvh::Intersect(const Ogre::Ray &_ray,
+    Ogre::Real &_distance) const
+{
+  if (this->root == kEmpty)
+    return false;
+
+  const Ogre::Vector3 &rayOrigin = _ray.getOrigin();
+  const Ogre::Vector3 &rayDir = _ray.getDirection();
+  const float o[3] = {static_cast<float>(rayOrigin.x),
+                      static_cast<float>(rayOrigin.y),
+                      static_cast<float>(rayOrigin.z)};
+  const float d[3] = {static_cast<float>(rayDir.x),
+                      static_cast<float>(rayDir.y),
+                      static_cast<float>(rayDir.z)};
+
+  // avoid 0 * inf = NaN in the slab test for axis aligned rays
+  float invD[3];
+  for (unsigned int c = 0; c < 3u; ++c)
+  {
+    const float dc = std::abs(d[c]) > 1e-30f ? d[c] :
+        (std::signbit(d[c]) ? -1e-30f : 1e-30f);
+    invD[c] = 1.0f / dc;
+  }
+
+  float best = static_cast<float>(_distance);
+  bool hit = false;
+
+  // up to three siblings are pushed per level, nearest child popped first.
+  // The depth was checked against the capacity when building.
+  std::pair<int32_t, float> stack[kStackSize];
+  size_t stackSize = 0u;
+  stack[stackSize++] = {this->root, 0.0f};
+
+  while (stackSize > 0u)
+  {
+    --stackSize;
+    const int32_t child = stack[stackSize].first;
+    const float entry = stack[stackSize].second;
+    if (entry >= best)
+      continue;
+
+    if (child < 0)
+    {
+      // Moller-Trumbore on four triangles at once, front faces only
+      const Leaf &leaf = this->leaves[static_cast<size_t>(-child - 1)];
+      float t[4];
+      for (unsigned int i = 0; i < 4u; ++i)
+      {
+        const float px = d[1] * leaf.e2[2][i] - d[2] * leaf.e2[1][i];
+        const float py = d[2] * leaf.e2[0][i] - d[0] * leaf.e2[2][i];
+        const float pz = d[0] * leaf.e2[1][i] - d[1] * leaf.e2[0][i];
+        const float det =
+            leaf.e1[0][i] * px + leaf.e1[1][i] * py + leaf.e1[2][i] * pz;
+        const bool front = det > std::numeric_limits<float>::epsilon();
+        const float invDet = front ? 1.0f / det : 0.0f;
+
+        const float sx = o[0] - leaf.v0[0][i];
+        const float sy = o[1] - leaf.v0[1][i];
+        const float sz = o[2] - leaf.v0[2][i];
+        const float u = (sx * px + sy * py + sz * pz) * invDet;
+
+        const float qx = sy * leaf.e1[2][i] - sz * leaf.e1[1][i];
+        const float qy = sz * leaf.e1[0][i] - sx * leaf.e1[2][i];
+        const float qz = sx * leaf.e1[1][i] - sy * leaf.e1[0][i];
+        const float v = (d[0] * qx + d[1] * qy + d[2] * qz) * invDet;
+        const float dist = (leaf.e2[0][i] * qx + leaf.e2[1][i] * qy +
+            leaf.e2[2][i] * qz) * invDet;
+
+        const bool inside = front && u >= 0.0f && v >= 0.0f &&
+            u + v <= 1.0f && dist >= 0.0f;
+        t[i] = inside ? dist : std::numeric_limits<float>::max();
+      }
+      for (unsigned int i = 0; i < 4u; ++i)
+      {
+        if (t[i] < best)
+        {
+          best = t[i];
+          hit = true;
+        }
+      }
+      continue;
+    }
+
+    // slab test of the ray against the four child boxes at once
+    const Node &node = this->nodes[static_cast<size_t>(child)];
+    float tNear[4];
+    bool boxHit[4];
+    for (unsigned int i = 0; i < 4u; ++i)
+    {
+      const float tx0 = (node.minX[i] - o[0]) * invD[0];
+      const float tx1 = (node.maxX[i] - o[0]) * invD[0];
+      const float ty0 = (node.minY[i] - o[1]) * invD[1];
+      const float ty1 = (node.maxY[i] - o[1]) * invD[1];
+      const float tz0 = (node.minZ[i] - o[2]) * invD[2];
+      const float tz1 = (node.maxZ[i] - o[2]) * invD[2];
+      const float tmin = std::max(std::max(std::min(tx0, tx1),
+          std::min(ty0, ty1)), std::max(std::min(tz0, tz1), 0.0f));
+      const float tmax = std::min(std::min(std::max(tx0, tx1),
+          std::max(ty0, ty1)), std::min(std::max(tz0, tz1), best));
+      tNear[i] = tmin;
+      boxHit[i] = tmin <= tmax;
+    }
+
+    // push the farthest child first so the nearest one is visited first
+    std::pair<int32_t, float> hits[4];
+    unsigned int hitCount = 0u;
+    for (unsigned int i = 0; i < 4u; ++i)
+    {
+      if (!boxHit[i] || node.child[i] == kEmpty)
+        continue;
+      unsigned int j = hitCount++;
+      while (j > 0u && hits[j - 1u].second < tNear[i])
+      {
+        hits[j] = hits[j - 1u];
+        --j;
+      }
+      hits[j] = {node.child[i], tNear[i]};
+    }
+    for (unsigned int i = 0; i < hitCount; ++i)
+      stack[stackSize++] = hits[i];
+  }
+
+  if (hit)
+    _distance = best;
+  return hit;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2MeshBvh::TriangleCount() const
+{
+  return this->triangleCount;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2MeshBvh::NodeCount() const
+{
+  return this->nodes.size();
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<const Ogre2MeshBvh> Ogre2MeshBvhCache::Bvh(
+    const Ogre::Mesh &_ogreMesh, const common::Mesh *&_mesh)
+{
+  {
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    auto it = this->entries.find(_ogreMesh.getHandle());
+    if (it != this->entries.end())
+    {
+      _mesh = it->second.mesh;
+      return it->second.bvh;
+    }
+  }
+
+  // resolve the mesh and build the hierarchy outside of the lock, so that
+  // lookups of other meshes are not blocked
+  Entry entry;
+  entry.mesh =
+      common::MeshManager::Instance()->MeshByName(MeshName(_ogreMesh));
+  if (entry.mesh)
+    entry.bvh = std::make_shared<const Ogre2MeshBvh>(*entry.mesh);
+
+  std::unique_lock<std::shared_mutex> lock(this->mutex);
+  // another thread may have built it in the meantime
+  auto it = this->entries.emplace(_ogreMesh.getHandle(),
+      std::move(entry)).first;
+  _mesh = it->second.mesh;
+  return it->second.bvh;
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshBvhCache::Remove(const std::string &_ogreMeshName)
+{
+  Ogre::MeshPtr ogreMesh =
+      Ogre::MeshManager::getSingleton().getByName(_ogreMeshName);
+  if (!ogreMesh)
+    return;
+
+  std::unique_lock<std::shared_mutex> lock(this->mutex);
+  this->entries.erase(ogreMesh->getHandle());
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshBvhCache::Clear()
+{
+  std::unique_lock<std::shared_mutex> lock(this->mutex);
+  this->entries.clear();
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2MeshBvhCache::MeshName(const Ogre::Mesh &_ogreMesh)
+{
+  // mesh factory creates name with ::CENTER or ::ORIGINAL depending on
+  // the params passed in the MeshDescriptor when loading the mesh
+  // so strip off the suffix
+  std::string meshName = _ogreMesh.getName();
+  size_t idx = meshName.find("::");
+  if (idx != std::string::npos)
+    meshName.resize(idx);
+  return meshName;
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2MESHBVH_HH_
+#define GZ_RENDERING_OGRE2_OGRE2MESHBVH_HH_
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gz/common/Mesh.hh>
+
+#include "gz/rendering/config.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreMesh2.h>
+#include <OgreRay.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Bounding volume hierarchy over the triangles of a common::Mesh,
+    /// used by Ogre2RayQuery to find the closest triangle hit by a ray
+    /// without testing every triangle of the mesh.
+    ///
+    /// Every node stores the bounds of up to four children and every leaf
+    /// up to four triangles, both laid out as structures of arrays so the
+    /// four ray/box and the four ray/triangle tests of a node run as a
+    /// single loop the compiler vectorizes.
+    ///
+    /// The hierarchy is immutable once built, so one instance can be
+    /// traversed by several threads at the same time.
+    class Ogre2MeshBvh
+    {
+      /// \brief Build the hierarchy over all the triangles of all the
+      /// submeshes of a mesh, in mesh space
+      /// \param[in] _mesh Mesh to build the hierarchy for
+      public: explicit Ogre2MeshBvh(const common::Mesh &_mesh);
+
+      /// \brief Find the closest front facing triangle hit by a ray.
+      /// Back faces are ignored, as Ogre::Math::intersects does when
+      /// asked for the positive side only.
+      /// \param[in] _ray Ray in mesh space
+      /// \param[in, out] _distance Hits farther than this value are ignored.
+      /// Set to the distance to the closest hit along the ray.
+      /// \return True if a triangle closer than _distance was hit
+      public: bool Intersect(const Ogre::Ray &_ray,
+                             Ogre::Real &_distance) const;
+
+      /// \brief Get the number of triangles in the hierarchy
+      /// \return Number of triangles
+      public: size_t TriangleCount() const;
+
+      /// \brief Get the number of internal nodes in the hierarchy
+      /// \return Number of internal nodes
+      public: size_t NodeCount() const;
+
+      /// \brief Triangle data used while building the hierarchy
+      private: struct BuildTriangle
+      {
+        /// \brief Triangle vertices
+        float v[3][3];
+
+        /// \brief Triangle bounds
+        float min[3];
+
+        /// \brief Triangle bounds
+        float max[3];
+
+        /// \brief Triangle centroid
+        float centroid[3];
+      };
+
+      /// \brief Internal node with up to four children.
+      /// A child index >= 0 refers to a node, a negative index i refers to
+      /// the leaf -i - 1 and kEmpty marks an unused slot.
+      private: struct alignas(16) Node
+      {
+        /// \brief Child bounds, one array per component
+        float minX[4];
+
+        /// \brief Child bounds, one array per component
+        float minY[4];
+
+        /// \brief Child bounds, one array per component
+        float minZ[4];
+
+        /// \brief Child bounds, one array per component
+        float maxX[4];
+
+        /// \brief Child bounds, one array per component
+        float maxY[4];
+
+        /// \brief Child bounds, one array per component
+        float maxZ[4];
+
+        /// \brief Child indices
+        int32_t child[4];
+      };
+
+      /// \brief Leaf with up to four triangles, stored as a vertex and two
+      /// edges as needed by the Moller-Trumbore test. Unused slots have
+      /// zero edges and are never hit.
+      private: struct alignas(16) Leaf
+      {
+        /// \brief First vertex, one array per component
+        float v0[3][4];
+
+        /// \brief Edge from the first to the second vertex
+        float e1[3][4];
+
+        /// \brief Edge from the first to the third vertex
+        float e2[3][4];
+      };
+
+      /// \brief Recursively build the node holding a range of triangles
+      /// \param[in] _begin First triangle of the range
+      /// \param[in] _end One past the last triangle of the range
+      /// \param[in] _depth Depth of the node
+      /// \return Index of the node
+      private: int32_t BuildNode(size_t _begin, size_t _end,
+                                 unsigned int _depth);
+
+      /// \brief Build the leaf holding a range of up to four triangles
+      /// \param[in] _begin First triangle of the range
+      /// \param[in] _end One past the last triangle of the range
+      /// \return Child index encoding the leaf
+      private: int32_t BuildLeaf(size_t _begin, size_t _end);
+
+      /// \brief Marks an unused child slot
+      private: static constexpr int32_t kEmpty = INT32_MIN;
+
+      /// \brief Internal nodes, the root is the first one
+      private: std::vector<Node> nodes;
+
+      /// \brief Leaves
+      private: std::vector<Leaf> leaves;
+
+      /// \brief Triangles, only used while building
+      private: std::vector<BuildTriangle> buildTriangles;
+
+      /// \brief Child index of the root: a node, a leaf or kEmpty
+      private: int32_t root = kEmpty;
+
+      /// \brief Number of triangles
+      private: size_t triangleCount = 0u;
+
+      /// \brief Depth of the deepest node, bounds the traversal stack
+      private: unsigned int maxDepth = 0u;
+    };
+
+    /// \brief Hierarchies of the meshes picked by ray queries, built the
+    /// first time a mesh is queried. Ogre meshes are matched to the
+    /// common::Mesh they were created from once, and the hierarchy is kept
+    /// until the ogre mesh is removed, see Remove. Thread safe.
+    class Ogre2MeshBvhCache
+    {
+      /// \brief Get the hierarchy of the common::Mesh an ogre mesh was
+      /// created from, building it if needed
+      /// \param[in] _ogreMesh Ogre mesh
+      /// \param[out] _mesh Set to the common::Mesh the ogre mesh was
+      /// created from, or null
+      /// \return The hierarchy, or null if the ogre mesh was not created
+      /// from a mesh in common::MeshManager
+      public: std::shared_ptr<const Ogre2MeshBvh> Bvh(
+                  const Ogre::Mesh &_ogreMesh, const common::Mesh *&_mesh);
+
+      /// \brief Drop the hierarchy of an ogre mesh. Must be called before
+      /// the ogre mesh is removed from the ogre mesh manager, so that a mesh
+      /// loaded again under the same name gets a new hierarchy.
+      /// \param[in] _ogreMeshName Name of the ogre mesh
+      public: void Remove(const std::string &_ogreMeshName);
+
+      /// \brief Drop all the hierarchies
+      public: void Clear();
+
+      /// \brief Get the name in common::MeshManager of the mesh an ogre mesh
+      /// was created from
+      /// \param[in] _ogreMesh Ogre mesh
+      /// \return Name of the common::Mesh
+      public: static std::string MeshName(const Ogre::Mesh &_ogreMesh);
+
+      /// \brief Cached hierarchy of a mesh
+      private: struct Entry
+      {
+        /// \brief Mesh the hierarchy was built from, null if the ogre mesh
+        /// was not created from a mesh in common::MeshManager
+        const common::Mesh *mesh = nullptr;
+
+        /// \brief The hierarchy
+        std::shared_ptr<const Ogre2MeshBvh> bvh;
+      };
+
+      /// \brief Entries indexed by ogre resource handle, which unlike the
+      /// address of the ogre mesh is never reused
+      private: std::unordered_map<Ogre::ResourceHandle, Entry> entries;
+
+      /// \brief Protects entries. Lookups of cached entries only take a
+      /// shared lock.
+      private: std::shared_mutex mutex;
+    };
+    }
+  }
+}
+#endif
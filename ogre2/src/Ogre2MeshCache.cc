@@ -0,0 +1,393 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <system_error>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/Mesh.hh>
+#include <gz/common/Profiler.hh>
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Vao/OgreVaoManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+#include "Ogre2MeshCache.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Identifies the entries of the cache, "GZMC"
+static constexpr uint32_t kCacheMagic = 0x434d5a47u;
+
+/// \brief Version of the entries. Bump it whenever the packed layout or the
+/// file format changes so that older entries are ignored.
+static constexpr uint32_t kCacheVersion = 1u;
+
+/// \brief Most submeshes and vertex elements read from an entry, larger
+/// counts mean the entry is corrupted
+static constexpr uint32_t kMaxSubMeshes = 1u << 20;
+static constexpr uint32_t kMaxVertexElements = 32u;
+
+/// \brief Incremental 64 bit hash of the source file and options of a mesh.
+/// It only has to tell meshes apart, it is not meant to resist collisions
+/// crafted on purpose.
+class Ogre2MeshHash
+{
+  /// \brief Add bytes to the hash
+  /// \param[in] _data Bytes to add
+  /// \param[in] _size Number of bytes
+  public: void Add(const void *_data, size_t _size)
+  {
+    const uint8_t *bytes = static_cast<const uint8_t *>(_data);
+    size_t i = 0u;
+    for (; i + 8u <= _size; i += 8u)
+    {
+      uint64_t word;
+      std::memcpy(&word, bytes + i, 8u);
+      this->AddWord(word);
+    }
+    if (i < _size)
+    {
+      uint64_t word = 0u;
+      std::memcpy(&word, bytes + i, _size - i);
+      this->AddWord(word);
+    }
+    this->length += _size;
+  }
+
+  /// \brief Add a value to the hash
+  /// \param[in] _value Value to add
+  public: template <typename T> void Add(const T &_value)
+  {
+    this->Add(&_value, sizeof(T));
+  }
+
+  /// \brief Get the hash of the data added so far
+  /// \return The hash
+  public: uint64_t Value() const
+  {
+    uint64_t h = this->state ^ this->length;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+  }
+
+  /// \brief Mix a word into the state, as MurmurHash3 does
+  /// \param[in] _word Word to mix
+  private: void AddWord(uint64_t _word)
+  {
+    _word *= 0x87c37b91114253d5ull;
+    _word = (_word << 31) | (_word >> 33);
+    _word *= 0x4cf5ad432745937full;
+    this->state ^= _word;
+    this->state = (this->state << 27) | (this->state >> 37);
+    this->state = this->state * 5u + 0x52dce729u;
+  }
+
+  /// \brief Hash state
+  private: uint64_t state = 0x9e3779b97f4a7c15ull;
+
+  /// \brief Number of bytes added
+  private: uint64_t length = 0u;
+};
+
+/// \brief Get the path of an entry
+/// \param[in] _key Key of the entry
+/// \return Path of the entry file
+static std::string EntryPath(uint64_t _key)
+{
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << _key << ".gzmesh";
+  return common::joinPaths(Ogre2MeshCache::Directory(), ss.str());
+}
+
+/// \brief Read a value from an entry
+/// \param[in] _file Entry file
+/// \param[out] _value Value read
+/// \return True if the value could be read
+template <typename T>
+static bool ReadValue(std::istream &_file, T &_value)
+{
+  return static_cast<bool>(
+      _file.read(reinterpret_cast<char *>(&_value), sizeof(T)));
+}
+
+/// \brief Write a value to an entry
+/// \param[in] _file Entry file
+/// \param[in] _value Value to write
+template <typename T>
+static void WriteValue(std::ostream &_file, const T &_value)
+{
+  _file.write(reinterpret_cast<const char *>(&_value), sizeof(T));
+}
+
+//////////////////////////////////////////////////
+const std::string &Ogre2MeshCache::Directory()
+{
+  static const std::string directory = []
+  {
+    const char *env = std::getenv("GZ_RENDERING_OGRE2_MESH_CACHE_PATH");
+    return std::string(env ? env : "");
+  }();
+  return directory;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2MeshCache::SourceFile(const common::Mesh &_mesh)
+{
+  // common::MeshManager names meshes after the file they were loaded from,
+  // as given, and sets their path to the directory the file was found in
+  if (common::isFile(_mesh.Name()))
+    return common::absPath(_mesh.Name());
+
+  const std::string path =
+      common::joinPaths(_mesh.Path(), common::basename(_mesh.Name()));
+  if (!_mesh.Path().empty() && common::isFile(path))
+    return common::absPath(path);
+  return std::string();
+}
+
+//////////////////////////////////////////////////
+std::optional<uint64_t> Ogre2MeshCache::Key(const MeshDescriptor &_desc)
+{
+  GZ_PROFILE("Ogre2MeshCache::Key");
+  const std::string path = SourceFile(*_desc.mesh);
+  if (path.empty())
+    return std::nullopt;
+
+  std::error_code ec;
+  const auto size = std::filesystem::file_size(path, ec);
+  if (ec)
+    return std::nullopt;
+  const auto modified = std::filesystem::last_write_time(path, ec);
+  if (ec)
+    return std::nullopt;
+
+  Ogre2MeshHash hash;
+  hash.Add(kCacheVersion);
+  hash.Add(path.size());
+  hash.Add(path.data(), path.size());
+  hash.Add(static_cast<uint64_t>(size));
+  hash.Add(static_cast<int64_t>(modified.time_since_epoch().count()));
+  hash.Add(_desc.centerSubMesh);
+  hash.Add(_desc.compressVertices);
+  hash.Add(_desc.subMeshName.size());
+  hash.Add(_desc.subMeshName.data(), _desc.subMeshName.size());
+  return hash.Value();
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<Ogre2PackedMesh> Ogre2MeshCache::Read(uint64_t _key)
+{
+  GZ_PROFILE("Ogre2MeshCache::Read");
+  const std::string path = EntryPath(_key);
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file)
+    return nullptr;
+  const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+  file.seekg(0);
+
+  auto packed = std::make_shared<Ogre2PackedMesh>();
+  auto invalid = [&path]
+  {
+    gzwarn << "Ignoring invalid mesh cache entry [" << path << "]"
+           << std::endl;
+    return nullptr;
+  };
+
+  uint32_t magic = 0u;
+  uint32_t version = 0u;
+  uint64_t key = 0u;
+  if (!ReadValue(file, magic) || !ReadValue(file, version) ||
+      !ReadValue(file, key) || magic != kCacheMagic || key != _key)
+  {
+    return invalid();
+  }
+
+  // entries of older versions are left to be overwritten
+  if (version != kCacheVersion)
+    return nullptr;
+
+  float bounds[7];
+  uint32_t subMeshCount = 0u;
+  if (!ReadValue(file, bounds) || !ReadValue(file, subMeshCount) ||
+      subMeshCount > kMaxSubMeshes)
+  {
+    return invalid();
+  }
+  packed->bounds = Ogre::Aabb(Ogre::Vector3(bounds[0], bounds[1], bounds[2]),
+      Ogre::Vector3(bounds[3], bounds[4], bounds[5]));
+  packed->radius = bounds[6];
+
+  packed->subMeshes.resize(subMeshCount);
+  for (Ogre2PackedSubMesh &subMesh : packed->subMeshes)
+  {
+    uint32_t operationType = 0u;
+    uint32_t elementCount = 0u;
+    if (!ReadValue(file, operationType) || !ReadValue(file, elementCount) ||
+        elementCount > kMaxVertexElements)
+    {
+      return invalid();
+    }
+    subMesh.operationType = static_cast<Ogre::OperationType>(operationType);
+    for (uint32_t e = 0u; e < elementCount; ++e)
+    {
+      uint32_t type = 0u;
+      uint32_t semantic = 0u;
+      if (!ReadValue(file, type) || !ReadValue(file, semantic))
+        return invalid();
+      subMesh.vertexElements.push_back(Ogre::VertexElement2(
+          static_cast<Ogre::VertexElementType>(type),
+          static_cast<Ogre::VertexElementSemantic>(semantic)));
+    }
+
+    uint64_t vertexCount = 0u;
+    uint64_t vertexBytes = 0u;
+    if (!ReadValue(file, vertexCount) || !ReadValue(file, vertexBytes) ||
+        vertexBytes > fileSize || vertexBytes != vertexCount *
+        Ogre::VaoManager::calculateVertexSize(subMesh.vertexElements))
+    {
+      return invalid();
+    }
+    subMesh.vertexCount = vertexCount;
+    subMesh.vertices.resize(vertexBytes);
+    if (!file.read(reinterpret_cast<char *>(subMesh.vertices.data()),
+        static_cast<std::streamsize>(vertexBytes)))
+    {
+      return invalid();
+    }
+
+    uint32_t indexType = 0u;
+    uint64_t indexCount = 0u;
+    if (!ReadValue(file, indexType) || !ReadValue(file, indexCount) ||
+        (indexType != Ogre::IndexBufferPacked::IT_16BIT &&
+         indexType != Ogre::IndexBufferPacked::IT_32BIT))
+    {
+      return invalid();
+    }
+    subMesh.indexType =
+        static_cast<Ogre::IndexBufferPacked::IndexType>(indexType);
+    subMesh.indexCount = indexCount;
+    const uint64_t indexBytes = indexCount *
+        (indexType == Ogre::IndexBufferPacked::IT_16BIT ? 2u : 4u);
+    if (indexBytes > fileSize)
+      return invalid();
+    subMesh.indices.resize(indexBytes);
+    if (!file.read(reinterpret_cast<char *>(subMesh.indices.data()),
+        static_cast<std::streamsize>(indexBytes)))
+    {
+      return invalid();
+    }
+
+    uint8_t hasMaterial = 0u;
+    uint32_t materialIndex = 0u;
+    if (!ReadValue(file, hasMaterial) || !ReadValue(file, materialIndex))
+      return invalid();
+    if (hasMaterial)
+      subMesh.materialIndex = materialIndex;
+  }
+
+  return packed;
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshCache::Write(uint64_t _key, const Ogre2PackedMesh &_packed)
+{
+  GZ_PROFILE("Ogre2MeshCache::Write");
+  const std::string &directory = Directory();
+  if (directory.empty())
+    return;
+
+  if (!common::isDirectory(directory) &&
+      !common::createDirectories(directory))
+  {
+    gzwarn << "Unable to create mesh cache directory [" << directory << "]"
+           << std::endl;
+    return;
+  }
+
+  // write a file of our own, then rename it so that readers only ever see
+  // complete entries
+  const std::string path = EntryPath(_key);
+  const std::string tmpPath =
+      path + ".tmp" + std::to_string(std::random_device{}());
+  {
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    WriteValue(file, kCacheMagic);
+    WriteValue(file, kCacheVersion);
+    WriteValue(file, _key);
+    const float bounds[7] = {
+        _packed.bounds.mCenter.x, _packed.bounds.mCenter.y,
+        _packed.bounds.mCenter.z, _packed.bounds.mHalfSize.x,
+        _packed.bounds.mHalfSize.y, _packed.bounds.mHalfSize.z,
+        _packed.radius};
+    WriteValue(file, bounds);
+    WriteValue(file, static_cast<uint32_t>(_packed.subMeshes.size()));
+
+    for (const Ogre2PackedSubMesh &subMesh : _packed.subMeshes)
+    {
+      WriteValue(file, static_cast<uint32_t>(subMesh.operationType));
+      WriteValue(file,
+          static_cast<uint32_t>(subMesh.vertexElements.size()));
+      for (const Ogre::VertexElement2 &element : subMesh.vertexElements)
+      {
+        WriteValue(file, static_cast<uint32_t>(element.mType));
+        WriteValue(file, static_cast<uint32_t>(element.mSemantic));
+      }
+
+      WriteValue(file, static_cast<uint64_t>(subMesh.vertexCount));
+      WriteValue(file, static_cast<uint64_t>(subMesh.vertices.size()));
+      file.write(reinterpret_cast<const char *>(subMesh.vertices.data()),
+          static_cast<std::streamsize>(subMesh.vertices.size()));
+
+      WriteValue(file, static_cast<uint32_t>(subMesh.indexType));
+      WriteValue(file, static_cast<uint64_t>(subMesh.indexCount));
+      file.write(reinterpret_cast<const char *>(subMesh.indices.data()),
+          static_cast<std::streamsize>(subMesh.indices.size()));
+
+      WriteValue(file, static_cast<uint8_t>(subMesh.materialIndex ? 1u : 0u));
+      WriteValue(file, subMesh.materialIndex.value_or(0u));
+    }
+
+    if (!file)
+    {
+      gzwarn << "Unable to write mesh cache entry [" << path << "]"
+             << std::endl;
+      file.close();
+      common::removeFile(tmpPath);
+      return;
+    }
+  }
+
+  if (!common::moveFile(tmpPath, path))
+    common::removeFile(tmpPath);
+}
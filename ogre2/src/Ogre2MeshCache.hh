@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2MESHCACHE_HH_
+#define GZ_RENDERING_OGRE2_OGRE2MESHCACHE_HH_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gz/common/Mesh.hh>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/ogre2/Export.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Math/Simple/OgreAabb.h>
+#include <Vao/OgreIndexBufferPacked.h>
+#include <Vao/OgreVertexArrayObject.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Vertex and index data of a submesh, laid out for a v2 mesh
+    class Ogre2PackedSubMesh
+    {
+      /// \brief Operation type of the submesh
+      public: Ogre::OperationType operationType = Ogre::OT_TRIANGLE_LIST;
+
+      /// \brief Elements of a vertex
+      public: Ogre::VertexElement2Vec vertexElements;
+
+      /// \brief Number of vertices
+      public: size_t vertexCount = 0u;
+
+      /// \brief Interleaved vertices
+      public: std::vector<uint8_t> vertices;
+
+      /// \brief Type of the indices
+      public: Ogre::IndexBufferPacked::IndexType indexType =
+          Ogre::IndexBufferPacked::IT_16BIT;
+
+      /// \brief Number of indices
+      public: size_t indexCount = 0u;
+
+      /// \brief Indices, 16 or 32 bit
+      public: std::vector<uint8_t> indices;
+
+      /// \brief Index of the material of the submesh in the common::Mesh
+      public: std::optional<unsigned int> materialIndex;
+    };
+
+    /// \brief Vertex and index data of a mesh, ready to be uploaded by
+    /// Ogre2MeshFactory
+    class Ogre2PackedMesh
+    {
+      /// \brief Submeshes, in order
+      public: std::vector<Ogre2PackedSubMesh> subMeshes;
+
+      /// \brief Bounds of the mesh
+      public: Ogre::Aabb bounds;
+
+      /// \brief Radius of the bounding sphere of the mesh
+      public: Ogre::Real radius = 0;
+    };
+
+    /// \brief On-disk cache of packed meshes, so that later processes skip
+    /// the tangent generation and vertex packing of the meshes they load.
+    /// It is enabled by setting the GZ_RENDERING_OGRE2_MESH_CACHE_PATH
+    /// environment variable to the directory of the cache.
+    ///
+    /// Entries are keyed by a hash of the path, size and modification time
+    /// of the file a mesh was loaded from and of the descriptor options
+    /// packing reads, so an edited file gets a new entry and the old one is
+    /// simply never read again. Meshes that were not loaded from a file are
+    /// not cached. Entries are written to a temporary file renamed
+    /// once complete, so concurrent processes never read partial entries.
+    /// They are stored in the byte order of the machine and are only meant
+    /// to be shared between processes of the same machine.
+    class GZ_RENDERING_OGRE2_HIDDEN Ogre2MeshCache
+    {
+      /// \brief Get the directory of the cache
+      /// \return Directory, empty if the cache is disabled
+      public: static const std::string &Directory();
+
+      /// \brief Compute the key of the entry of a mesh
+      /// \param[in] _desc Descriptor of the mesh, with the common::Mesh
+      /// resolved
+      /// \return Key of the mesh, empty if the mesh was not loaded from a
+      /// file
+      public: static std::optional<uint64_t> Key(const MeshDescriptor &_desc);
+
+      /// \brief Get the file a mesh was loaded from
+      /// \param[in] _mesh Mesh
+      /// \return Absolute path of the file, empty if the mesh was not
+      /// loaded from a file
+      public: static std::string SourceFile(const common::Mesh &_mesh);
+
+      /// \brief Read an entry
+      /// \param[in] _key Key of the entry
+      /// \return The packed mesh, null if there is no valid entry
+      public: static std::shared_ptr<Ogre2PackedMesh> Read(uint64_t _key);
+
+      /// \brief Write an entry, replacing any existing one
+      /// \param[in] _key Key of the entry
+      /// \param[in] _packed Packed mesh to store
+      public: static void Write(uint64_t _key,
+                  const Ogre2PackedMesh &_packed);
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gz/common/Filesystem.hh>
+#include <gz/common/Mesh.hh>
+#include <gz/common/TempDirectory.hh>
+#include <gz/utils/Environment.hh>
+
+#include <Vao/OgreVaoManager.h>
+
+#include "Ogre2MeshCache.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Test fixture that points the cache to a temporary directory
+class Ogre2MeshCacheTest : public testing::Test
+{
+  /// \brief Set the cache directory, it is read once per process
+  protected: void SetUp() override
+  {
+    static common::TempDirectory tempDir("ogre2_mesh_cache", "gz_rendering",
+        true);
+    ASSERT_TRUE(gz::utils::setenv("GZ_RENDERING_OGRE2_MESH_CACHE_PATH",
+        tempDir.Path()));
+    ASSERT_EQ(tempDir.Path(), Ogre2MeshCache::Directory());
+  }
+
+  /// \brief Get the path of the entry of a key, as Ogre2MeshCache names it
+  /// \param[in] _key Key of the entry
+  /// \return Path of the entry
+  protected: static std::string EntryPath(uint64_t _key)
+  {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << _key
+       << ".gzmesh";
+    return common::joinPaths(Ogre2MeshCache::Directory(), ss.str());
+  }
+
+  /// \brief Read a whole file
+  /// \param[in] _path Path of the file
+  /// \return Bytes of the file
+  protected: static std::vector<char> ReadFile(const std::string &_path)
+  {
+    std::ifstream file(_path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+  }
+
+  /// \brief Replace the contents of a file
+  /// \param[in] _path Path of the file
+  /// \param[in] _bytes New contents
+  protected: static void WriteFile(const std::string &_path,
+      const std::vector<char> &_bytes)
+  {
+    std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+    file.write(_bytes.data(), static_cast<std::streamsize>(_bytes.size()));
+  }
+
+  /// \brief Create a packed mesh with a 16 bit indexed submesh using a
+  /// material and a 32 bit indexed submesh without one
+  /// \return Packed mesh
+  protected: static Ogre2PackedMesh CreatePackedMesh()
+  {
+    Ogre2PackedMesh packed;
+    packed.bounds = Ogre::Aabb(Ogre::Vector3(0.5f, -1.0f, 2.0f),
+        Ogre::Vector3(1.5f, 2.5f, 0.25f));
+    packed.radius = 3.0f;
+
+    for (unsigned int i = 0u; i < 2u; ++i)
+    {
+      Ogre2PackedSubMesh subMesh;
+      subMesh.vertexElements.push_back(
+          Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_POSITION));
+      subMesh.vertexElements.push_back(
+          Ogre::VertexElement2(Ogre::VET_SHORT4_SNORM, Ogre::VES_NORMAL));
+      subMesh.vertexCount = 3u + i;
+      subMesh.vertices.resize(subMesh.vertexCount *
+          Ogre::VaoManager::calculateVertexSize(subMesh.vertexElements));
+      for (size_t b = 0u; b < subMesh.vertices.size(); ++b)
+        subMesh.vertices[b] = static_cast<uint8_t>(b * 7u + i);
+
+      subMesh.indexType = i == 0u ? Ogre::IndexBufferPacked::IT_16BIT :
+          Ogre::IndexBufferPacked::IT_32BIT;
+      subMesh.indexCount = 3u;
+      subMesh.indices.resize(subMesh.indexCount * (i == 0u ? 2u : 4u));
+      for (size_t b = 0u; b < subMesh.indices.size(); ++b)
+        subMesh.indices[b] = static_cast<uint8_t>(b % 3u);
+
+      if (i == 0u)
+        subMesh.materialIndex = 2u;
+      packed.subMeshes.push_back(subMesh);
+    }
+    return packed;
+  }
+};
+
+/////////////////////////////////////////////////
+TEST_F(Ogre2MeshCacheTest, Key)
+{
+  const std::string fileName = "key_test.obj";
+  const std::string path =
+      common::joinPaths(Ogre2MeshCache::Directory(), fileName);
+  WriteFile(path, {'v', ' ', '0', ' ', '0', ' ', '0', '\n'});
+
+  common::Mesh mesh;
+  mesh.SetName(path);
+  MeshDescriptor descriptor;
+  descriptor.mesh = &mesh;
+  const std::optional<uint64_t> key = Ogre2MeshCache::Key(descriptor);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_EQ(key, Ogre2MeshCache::Key(descriptor));
+
+  // meshes found in their path have the same key
+  mesh.SetName(fileName);
+  mesh.SetPath(Ogre2MeshCache::Directory());
+  EXPECT_EQ(key, Ogre2MeshCache::Key(descriptor));
+
+  // options packing reads change the key
+  descriptor.compressVertices = true;
+  EXPECT_NE(key, Ogre2MeshCache::Key(descriptor));
+  descriptor.compressVertices = false;
+  descriptor.subMeshName = "sub";
+  EXPECT_NE(key, Ogre2MeshCache::Key(descriptor));
+  descriptor.subMeshName.clear();
+
+  // so does editing the file
+  WriteFile(path, {'v', ' ', '0', ' ', '1', '.', '5', ' ', '0', '\n'});
+  EXPECT_NE(key, Ogre2MeshCache::Key(descriptor));
+
+  // meshes that were not loaded from a file are not cached
+  common::Mesh generated;
+  generated.SetName("generated_mesh");
+  descriptor.mesh = &generated;
+  EXPECT_FALSE(Ogre2MeshCache::Key(descriptor).has_value());
+}
+
+/////////////////////////////////////////////////
+TEST_F(Ogre2MeshCacheTest, WriteRead)
+{
+  const uint64_t key = 0x0123456789abcdefull;
+  const Ogre2PackedMesh packed = CreatePackedMesh();
+  Ogre2MeshCache::Write(key, packed);
+  EXPECT_TRUE(common::exists(EntryPath(key)));
+
+  std::shared_ptr<Ogre2PackedMesh> read = Ogre2MeshCache::Read(key);
+  ASSERT_NE(nullptr, read);
+
+  EXPECT_EQ(packed.bounds.mCenter, read->bounds.mCenter);
+  EXPECT_EQ(packed.bounds.mHalfSize, read->bounds.mHalfSize);
+  EXPECT_FLOAT_EQ(packed.radius, read->radius);
+
+  ASSERT_EQ(packed.subMeshes.size(), read->subMeshes.size());
+  for (size_t i = 0u; i < packed.subMeshes.size(); ++i)
+  {
+    const Ogre2PackedSubMesh &expected = packed.subMeshes[i];
+    const Ogre2PackedSubMesh &actual = read->subMeshes[i];
+    EXPECT_EQ(expected.operationType, actual.operationType);
+    EXPECT_EQ(expected.vertexElements, actual.vertexElements);
+    EXPECT_EQ(expected.vertexCount, actual.vertexCount);
+    EXPECT_EQ(expected.vertices, actual.vertices);
+    EXPECT_EQ(expected.indexType, actual.indexType);
+    EXPECT_EQ(expected.indexCount, actual.indexCount);
+    EXPECT_EQ(expected.indices, actual.indices);
+    EXPECT_EQ(expected.materialIndex.has_value(),
+        actual.materialIndex.has_value());
+    EXPECT_EQ(expected.materialIndex.value_or(0u),
+        actual.materialIndex.value_or(0u));
+  }
+
+  // there is no entry for other keys
+  EXPECT_EQ(nullptr, Ogre2MeshCache::Read(key + 1u));
+}
+
+/////////////////////////////////////////////////
+TEST_F(Ogre2MeshCacheTest, InvalidEntries)
+{
+  const uint64_t key = 0x1111222233334444ull;
+  Ogre2MeshCache::Write(key, CreatePackedMesh());
+  const std::string path = EntryPath(key);
+  const std::vector<char> bytes = ReadFile(path);
+  ASSERT_FALSE(bytes.empty());
+  ASSERT_NE(nullptr, Ogre2MeshCache::Read(key));
+
+  // truncated anywhere
+  for (size_t size : {size_t(2u), bytes.size() / 2u, bytes.size() - 1u})
+  {
+    WriteFile(path, std::vector<char>(bytes.begin(), bytes.begin() + size));
+    EXPECT_EQ(nullptr, Ogre2MeshCache::Read(key)) << size << " bytes";
+  }
+
+  // wrong magic
+  std::vector<char> wrongMagic = bytes;
+  wrongMagic[0] = static_cast<char>(wrongMagic[0] ^ 0xFF);
+  WriteFile(path, wrongMagic);
+  EXPECT_EQ(nullptr, Ogre2MeshCache::Read(key));
+
+  // entry of another key, e.g. copied over
+  const uint64_t otherKey = key + 1u;
+  WriteFile(EntryPath(otherKey), bytes);
+  EXPECT_EQ(nullptr, Ogre2MeshCache::Read(otherKey));
+
+  // the original entry is still valid
+  WriteFile(path, bytes);
+  EXPECT_NE(nullptr, Ogre2MeshCache::Read(key));
+}
@@ -16,7 +16,22 @@
  */
 
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Material.hh>
@@ -38,6 +53,7 @@
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
+#include <OgreBitwise.h>
 #include <OgreHardwareBufferManager.h>
 #include <OgreItem.h>
 #include <OgreKeyFrame.h>
@@ -46,18 +62,92 @@
 #include <OgreMeshManager2.h>
 #include <OgreOldBone.h>
 #include <OgreOldSkeletonManager.h>
+#include <OgreRenderSystem.h>
 #include <OgreSceneManager.h>
 #include <OgreSkeleton.h>
 #include <OgreSubItem.h>
 #include <OgreSubMesh.h>
 #include <OgreSubMesh2.h>
+#include <Vao/OgreIndexBufferPacked.h>
+#include <Vao/OgreVaoManager.h>
+#include <Vao/OgreVertexArrayObject.h>
 #ifdef _MSC_VER
   #pragma warning(pop)
 #endif
 
+#include "Ogre2MeshBvh.hh"
+#include "Ogre2MeshCache.hh"
+#include "Ogre2MeshLod.hh"
+
+/// \brief Packed mesh, null if the mesh is invalid
+using Ogre2PackedMeshPtr =
+    std::shared_ptr<const gz::rendering::Ogre2PackedMesh>;
+
 /// \brief Private data for the Ogre2MeshFactory class
 class gz::rendering::Ogre2MeshFactoryPrivate
 {
+  /// \brief Destructor, stops the worker threads
+  public: ~Ogre2MeshFactoryPrivate();
+
+  /// \brief Pack a mesh on the worker threads, starting them if needed
+  /// \param[in] _desc Descriptor of the mesh, with the common::Mesh
+  /// resolved
+  /// \return Future of the packed mesh
+  public: std::shared_future<Ogre2PackedMeshPtr> PackAsync(
+              const MeshDescriptor &_desc);
+
+  /// \brief Run the queued jobs until the workers are stopped
+  public: void RunJobs();
+
+  /// \brief Create a v2 mesh from packed vertex and index data
+  /// \param[in] _scene Scene creating the materials of the submeshes
+  /// \param[in] _desc Descriptor of the mesh
+  /// \param[in] _name Name of the mesh to create
+  /// \param[in] _packed Vertex and index data of the mesh
+  /// \return True if the mesh was created
+  public: static bool Upload(Ogre2Scene &_scene, const MeshDescriptor &_desc,
+              const std::string &_name, const Ogre2PackedMesh &_packed);
+
+  /// \brief Get the box shown in place of a mesh loaded in the background,
+  /// creating it if needed
+  /// \param[in] _scene Scene owning the default material
+  /// \param[in] _name Name of the box mesh
+  /// \param[in] _bounds Bounds of the loaded mesh
+  /// \return The box mesh
+  public: static Ogre::MeshPtr Placeholder(Ogre2Scene &_scene,
+              const std::string &_name, const Ogre::Aabb &_bounds);
+
+  /// \brief Mesh loaded in the background
+  public: struct AsyncLoad
+  {
+    /// \brief Descriptor of the mesh, with the common::Mesh resolved
+    MeshDescriptor desc;
+
+    /// \brief Vertex and index data, once packed
+    std::shared_future<Ogre2PackedMeshPtr> packed;
+
+    /// \brief Meshes showing a placeholder until the load is done
+    std::vector<std::weak_ptr<Ogre2Mesh>> meshes;
+  };
+
+  /// \brief Meshes loaded in the background, by ogre mesh name. Only used
+  /// from the render thread.
+  public: std::map<std::string, AsyncLoad> asyncLoads;
+
+  /// \brief Jobs waiting for a worker
+  public: std::deque<std::function<void()>> jobs;
+
+  /// \brief Guards jobs and stopWorkers
+  public: std::mutex jobMutex;
+
+  /// \brief Notified when a job is queued or the workers are stopped
+  public: std::condition_variable jobCondition;
+
+  /// \brief True to stop the worker threads
+  public: bool stopWorkers = false;
+
+  /// \brief Threads packing meshes
+  public: std::vector<std::thread> workers;
 };
 
 /// \brief Private data for the Ogre2SubMeshStoreFactory class
@@ -68,6 +158,714 @@ class gz::rendering::Ogre2SubMeshStoreFactoryPrivate
 using namespace gz;
 using namespace rendering;
 
+/// \brief Check whether meshes should be built as v1 meshes and imported to
+/// v2, like they were before meshes could be built as v2 meshes directly.
+/// This is the case if the GZ_RENDERING_OGRE2_LEGACY_MESH_IMPORT environment
+/// variable is set.
+/// \return True to always import meshes from v1
+static bool UseLegacyMeshImport()
+{
+  static const bool legacy =
+      (std::getenv("GZ_RENDERING_OGRE2_LEGACY_MESH_IMPORT") != nullptr);
+  return legacy;
+}
+
+/// \brief Check that all the indices of a submesh refer to one of its
+/// vertices
+/// \param[in] _subMesh Submesh to check
+/// \return True if the indices are valid
+static bool HasValidIndices(const common::SubMesh &_subMesh)
+{
+  // todo(iche033) use SubMesh::HasValidIndices() when gz-common 6.0.3
+  // is released
+  for (unsigned int j = 0u; j < _subMesh.IndexCount(); ++j)
+  {
+    int index = _subMesh.Index(j);
+    if (index > 0 &&
+        static_cast<unsigned int>(index) >= _subMesh.VertexCount())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Convert a submesh primitive type to an ogre operation type
+/// \param[in] _type Submesh primitive type
+/// \param[out] _operationType Ogre operation type
+/// \return False if the primitive type is unknown
+static bool ConvertPrimitiveType(common::SubMesh::PrimitiveType _type,
+    Ogre::OperationType &_operationType)
+{
+  switch (_type)
+  {
+    case common::SubMesh::TRIANGLES:
+      _operationType = Ogre::OT_TRIANGLE_LIST;
+      return true;
+    case common::SubMesh::LINES:
+      _operationType = Ogre::OT_LINE_LIST;
+      return true;
+    case common::SubMesh::LINESTRIPS:
+      _operationType = Ogre::OT_LINE_STRIP;
+      return true;
+    case common::SubMesh::TRIFANS:
+      _operationType = Ogre::OT_TRIANGLE_FAN;
+      return true;
+    case common::SubMesh::TRISTRIPS:
+      _operationType = Ogre::OT_TRIANGLE_STRIP;
+      return true;
+    case common::SubMesh::POINTS:
+      _operationType = Ogre::OT_POINT_LIST;
+      return true;
+    default:
+      gzerr << "Unknown primitive type[" << _type << "]\n";
+      return false;
+  }
+}
+
+/// \brief Largest coordinate, relative to the diagonal of the bounds, that
+/// keeps half float positions within 1/1024 of the diagonal. Half floats
+/// have 11 significant bits.
+static constexpr double kMaxHalfPositionRatio = 2.0;
+
+/// \brief Largest finite half float
+static constexpr double kMaxHalfFloat = 65504.0;
+
+/// \brief Check whether positions within bounds can be stored as half
+/// floats, see MeshDescriptor::compressVertices
+/// \param[in] _min Min corner of the bounds
+/// \param[in] _max Max corner of the bounds
+/// \return True if half floats keep enough precision
+static bool HalfPositionsFit(const math::Vector3d &_min,
+    const math::Vector3d &_max)
+{
+  const double maxAbs = std::max({std::abs(_min.X()), std::abs(_min.Y()),
+      std::abs(_min.Z()), std::abs(_max.X()), std::abs(_max.Y()),
+      std::abs(_max.Z())});
+  return maxAbs <= kMaxHalfFloat &&
+      maxAbs <= (_max - _min).Length() * kMaxHalfPositionRatio;
+}
+
+/// \brief Smallest difference between the distances of consecutive levels
+/// of detail, Ogre expects them to increase
+static constexpr double kMinLodSpacing = 0.01;
+
+/// \brief Levels of detail of a v1 submesh, see SetupLods
+class Ogre2SubMeshLods
+{
+  /// \brief Submesh
+  public: Ogre::v1::SubMesh *subMesh = nullptr;
+
+  /// \brief Indices of the full submesh, used for the levels it has no
+  /// simplified version for
+  public: std::vector<uint32_t> indices;
+
+  /// \brief Simplified levels
+  public: std::vector<Ogre2MeshLod::Level> levels;
+};
+
+/// \brief Set up the levels of detail of a v1 mesh, which
+/// Ogre::Mesh::importV1 imports with it. A level is used from the distance
+/// of the largest error of its submeshes. Submeshes with fewer levels than
+/// others keep their last one for the remaining levels. Must be called
+/// once every submesh is created and before preparing shadow mapping.
+/// \param[in] _mesh Mesh
+/// \param[in] _subMeshLods Levels of every submesh of the mesh
+static void SetupLods(Ogre::v1::Mesh &_mesh,
+    const std::vector<Ogre2SubMeshLods> &_subMeshLods)
+{
+  size_t levelCount = 0u;
+  for (const Ogre2SubMeshLods &lods : _subMeshLods)
+    levelCount = std::max(levelCount, lods.levels.size());
+  if (levelCount == 0u)
+    return;
+
+  std::vector<double> distances(levelCount + 1u, 0.0);
+  for (size_t l = 1u; l <= levelCount; ++l)
+  {
+    double error = 0.0;
+    for (const Ogre2SubMeshLods &lods : _subMeshLods)
+    {
+      if (!lods.levels.empty())
+      {
+        error = std::max(error,
+            lods.levels[std::min(l, lods.levels.size()) - 1u].error);
+      }
+    }
+    distances[l] = std::max(Ogre2MeshLod::Distance(error),
+        distances[l - 1u] + kMinLodSpacing);
+  }
+
+  // the full detail level 0 is set up by the mesh itself and cannot be
+  // modified
+  _mesh._setLodInfo(static_cast<unsigned short>(levelCount + 1u));
+  for (size_t l = 1u; l <= levelCount; ++l)
+  {
+    // the distance strategy compares squared distances
+    Ogre::v1::MeshLodUsage usage;
+    usage.userValue = static_cast<Ogre::Real>(distances[l]);
+    usage.value = static_cast<Ogre::Real>(distances[l] * distances[l]);
+    usage.edgeData = nullptr;
+    _mesh._setLodUsage(static_cast<unsigned short>(l), usage);
+  }
+
+  for (const Ogre2SubMeshLods &lods : _subMeshLods)
+  {
+    for (size_t l = 1u; l <= levelCount; ++l)
+    {
+      const std::vector<uint32_t> &indices = lods.levels.empty() ?
+          lods.indices :
+          lods.levels[std::min(l, lods.levels.size()) - 1u].indices;
+      Ogre::v1::IndexData *indexData = OGRE_NEW Ogre::v1::IndexData();
+      indexData->indexStart = 0u;
+      indexData->indexCount = indices.size();
+      indexData->indexBuffer =
+          Ogre::v1::HardwareBufferManager::getSingleton().createIndexBuffer(
+              Ogre::v1::HardwareIndexBuffer::IT_32BIT, indices.size(),
+              Ogre::v1::HardwareBuffer::HBU_STATIC, true);
+      indexData->indexBuffer->writeData(0u,
+          indexData->indexBuffer->getSizeInBytes(), indices.data(), true);
+      lods.subMesh->mLodFaceList[Ogre::VpNormal][l - 1u] = indexData;
+    }
+  }
+}
+
+/// \brief Compute the QTangents of the vertices of a submesh, the same way
+/// Ogre::Mesh::importV1 does: tangents are generated from the first
+/// texture coordinate set and the normal, tangent and bitangent are packed
+/// into a quaternion whose w sign is the bitangent reflection.
+/// \param[in] _subMesh Submesh, it must have one normal per vertex
+/// \return Four snorm16 components, x y z w, per vertex
+static std::vector<int16_t> ComputeQTangents(const common::SubMesh &_subMesh)
+{
+  const unsigned int vertexCount = _subMesh.VertexCount();
+  std::vector<Ogre::Vector3> tangents(vertexCount, Ogre::Vector3::ZERO);
+  std::vector<Ogre::Vector3> bitangents(vertexCount, Ogre::Vector3::ZERO);
+
+  // accumulate the uv derivatives of the triangles around every vertex
+  if (_subMesh.SubMeshPrimitiveType() == common::SubMesh::TRIANGLES &&
+      _subMesh.TexCoordSetCount() > 0u &&
+      _subMesh.TexCoordCountBySet(0u) >= vertexCount)
+  {
+    const math::Vector3d *positions = _subMesh.VertexPtr();
+    for (unsigned int i = 0u; i + 2u < _subMesh.IndexCount(); i += 3u)
+    {
+      const unsigned int idx[3] = {
+          static_cast<unsigned int>(_subMesh.Index(i)),
+          static_cast<unsigned int>(_subMesh.Index(i + 1u)),
+          static_cast<unsigned int>(_subMesh.Index(i + 2u))};
+      const math::Vector3d e1 = positions[idx[1]] - positions[idx[0]];
+      const math::Vector3d e2 = positions[idx[2]] - positions[idx[0]];
+      const math::Vector2d uv0 = _subMesh.TexCoordBySet(idx[0], 0u);
+      const math::Vector2d d1 = _subMesh.TexCoordBySet(idx[1], 0u) - uv0;
+      const math::Vector2d d2 = _subMesh.TexCoordBySet(idx[2], 0u) - uv0;
+      const double det = d1.X() * d2.Y() - d2.X() * d1.Y();
+      if (std::abs(det) < 1e-12)
+        continue;
+      const double r = 1.0 / det;
+      const math::Vector3d t = (e1 * d2.Y() - e2 * d1.Y()) * r;
+      const math::Vector3d b = (e2 * d1.X() - e1 * d2.X()) * r;
+      for (unsigned int k : idx)
+      {
+        tangents[k] += Ogre2Conversions::Convert(t);
+        bitangents[k] += Ogre2Conversions::Convert(b);
+      }
+    }
+  }
+
+  std::vector<int16_t> qTangents(static_cast<size_t>(vertexCount) * 4u);
+  for (unsigned int j = 0u; j < vertexCount; ++j)
+  {
+    Ogre::Vector3 normal = Ogre2Conversions::Convert(_subMesh.Normal(j));
+    if (normal.normalise() < 1e-6f)
+      normal = Ogre::Vector3::UNIT_Z;
+
+    // Gram-Schmidt, falling back to any perpendicular vector for vertices
+    // without uv derivatives
+    Ogre::Vector3 tangent = tangents[j] - normal * normal.dotProduct(
+        tangents[j]);
+    if (tangent.normalise() < 1e-6f)
+      tangent = normal.perpendicular();
+
+    const Ogre::Vector3 binormal = normal.crossProduct(tangent);
+    Ogre::Matrix3 tbn;
+    tbn.FromAxes(normal, tangent, binormal);
+    Ogre::Quaternion q(tbn);
+    q.normalise();
+
+    // make sure w is positive and never 0 once quantized, so that its sign
+    // can carry the reflection
+    if (q.w < 0)
+      q = -q;
+    const Ogre::Real bias = Ogre::Real(1) / Ogre::Real(32767);
+    if (q.w < bias)
+    {
+      const Ogre::Real normFactor = std::sqrt(1 - bias * bias);
+      q.w = bias;
+      q.x *= normFactor;
+      q.y *= normFactor;
+      q.z *= normFactor;
+    }
+    if (binormal.dotProduct(bitangents[j]) < 0)
+      q = -q;
+
+    int16_t *out = qTangents.data() + static_cast<size_t>(j) * 4u;
+    out[0] = Ogre::Bitwise::floatToSnorm16(q.x);
+    out[1] = Ogre::Bitwise::floatToSnorm16(q.y);
+    out[2] = Ogre::Bitwise::floatToSnorm16(q.z);
+    out[3] = Ogre::Bitwise::floatToSnorm16(q.w);
+  }
+  return qTangents;
+}
+
+/// \brief Most threads packing meshes in the background
+static constexpr unsigned int kMaxPackWorkers = 8u;
+
+/// \brief Validate a mesh and lay its vertices and indices out the way
+/// Ogre::Mesh::importV1 does for the v1 meshes built by LoadImpl: float
+/// positions, half ones if the descriptor compresses vertices and they fit,
+/// QTangents if there are normals and half texture coordinates, with a
+/// default set if there is none. Indices are 16 bit when every
+/// vertex can be addressed with them. Only reads the common::Mesh, so it can
+/// run on any thread.
+/// \param[in] _desc Descriptor of the mesh, with the common::Mesh resolved
+/// \return Packed mesh, null if the mesh is invalid
+static std::shared_ptr<Ogre2PackedMesh> PackMeshData(
+    const MeshDescriptor &_desc)
+{
+  GZ_PROFILE("Ogre2MeshFactory::PackMesh");
+  math::Vector3d max = _desc.mesh->Max();
+  math::Vector3d min = _desc.mesh->Min();
+  if (!max.IsFinite())
+  {
+    gzerr << "Max bounding box is not finite[" << max << "]" << std::endl;
+    return nullptr;
+  }
+
+  if (!min.IsFinite())
+  {
+    gzerr << "Min bounding box is not finite[" << min << "]" << std::endl;
+    return nullptr;
+  }
+
+  auto packed = std::make_shared<Ogre2PackedMesh>();
+  packed->bounds = Ogre::Aabb::newFromExtents(
+      Ogre2Conversions::Convert(min), Ogre2Conversions::Convert(max));
+  packed->radius = static_cast<Ogre::Real>((max - min).Length());
+
+  for (unsigned int i = 0; i < _desc.mesh->SubMeshCount(); i++)
+  {
+    // if submesh is specified then load only that particular submesh
+    auto s = _desc.mesh->SubMeshByIndex(i).lock();
+    if (!_desc.subMeshName.empty() && s &&
+        s->Name() != _desc.subMeshName)
+    {
+      continue;
+    }
+
+    if (!HasValidIndices(*s))
+    {
+      gzwarn << "Mesh[" << _desc.mesh->Name() << "] submesh[" << s->Name()
+             << "] has invalid indices. Skipping submesh creation."
+             << std::endl;
+      continue;
+    }
+
+    Ogre2PackedSubMesh subMesh;
+    ConvertPrimitiveType(s->SubMeshPrimitiveType(), subMesh.operationType);
+    subMesh.materialIndex = s->GetMaterialIndex();
+
+    const size_t vertexCount = s->VertexCount();
+    const bool hasNormals = s->NormalCount() > 0u;
+    std::vector<unsigned int> texCoordSets;
+    for (unsigned int k = 0u; k < s->TexCoordSetCount(); ++k)
+    {
+      if (s->TexCoordCountBySet(k) > 0u)
+        texCoordSets.push_back(k);
+    }
+
+    // Recenter the vertices if requested. The submesh is offset while it
+    // is copied instead of being copied and centered first.
+    math::Vector3d offset = math::Vector3d::Zero;
+    if (_desc.centerSubMesh)
+      offset = -(s->Min() + s->Max()) * 0.5;
+
+    // half positions are padded to 4 components, as importV1 does
+    const bool halfPositions = _desc.compressVertices &&
+        HalfPositionsFit(s->Min() + offset, s->Max() + offset);
+    subMesh.vertexElements.push_back(Ogre::VertexElement2(
+        halfPositions ? Ogre::VET_HALF4 : Ogre::VET_FLOAT3,
+        Ogre::VES_POSITION));
+    if (hasNormals)
+    {
+      subMesh.vertexElements.push_back(
+          Ogre::VertexElement2(Ogre::VET_SHORT4_SNORM, Ogre::VES_NORMAL));
+    }
+    for (size_t k = 0u; k < std::max<size_t>(texCoordSets.size(), 1u); ++k)
+    {
+      subMesh.vertexElements.push_back(Ogre::VertexElement2(Ogre::VET_HALF2,
+          Ogre::VES_TEXTURE_COORDINATES));
+    }
+    const size_t stride = Ogre::VaoManager::calculateVertexSize(
+        subMesh.vertexElements);
+
+    std::vector<int16_t> qTangents;
+    if (hasNormals)
+      qTangents = ComputeQTangents(*s);
+
+    subMesh.vertexCount = vertexCount;
+    subMesh.vertices.assign(vertexCount * stride, 0u);
+    const math::Vector3d *positions = s->VertexPtr();
+    for (size_t j = 0u; j < vertexCount; ++j)
+    {
+      uint8_t *vertex = subMesh.vertices.data() + j * stride;
+      const math::Vector3d p = positions[j] + offset;
+      if (halfPositions)
+      {
+        const uint16_t position[4] = {
+            Ogre::Bitwise::floatToHalf(static_cast<float>(p.X())),
+            Ogre::Bitwise::floatToHalf(static_cast<float>(p.Y())),
+            Ogre::Bitwise::floatToHalf(static_cast<float>(p.Z())),
+            Ogre::Bitwise::floatToHalf(1.0f)};
+        std::memcpy(vertex, position, sizeof(position));
+        vertex += sizeof(position);
+      }
+      else
+      {
+        const float position[3] = {static_cast<float>(p.X()),
+            static_cast<float>(p.Y()), static_cast<float>(p.Z())};
+        std::memcpy(vertex, position, sizeof(position));
+        vertex += sizeof(position);
+      }
+
+      if (hasNormals)
+      {
+        std::memcpy(vertex, qTangents.data() + j * 4u,
+            4u * sizeof(int16_t));
+        vertex += 4u * sizeof(int16_t);
+      }
+
+      // the default set is left to 0
+      for (unsigned int k : texCoordSets)
+      {
+        const math::Vector2d &uv = s->TexCoordBySet(
+            static_cast<unsigned int>(j), k);
+        const uint16_t texCoord[2] = {
+            Ogre::Bitwise::floatToHalf(static_cast<float>(uv.X())),
+            Ogre::Bitwise::floatToHalf(static_cast<float>(uv.Y()))};
+        std::memcpy(vertex, texCoord, sizeof(texCoord));
+        vertex += sizeof(texCoord);
+      }
+    }
+
+    // 16 bit indices when every vertex can be addressed with them, halving
+    // the size of the index buffer, otherwise a straight copy of the
+    // 32 bit indices of the submesh
+    subMesh.indexCount = s->IndexCount();
+    const unsigned int *indices = s->IndexPtr();
+    if (vertexCount < 0xFFFFu)
+    {
+      subMesh.indexType = Ogre::IndexBufferPacked::IT_16BIT;
+      subMesh.indices.resize(subMesh.indexCount * sizeof(uint16_t));
+      uint16_t *out = reinterpret_cast<uint16_t *>(subMesh.indices.data());
+      for (size_t j = 0u; j < subMesh.indexCount; ++j)
+        out[j] = static_cast<uint16_t>(indices[j]);
+    }
+    else
+    {
+      subMesh.indexType = Ogre::IndexBufferPacked::IT_32BIT;
+      subMesh.indices.resize(subMesh.indexCount * sizeof(uint32_t));
+      if (subMesh.indexCount > 0u)
+      {
+        std::memcpy(subMesh.indices.data(), indices,
+            subMesh.indices.size());
+      }
+    }
+
+    packed->subMeshes.push_back(std::move(subMesh));
+  }
+
+  return packed;
+}
+
+/// \brief Pack a mesh, see PackMeshData. Goes through Ogre2MeshCache when
+/// it is enabled, so that meshes packed by an earlier run are read back
+/// instead of packed again.
+/// \param[in] _desc Descriptor of the mesh, with the common::Mesh resolved
+/// \return Packed mesh, null if the mesh is invalid
+static Ogre2PackedMeshPtr PackMesh(const MeshDescriptor &_desc)
+{
+  if (Ogre2MeshCache::Directory().empty())
+    return PackMeshData(_desc);
+
+  const std::optional<uint64_t> key = Ogre2MeshCache::Key(_desc);
+  if (!key)
+    return PackMeshData(_desc);
+
+  if (auto cached = Ogre2MeshCache::Read(*key))
+    return cached;
+
+  auto packed = PackMeshData(_desc);
+  if (packed)
+    Ogre2MeshCache::Write(*key, *packed);
+  return packed;
+}
+
+/// \brief Get the bounds of the mesh a descriptor loads
+/// \param[in] _desc Descriptor of the mesh, with the common::Mesh resolved
+/// \return Bounds of the mesh
+static Ogre::Aabb DescriptorBounds(const MeshDescriptor &_desc)
+{
+  math::Vector3d min = _desc.mesh->Min();
+  math::Vector3d max = _desc.mesh->Max();
+  if (!_desc.subMeshName.empty())
+  {
+    auto s = _desc.mesh->SubMeshByName(_desc.subMeshName).lock();
+    if (s)
+    {
+      min = s->Min();
+      max = s->Max();
+      if (_desc.centerSubMesh)
+      {
+        const math::Vector3d center = (min + max) * 0.5;
+        min -= center;
+        max -= center;
+      }
+    }
+  }
+
+  if (!min.IsFinite() || !max.IsFinite())
+    return Ogre::Aabb();
+  return Ogre::Aabb::newFromExtents(Ogre2Conversions::Convert(min),
+      Ogre2Conversions::Convert(max));
+}
+
+//////////////////////////////////////////////////
+Ogre2MeshFactoryPrivate::~Ogre2MeshFactoryPrivate()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->jobMutex);
+    this->stopWorkers = true;
+    this->jobs.clear();
+  }
+  this->jobCondition.notify_all();
+  for (std::thread &worker : this->workers)
+    worker.join();
+}
+
+//////////////////////////////////////////////////
+std::shared_future<Ogre2PackedMeshPtr> Ogre2MeshFactoryPrivate::PackAsync(
+    const MeshDescriptor &_desc)
+{
+  auto task = std::make_shared<std::packaged_task<Ogre2PackedMeshPtr()>>(
+      [_desc]
+      {
+        return PackMesh(_desc);
+      });
+  std::shared_future<Ogre2PackedMeshPtr> packed =
+      task->get_future().share();
+
+  {
+    std::lock_guard<std::mutex> lock(this->jobMutex);
+    this->jobs.push_back([task] { (*task)(); });
+    if (this->workers.empty())
+    {
+      // leave a core to the render thread
+      const unsigned int count = std::clamp(
+          std::thread::hardware_concurrency(), 2u, kMaxPackWorkers + 1u) - 1u;
+      for (unsigned int i = 0u; i < count; ++i)
+        this->workers.emplace_back(&Ogre2MeshFactoryPrivate::RunJobs, this);
+    }
+  }
+  this->jobCondition.notify_one();
+  return packed;
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshFactoryPrivate::RunJobs()
+{
+  while (true)
+  {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(this->jobMutex);
+      this->jobCondition.wait(lock, [this]
+          {
+            return this->stopWorkers || !this->jobs.empty();
+          });
+      if (this->stopWorkers)
+        return;
+      job = std::move(this->jobs.front());
+      this->jobs.pop_front();
+    }
+    job();
+  }
+}
+
+//////////////////////////////////////////////////
+bool Ogre2MeshFactoryPrivate::Upload(Ogre2Scene &_scene,
+    const MeshDescriptor &_desc, const std::string &_name,
+    const Ogre2PackedMesh &_packed)
+{
+  GZ_PROFILE("Ogre2MeshFactory::Upload");
+  Ogre::VaoManager *vaoManager = _scene.OgreSceneManager()->
+      getDestinationRenderSystem()->getVaoManager();
+  Ogre::MeshPtr ogreMesh;
+
+  try
+  {
+    ogreMesh = Ogre::MeshManager::getSingleton().createManual(_name,
+        Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+
+    for (const Ogre2PackedSubMesh &subMesh : _packed.subMeshes)
+    {
+      // the buffers are immutable, ogre copies the data without writing it
+      Ogre::VertexBufferPacked *vertexBuffer = vaoManager->createVertexBuffer(
+          subMesh.vertexElements, subMesh.vertexCount, Ogre::BT_IMMUTABLE,
+          const_cast<uint8_t *>(subMesh.vertices.data()), false);
+      Ogre::VertexBufferPackedVec vertexBuffers;
+      vertexBuffers.push_back(vertexBuffer);
+
+      Ogre::IndexBufferPacked *indexBuffer = nullptr;
+      if (subMesh.indexCount > 0u)
+      {
+        indexBuffer = vaoManager->createIndexBuffer(subMesh.indexType,
+            subMesh.indexCount, Ogre::BT_IMMUTABLE,
+            const_cast<uint8_t *>(subMesh.indices.data()), false);
+      }
+
+      Ogre::VertexArrayObject *vao = vaoManager->createVertexArrayObject(
+          vertexBuffers, indexBuffer, subMesh.operationType);
+      Ogre::SubMesh *ogreSubMesh = ogreMesh->createSubMesh();
+      ogreSubMesh->mVao[Ogre::VpNormal].push_back(vao);
+      ogreSubMesh->mVao[Ogre::VpShadow].push_back(vao);
+
+      common::MaterialPtr material;
+      if (subMesh.materialIndex)
+      {
+        material = _desc.mesh->MaterialByIndex(subMesh.materialIndex.value());
+      }
+
+      MaterialPtr mat = _scene.CreateMaterial();
+      if (material)
+      {
+        mat->CopyFrom(*material);
+      }
+      else
+      {
+        MaterialPtr defaultMat = _scene.Material("Default/White");
+        if (defaultMat != nullptr)
+          mat->CopyFrom(defaultMat);
+      }
+      ogreSubMesh->setMaterialName(mat->Name());
+    }
+
+    ogreMesh->_setBounds(_packed.bounds, false);
+    ogreMesh->_setBoundingSphereRadius(_packed.radius);
+  }
+  catch(Ogre::Exception &e)
+  {
+    gzerr << "Unable to insert mesh[" << e.getDescription() << "]"
+        << std::endl;
+    if (ogreMesh)
+    {
+      _scene.MeshBvhCache().Remove(_name);
+      Ogre::MeshManager::getSingleton().remove(_name);
+    }
+    return false;
+  }
+
+  if (ogreMesh->getNumSubMeshes() == 0u)
+  {
+    std::stringstream ss;
+    ss << "Unable to load mesh: '" << _desc.meshName << "'";
+    if (!_desc.subMeshName.empty())
+      ss << ", submesh: '" << _desc.subMeshName << "'";
+    ss << ". Mesh will be empty." << std::endl;
+    gzwarn << ss.str();
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+Ogre::MeshPtr Ogre2MeshFactoryPrivate::Placeholder(Ogre2Scene &_scene,
+    const std::string &_name, const Ogre::Aabb &_bounds)
+{
+  Ogre::MeshPtr mesh = Ogre::MeshManager::getSingleton().getByName(_name);
+  if (mesh)
+    return mesh;
+
+  // four vertices per face so that every face has its own normal
+  std::vector<float> vertices;
+  std::vector<uint16_t> indices;
+  vertices.reserve(24u * 6u);
+  indices.reserve(36u);
+  for (unsigned int axis = 0u; axis < 3u; ++axis)
+  {
+    for (int sign : {-1, 1})
+    {
+      const unsigned int u = (axis + 1u) % 3u;
+      const unsigned int v = (axis + 2u) % 3u;
+      Ogre::Vector3 normal = Ogre::Vector3::ZERO;
+      normal[axis] = static_cast<Ogre::Real>(sign);
+
+      const uint16_t first = static_cast<uint16_t>(vertices.size() / 6u);
+      for (unsigned int corner = 0u; corner < 4u; ++corner)
+      {
+        Ogre::Vector3 p = normal;
+        p[u] = (corner & 1u) ? 1 : -1;
+        p[v] = (corner & 2u) ? 1 : -1;
+        p = _bounds.mCenter + p * _bounds.mHalfSize;
+        vertices.insert(vertices.end(), {p.x, p.y, p.z,
+            normal.x, normal.y, normal.z});
+      }
+
+      // counter clockwise seen from outside the box
+      if (sign > 0)
+      {
+        indices.insert(indices.end(), {first, uint16_t(first + 1u),
+            uint16_t(first + 3u), first, uint16_t(first + 3u),
+            uint16_t(first + 2u)});
+      }
+      else
+      {
+        indices.insert(indices.end(), {first, uint16_t(first + 3u),
+            uint16_t(first + 1u), first, uint16_t(first + 2u),
+            uint16_t(first + 3u)});
+      }
+    }
+  }
+
+  Ogre::VaoManager *vaoManager = _scene.OgreSceneManager()->
+      getDestinationRenderSystem()->getVaoManager();
+  Ogre::VertexElement2Vec vertexElements;
+  vertexElements.push_back(
+      Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_POSITION));
+  vertexElements.push_back(
+      Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_NORMAL));
+  Ogre::VertexBufferPackedVec vertexBuffers;
+  vertexBuffers.push_back(vaoManager->createVertexBuffer(vertexElements,
+      vertices.size() / 6u, Ogre::BT_IMMUTABLE, vertices.data(), false));
+  Ogre::IndexBufferPacked *indexBuffer = vaoManager->createIndexBuffer(
+      Ogre::IndexBufferPacked::IT_16BIT, indices.size(), Ogre::BT_IMMUTABLE,
+      indices.data(), false);
+  Ogre::VertexArrayObject *vao = vaoManager->createVertexArrayObject(
+      vertexBuffers, indexBuffer, Ogre::OT_TRIANGLE_LIST);
+
+  mesh = Ogre::MeshManager::getSingleton().createManual(_name,
+      Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+  Ogre::SubMesh *subMesh = mesh->createSubMesh();
+  subMesh->mVao[Ogre::VpNormal].push_back(vao);
+  subMesh->mVao[Ogre::VpShadow].push_back(vao);
+  MaterialPtr defaultMat = _scene.Material("Default/White");
+  if (defaultMat != nullptr)
+    subMesh->setMaterialName(defaultMat->Name());
+  mesh->_setBounds(_bounds, false);
+  mesh->_setBoundingSphereRadius(_bounds.getRadius());
+  return mesh;
+}
+
 //////////////////////////////////////////////////
 Ogre2MeshFactory::Ogre2MeshFactory(Ogre2ScenePtr _scene) :
   scene(_scene), dataPtr(std::make_unique<Ogre2MeshFactoryPrivate>())
@@ -82,8 +880,14 @@ Ogre2MeshFactory::~Ogre2MeshFactory()
 //////////////////////////////////////////////////
 void Ogre2MeshFactory::Clear()
 {
+  // meshes still loading keep their placeholder
+  this->dataPtr->asyncLoads.clear();
+
   for (auto &m : this->ogreMeshes)
+  {
+    this->scene->MeshBvhCache().Remove(m);
     Ogre::MeshManager::getSingleton().remove(m);
+  }
 
   this->ogreMeshes.clear();
 }
@@ -151,7 +955,11 @@ Ogre::Item *Ogre2MeshFactory::OgreItem(const MeshDescriptor &_desc)
     // create v2 mesh from v1
     mesh = Ogre::MeshManager::getSingleton().createManual(
         name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
-    mesh->importV1(v1Mesh.get(), false, true, true);
+    const Ogre::AxisAlignedBox &bounds = v1Mesh->getBounds();
+    const bool halfPositions = _desc.compressVertices && HalfPositionsFit(
+        Ogre2Conversions::Convert(bounds.getMinimum()),
+        Ogre2Conversions::Convert(bounds.getMaximum()));
+    mesh->importV1(v1Mesh.get(), halfPositions, true, true);
     this->ogreMeshes.push_back(name);
   }
 
@@ -185,6 +993,13 @@ bool Ogre2MeshFactory::IsLoaded(const MeshDescriptor &_desc)
 bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
 {
   GZ_PROFILE("Ogre2MeshFactory::LoadImpl");
+  // skinned meshes go through v1, which sets up the skeleton and the bone
+  // assignments of the v2 mesh on import, and so do meshes with levels of
+  // detail, which v2 meshes only get from v1 ones
+  if (!_desc.mesh->HasSkeleton() && _desc.lodLevels == 0u &&
+      !UseLegacyMeshImport())
+    return this->LoadImplV2(_desc);
+
   Ogre::v1::MeshPtr ogreMesh;
 
   Ogre2RenderEngine::Instance()->AddResourcePath(_desc.mesh->Path());
@@ -278,6 +1093,7 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
       ogreMesh->setSkeletonName(_desc.mesh->Name() + "_skeleton");
     }
 
+    std::vector<Ogre2SubMeshLods> subMeshLods;
     for (unsigned int i = 0; i < _desc.mesh->SubMeshCount(); i++)
     {
       // if submesh is specified then load only that particular submesh
@@ -288,18 +1104,7 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
         continue;
       }
 
-      // todo(iche033) use SubMesh::HasValidIndices() when gz-common 6.0.3
-      // is released
-      bool validIndices = true;
-      for (unsigned int j = 0u; j < s->IndexCount(); ++j)
-      {
-        int index = s->Index(j);
-        if (index > 0 && static_cast<unsigned int>(index) >= s->VertexCount())
-        {
-          validIndices = false;
-          break;
-        }
-      }
+      bool validIndices = HasValidIndices(*s);
       if (!validIndices)
       {
         gzwarn << "Mesh[" << _desc.mesh->Name() << "] submesh[" << s->Name()
@@ -328,37 +1133,8 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
 
       ogreSubMesh = ogreMesh->createSubMesh(subMesh.Name());
       ogreSubMesh->useSharedVertices = false;
-      if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRIANGLES)
-      {
-        ogreSubMesh->operationType =
-            Ogre::OT_TRIANGLE_LIST;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::LINES)
-      {
-        ogreSubMesh->operationType = Ogre::OT_LINE_LIST;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::LINESTRIPS)
-      {
-        ogreSubMesh->operationType = Ogre::OT_LINE_STRIP;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRIFANS)
-      {
-        ogreSubMesh->operationType = Ogre::OT_TRIANGLE_FAN;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::TRISTRIPS)
-      {
-        ogreSubMesh->operationType =
-            Ogre::OT_TRIANGLE_STRIP;
-      }
-      else if (subMesh.SubMeshPrimitiveType() == common::SubMesh::POINTS)
-      {
-        ogreSubMesh->operationType = Ogre::OT_POINT_LIST;
-      }
-      else
-      {
-        gzerr << "Unknown primitive type["
-              << subMesh.SubMeshPrimitiveType() << "]\n";
-      }
+      ConvertPrimitiveType(subMesh.SubMeshPrimitiveType(),
+          ogreSubMesh->operationType);
 
       ogreSubMesh->vertexData[Ogre::VpNormal] =
         new Ogre::v1::VertexData(ogreMesh->getHardwareBufferManager());
@@ -497,6 +1273,17 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
 
       iBuf->unlock();
 
+      // simplified levels of detail, set up once every submesh is created
+      if (_desc.lodLevels > 0u)
+      {
+        Ogre2SubMeshLods lods;
+        lods.subMesh = ogreSubMesh;
+        lods.indices.assign(subMesh.IndexPtr(),
+            subMesh.IndexPtr() + subMesh.IndexCount());
+        lods.levels = Ogre2MeshLod::Generate(subMesh, _desc.lodLevels);
+        subMeshLods.push_back(std::move(lods));
+      }
+
       common::MaterialPtr material;
       if (const auto subMeshIdx = subMesh.GetMaterialIndex())
       {
@@ -539,6 +1326,8 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
       return false;
     }
 
+    SetupLods(*ogreMesh, subMeshLods);
+
     if (!ogreMesh->hasValidShadowMappingBuffers())
       ogreMesh->prepareForShadowMapping(false);
 
@@ -571,6 +1360,121 @@ bool Ogre2MeshFactory::LoadImpl(const MeshDescriptor &_desc)
   return true;
 }
 
+//////////////////////////////////////////////////
+bool Ogre2MeshFactory::LoadImplV2(const MeshDescriptor &_desc)
+{
+  GZ_PROFILE("Ogre2MeshFactory::LoadImplV2");
+  Ogre2RenderEngine::Instance()->AddResourcePath(_desc.mesh->Path());
+
+  Ogre2PackedMeshPtr packed = PackMesh(_desc);
+  if (!packed)
+    return false;
+
+  const std::string name = this->MeshName(_desc);
+  if (!Ogre2MeshFactoryPrivate::Upload(*this->scene, _desc, name, *packed))
+    return false;
+
+  this->ogreMeshes.push_back(name);
+  return true;
+}
+
+//////////////////////////////////////////////////
+Ogre2MeshPtr Ogre2MeshFactory::CreateAsync(const MeshDescriptor &_desc)
+{
+  GZ_PROFILE("Ogre2MeshFactory::CreateAsync");
+  MeshDescriptor normDesc = _desc;
+  normDesc.Load();
+
+  // meshes that are loaded already or that are imported from v1 are
+  // created right away
+  if (!this->Validate(normDesc) || this->IsLoaded(normDesc) ||
+      normDesc.mesh->HasSkeleton() || normDesc.lodLevels > 0u ||
+      UseLegacyMeshImport())
+  {
+    return this->Create(_desc);
+  }
+
+  const std::string name = this->MeshName(normDesc);
+  Ogre2MeshFactoryPrivate::AsyncLoad &load = this->dataPtr->asyncLoads[name];
+  if (!load.packed.valid())
+  {
+    Ogre2RenderEngine::Instance()->AddResourcePath(normDesc.mesh->Path());
+    load.desc = normDesc;
+    load.packed = this->dataPtr->PackAsync(normDesc);
+  }
+
+  const std::string placeholderName = name + "::PLACEHOLDER";
+  if (!Ogre::MeshManager::getSingleton().resourceExists(placeholderName))
+    this->ogreMeshes.push_back(placeholderName);
+  Ogre::MeshPtr placeholder = Ogre2MeshFactoryPrivate::Placeholder(
+      *this->scene, placeholderName, DescriptorBounds(normDesc));
+
+  Ogre2MeshPtr mesh(new Ogre2Mesh);
+  mesh->ogreItem = this->scene->OgreSceneManager()->createItem(placeholder,
+      Ogre::SCENE_DYNAMIC);
+  mesh->loaded = false;
+
+  Ogre2SubMeshStoreFactory subMeshFactory(this->scene, mesh->ogreItem);
+  mesh->subMeshes = subMeshFactory.Create();
+  for (unsigned int i = 0; i < mesh->subMeshes->Size(); i++)
+  {
+    Ogre2SubMeshPtr submesh =
+        std::dynamic_pointer_cast<Ogre2SubMesh>(mesh->subMeshes->GetById(i));
+    submesh->SetMeshName(placeholderName);
+  }
+
+  load.meshes.push_back(mesh);
+  return mesh;
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshFactory::UpdateAsyncLoads()
+{
+  GZ_PROFILE("Ogre2MeshFactory::UpdateAsyncLoads");
+  auto &asyncLoads = this->dataPtr->asyncLoads;
+  for (auto it = asyncLoads.begin(); it != asyncLoads.end();)
+  {
+    Ogre2MeshFactoryPrivate::AsyncLoad &load = it->second;
+    if (load.packed.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready)
+    {
+      ++it;
+      continue;
+    }
+
+    // CreateMesh may have loaded the same mesh in the meantime
+    bool loaded = this->IsLoaded(load.desc);
+    Ogre2PackedMeshPtr packed = load.packed.get();
+    if (!loaded && packed &&
+        Ogre2MeshFactoryPrivate::Upload(*this->scene, load.desc, it->first,
+          *packed))
+    {
+      this->ogreMeshes.push_back(it->first);
+      loaded = true;
+    }
+
+    for (const std::weak_ptr<Ogre2Mesh> &weakMesh : load.meshes)
+    {
+      // skip the meshes destroyed while they were loading
+      Ogre2MeshPtr mesh = weakMesh.lock();
+      if (!mesh || !mesh->ogreItem)
+        continue;
+
+      Ogre::Item *item = loaded ? this->OgreItem(load.desc) : nullptr;
+      if (!item)
+      {
+        gzerr << "Failed to load mesh [" << load.desc.meshName
+              << "] in the background, keeping its placeholder" << std::endl;
+        continue;
+      }
+      mesh->ReplaceOgreItem(item, it->first);
+      mesh->loaded = true;
+    }
+
+    it = asyncLoads.erase(it);
+  }
+}
+
 //////////////////////////////////////////////////
 std::string Ogre2MeshFactory::MeshName(const MeshDescriptor &_desc)
 {
@@ -578,6 +1482,10 @@ std::string Ogre2MeshFactory::MeshName(const MeshDescriptor &_desc)
   ss << _desc.meshName << "::";
   ss << _desc.subMeshName << "::";
   ss << ((_desc.centerSubMesh) ? "CENTERED" : "ORIGINAL");
+  if (_desc.compressVertices)
+    ss << "::COMPRESSED";
+  if (_desc.lodLevels > 0u)
+    ss << "::LOD" << _desc.lodLevels;
   return ss.str();
 }
 
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include <gz/common/Mesh.hh>
+#include <gz/common/SubMesh.hh>
+#include <gz/math/Vector3.hh>
+
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/RenderEngine.hh"
+#include "gz/rendering/RenderingIface.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+#include "gz/rendering/ogre2/Ogre2Mesh.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Get the format the positions of the first submesh of a mesh are
+/// stored in on the GPU
+/// \param[in] _mesh Mesh
+/// \return Vertex element type, VET_FLOAT1 if there is no position
+static Ogre::VertexElementType PositionType(MeshPtr _mesh)
+{
+  Ogre2MeshPtr ogreMesh = std::dynamic_pointer_cast<Ogre2Mesh>(_mesh);
+  if (!ogreMesh)
+    return Ogre::VET_FLOAT1;
+  Ogre::Item *item = dynamic_cast<Ogre::Item *>(ogreMesh->OgreObject());
+  if (!item)
+    return Ogre::VET_FLOAT1;
+
+  const Ogre::VertexArrayObject *vao =
+      item->getMesh()->getSubMesh(0u)->mVao[Ogre::VpNormal][0u];
+  for (const Ogre::VertexBufferPacked *buffer : vao->getVertexBuffers())
+  {
+    for (const Ogre::VertexElement2 &element : buffer->getVertexElements())
+    {
+      if (element.mSemantic == Ogre::VES_POSITION)
+        return element.mType;
+    }
+  }
+  return Ogre::VET_FLOAT1;
+}
+
+/// \brief Create a mesh with a triangle spanning the given corners
+/// \param[in] _scene Scene
+/// \param[in] _name Name of the mesh
+/// \param[in] _min Min corner
+/// \param[in] _max Max corner
+/// \return Mesh with compressed vertices
+static MeshPtr CreateCompressedTriangle(ScenePtr _scene,
+    const std::string &_name, const math::Vector3d &_min,
+    const math::Vector3d &_max)
+{
+  common::Mesh mesh;
+  common::SubMesh subMesh;
+  subMesh.SetName("triangle");
+  subMesh.AddVertex(_min);
+  subMesh.AddVertex(math::Vector3d(_max.X(), _min.Y(), _min.Z()));
+  subMesh.AddVertex(_max);
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    subMesh.AddNormal(math::Vector3d(0, 0, 1));
+    subMesh.AddIndex(i);
+  }
+  mesh.AddSubMesh(subMesh);
+
+  MeshDescriptor descriptor;
+  descriptor.meshName = _name;
+  descriptor.mesh = &mesh;
+  descriptor.compressVertices = true;
+  return _scene->CreateMesh(descriptor);
+}
+
+/////////////////////////////////////////////////
+TEST(Ogre2MeshFactoryTest, CompressVertices)
+{
+  RenderEngine *engine = rendering::engine("ogre2");
+  if (!engine)
+    GTEST_SKIP() << "Engine 'ogre2' could not be loaded";
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // positions around the origin are stored as half floats
+  MeshDescriptor descriptor("unit_box");
+  descriptor.Load();
+  descriptor.compressVertices = true;
+  MeshPtr box = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, box);
+  EXPECT_EQ(Ogre::VET_HALF4, PositionType(box));
+
+  descriptor.compressVertices = false;
+  MeshPtr uncompressedBox = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, uncompressedBox);
+  EXPECT_EQ(Ogre::VET_FLOAT3, PositionType(uncompressedBox));
+
+  // a small mesh far from the origin would lose too much precision
+  MeshPtr far = CreateCompressedTriangle(scene, "far_triangle",
+      math::Vector3d(1000, 1000, 0), math::Vector3d(1001, 1001, 0));
+  ASSERT_NE(nullptr, far);
+  EXPECT_EQ(Ogre::VET_FLOAT3, PositionType(far));
+
+  // a mesh beyond the half float range
+  MeshPtr large = CreateCompressedTriangle(scene, "large_triangle",
+      math::Vector3d(-1e5, -1e5, 0), math::Vector3d(1e5, 1e5, 0));
+  ASSERT_NE(nullptr, large);
+  EXPECT_EQ(Ogre::VET_FLOAT3, PositionType(large));
+
+  engine->DestroyScene(scene);
+  ASSERT_TRUE(rendering::unloadEngine(engine->Name()));
+}
@@ -0,0 +1,568 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Profiler.hh>
+#include <gz/common/SubMesh.hh>
+#include <gz/math/Vector3.hh>
+
+#include "Ogre2MeshLod.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreCamera.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Ratio between the triangle counts of consecutive levels
+static constexpr double kLevelRatio = 0.5;
+
+/// \brief Weight of the planes that keep open borders in place, relative
+/// to the planes of the triangles
+static constexpr double kBorderWeight = 10.0;
+
+/// \brief Quadric error of a vertex: sum of the squared distances to a set
+/// of planes, stored as the upper half of a symmetric 4x4 matrix
+class Ogre2Quadric
+{
+  /// \brief Create the quadric of a plane
+  /// \param[in] _normal Unit normal of the plane
+  /// \param[in] _point Point of the plane
+  /// \param[in] _weight Weight of the plane
+  /// \return Quadric
+  public: static Ogre2Quadric Plane(const math::Vector3d &_normal,
+      const math::Vector3d &_point, double _weight)
+  {
+    const double d = -_normal.Dot(_point);
+    const double n[4] = {_normal.X(), _normal.Y(), _normal.Z(), d};
+    Ogre2Quadric q;
+    unsigned int k = 0u;
+    for (unsigned int i = 0u; i < 4u; ++i)
+    {
+      for (unsigned int j = i; j < 4u; ++j)
+        q.a[k++] = n[i] * n[j] * _weight;
+    }
+    return q;
+  }
+
+  /// \brief Add a quadric
+  /// \param[in] _q Quadric to add
+  /// \return This quadric
+  public: Ogre2Quadric &operator+=(const Ogre2Quadric &_q)
+  {
+    for (unsigned int i = 0u; i < 10u; ++i)
+      this->a[i] += _q.a[i];
+    return *this;
+  }
+
+  /// \brief Get the sum of two quadrics
+  /// \param[in] _q Quadric to add
+  /// \return Sum
+  public: Ogre2Quadric operator+(const Ogre2Quadric &_q) const
+  {
+    Ogre2Quadric q = *this;
+    q += _q;
+    return q;
+  }
+
+  /// \brief Get the error of a point
+  /// \param[in] _p Point
+  /// \return Sum of the weighted squared distances of the point to the
+  /// planes
+  public: double Error(const math::Vector3d &_p) const
+  {
+    const double x = _p.X();
+    const double y = _p.Y();
+    const double z = _p.Z();
+    const double e =
+        this->a[0] * x * x + 2.0 * this->a[1] * x * y +
+        2.0 * this->a[2] * x * z + 2.0 * this->a[3] * x +
+        this->a[4] * y * y + 2.0 * this->a[5] * y * z +
+        2.0 * this->a[6] * y + this->a[7] * z * z +
+        2.0 * this->a[8] * z + this->a[9];
+    return std::max(e, 0.0);
+  }
+
+  /// \brief Coefficients: xx xy xz xw yy yz yw zz zw ww
+  private: double a[10] = {};
+};
+
+/// \brief Collapses the edges of a triangle list in order of increasing
+/// quadric error. Vertices sharing a position are welded, so that seams
+/// between texture coordinates or normals do not open, and a collapsed
+/// vertex is replaced by a vertex of the submesh at the position it
+/// collapsed onto.
+class Ogre2MeshSimplifier
+{
+  /// \brief Constructor
+  /// \param[in] _subMesh Submesh with a triangle list
+  public: explicit Ogre2MeshSimplifier(const common::SubMesh &_subMesh)
+  {
+    // weld the vertices sharing a position
+    std::unordered_map<std::string, uint32_t> welded;
+    const unsigned int vertexCount = _subMesh.VertexCount();
+    this->welded.resize(vertexCount);
+    for (unsigned int j = 0u; j < vertexCount; ++j)
+    {
+      const math::Vector3d &p = _subMesh.Vertex(j);
+      const double coords[3] = {p.X(), p.Y(), p.Z()};
+      const std::string key(reinterpret_cast<const char *>(coords),
+          sizeof(coords));
+      auto inserted = welded.emplace(key,
+          static_cast<uint32_t>(this->positions.size()));
+      if (inserted.second)
+      {
+        this->positions.push_back(p);
+        this->representatives.push_back(j);
+      }
+      this->welded[j] = inserted.first->second;
+    }
+
+    const size_t count = this->positions.size();
+    this->quadrics.resize(count);
+    this->vertexTriangles.resize(count);
+    this->versions.assign(count, 0u);
+    this->removedVertices.assign(count, false);
+
+    // triangles, without the degenerate ones
+    for (unsigned int i = 0u; i + 2u < _subMesh.IndexCount(); i += 3u)
+    {
+      std::array<uint32_t, 3> corners;
+      std::array<uint32_t, 3> vertices;
+      for (unsigned int c = 0u; c < 3u; ++c)
+      {
+        corners[c] = static_cast<uint32_t>(_subMesh.Index(i + c));
+        vertices[c] = this->welded[corners[c]];
+      }
+      if (vertices[0] == vertices[1] || vertices[1] == vertices[2] ||
+          vertices[0] == vertices[2])
+      {
+        continue;
+      }
+      const uint32_t t = static_cast<uint32_t>(this->triangles.size());
+      this->triangles.push_back(vertices);
+      this->corners.push_back(corners);
+      for (uint32_t v : vertices)
+        this->vertexTriangles[v].push_back(t);
+    }
+    this->removedTriangles.assign(this->triangles.size(), false);
+    this->triangleCount = this->triangles.size();
+
+    // quadrics of the triangle planes, and of planes perpendicular to the
+    // open borders so that they keep their shape
+    std::unordered_map<uint64_t, std::pair<uint32_t, uint32_t>> edges;
+    for (uint32_t t = 0u; t < this->triangles.size(); ++t)
+    {
+      const auto &tri = this->triangles[t];
+      const math::Vector3d normal = this->Normal(tri);
+      if (normal == math::Vector3d::Zero)
+        continue;
+      const Ogre2Quadric q =
+          Ogre2Quadric::Plane(normal, this->positions[tri[0]], 1.0);
+      for (uint32_t v : tri)
+        this->quadrics[v] += q;
+      for (unsigned int e = 0u; e < 3u; ++e)
+      {
+        auto &edge = edges[this->EdgeKey(tri[e], tri[(e + 1u) % 3u])];
+        ++edge.first;
+        edge.second = t;
+      }
+    }
+    for (const auto &edge : edges)
+    {
+      if (edge.second.first != 1u)
+        continue;
+      const auto &tri = this->triangles[edge.second.second];
+      for (unsigned int e = 0u; e < 3u; ++e)
+      {
+        const uint32_t v0 = tri[e];
+        const uint32_t v1 = tri[(e + 1u) % 3u];
+        if (this->EdgeKey(v0, v1) != edge.first)
+          continue;
+        math::Vector3d border = (this->positions[v1] - this->positions[v0])
+            .Cross(this->Normal(tri));
+        if (border.Length() <= 0.0)
+          continue;
+        border.Normalize();
+        const Ogre2Quadric q = Ogre2Quadric::Plane(border,
+            this->positions[v0], kBorderWeight);
+        this->quadrics[v0] += q;
+        this->quadrics[v1] += q;
+      }
+    }
+
+    for (const auto &tri : this->triangles)
+    {
+      for (unsigned int e = 0u; e < 3u; ++e)
+      {
+        this->Push(tri[e], tri[(e + 1u) % 3u]);
+        this->Push(tri[(e + 1u) % 3u], tri[e]);
+      }
+    }
+  }
+
+  /// \brief Collapse edges until there are at most a number of triangles
+  /// left or no edge can be collapsed
+  /// \param[in] _target Number of triangles to reach
+  /// \return True if any triangle was removed
+  public: bool Collapse(size_t _target)
+  {
+    const size_t start = this->triangleCount;
+    while (this->triangleCount > _target && !this->candidates.empty())
+    {
+      const Candidate c = this->candidates.top();
+      this->candidates.pop();
+      if (this->removedVertices[c.from] || this->removedVertices[c.to] ||
+          this->versions[c.from] != c.fromVersion ||
+          this->versions[c.to] != c.toVersion ||
+          !this->Adjacent(c.from, c.to) || this->Flips(c.from, c.to))
+      {
+        continue;
+      }
+      this->maxCost = std::max(this->maxCost, c.cost);
+      this->Apply(c.from, c.to);
+    }
+    return this->triangleCount < start;
+  }
+
+  /// \brief Get the remaining triangles
+  /// \return Triangle list indexing the vertices of the submesh
+  public: std::vector<uint32_t> Indices() const
+  {
+    std::vector<uint32_t> indices;
+    indices.reserve(this->triangleCount * 3u);
+    for (uint32_t t = 0u; t < this->triangles.size(); ++t)
+    {
+      if (!this->removedTriangles[t])
+      {
+        indices.insert(indices.end(), this->corners[t].begin(),
+            this->corners[t].end());
+      }
+    }
+    return indices;
+  }
+
+  /// \brief Get the number of remaining triangles
+  /// \return Number of triangles
+  public: size_t TriangleCount() const
+  {
+    return this->triangleCount;
+  }
+
+  /// \brief Get the error of the collapses so far
+  /// \return Largest distance, in meters, estimated from the quadrics
+  public: double Error() const
+  {
+    return std::sqrt(this->maxCost);
+  }
+
+  /// \brief Collapse of a vertex onto a neighbour
+  private: struct Candidate
+  {
+    /// \brief Quadric error of the collapse
+    double cost;
+
+    /// \brief Vertex that is removed
+    uint32_t from;
+
+    /// \brief Vertex it collapses onto
+    uint32_t to;
+
+    /// \brief Versions of the vertices when the candidate was pushed
+    uint32_t fromVersion;
+    uint32_t toVersion;
+
+    /// \brief Order candidates by cost
+    bool operator>(const Candidate &_other) const
+    {
+      return this->cost > _other.cost;
+    }
+  };
+
+  /// \brief Get the key of an undirected edge
+  /// \param[in] _v0 First vertex
+  /// \param[in] _v1 Second vertex
+  /// \return Key
+  private: static uint64_t EdgeKey(uint32_t _v0, uint32_t _v1)
+  {
+    return (static_cast<uint64_t>(std::min(_v0, _v1)) << 32u) |
+        std::max(_v0, _v1);
+  }
+
+  /// \brief Get the unit normal of a triangle
+  /// \param[in] _tri Welded vertices of the triangle
+  /// \return Normal, zero if the triangle has no area
+  private: math::Vector3d Normal(const std::array<uint32_t, 3> &_tri) const
+  {
+    const math::Vector3d n =
+        (this->positions[_tri[1]] - this->positions[_tri[0]]).Cross(
+        this->positions[_tri[2]] - this->positions[_tri[0]]);
+    const double length = n.Length();
+    return length > 0.0 ? n / length : math::Vector3d::Zero;
+  }
+
+  /// \brief Queue the collapse of a vertex onto a neighbour
+  /// \param[in] _from Vertex that would be removed
+  /// \param[in] _to Vertex it would collapse onto
+  private: void Push(uint32_t _from, uint32_t _to)
+  {
+    const double cost = (this->quadrics[_from] + this->quadrics[_to])
+        .Error(this->positions[_to]);
+    this->candidates.push({cost, _from, _to, this->versions[_from],
+        this->versions[_to]});
+  }
+
+  /// \brief Check whether two vertices still share a triangle
+  /// \param[in] _v0 First vertex
+  /// \param[in] _v1 Second vertex
+  /// \return True if they do
+  private: bool Adjacent(uint32_t _v0, uint32_t _v1) const
+  {
+    for (uint32_t t : this->vertexTriangles[_v0])
+    {
+      const auto &tri = this->triangles[t];
+      if (!this->removedTriangles[t] &&
+          (tri[0] == _v1 || tri[1] == _v1 || tri[2] == _v1))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// \brief Check whether a collapse would flip or flatten a triangle
+  /// \param[in] _from Vertex that would be removed
+  /// \param[in] _to Vertex it would collapse onto
+  /// \return True if a triangle would flip
+  private: bool Flips(uint32_t _from, uint32_t _to) const
+  {
+    for (uint32_t t : this->vertexTriangles[_from])
+    {
+      const auto &tri = this->triangles[t];
+      if (this->removedTriangles[t] ||
+          tri[0] == _to || tri[1] == _to || tri[2] == _to)
+      {
+        continue;
+      }
+      std::array<uint32_t, 3> moved = tri;
+      for (uint32_t &v : moved)
+      {
+        if (v == _from)
+          v = _to;
+      }
+      const math::Vector3d before = this->Normal(tri);
+      const math::Vector3d after = this->Normal(moved);
+      if (after == math::Vector3d::Zero || before.Dot(after) <= 0.0)
+        return true;
+    }
+    return false;
+  }
+
+  /// \brief Collapse a vertex onto a neighbour
+  /// \param[in] _from Vertex that is removed
+  /// \param[in] _to Vertex it collapses onto
+  private: void Apply(uint32_t _from, uint32_t _to)
+  {
+    for (uint32_t t : this->vertexTriangles[_from])
+    {
+      if (this->removedTriangles[t])
+        continue;
+      auto &tri = this->triangles[t];
+      if (tri[0] == _to || tri[1] == _to || tri[2] == _to)
+      {
+        this->removedTriangles[t] = true;
+        --this->triangleCount;
+        continue;
+      }
+      for (unsigned int c = 0u; c < 3u; ++c)
+      {
+        if (tri[c] == _from)
+        {
+          tri[c] = _to;
+          this->corners[t][c] = this->representatives[_to];
+        }
+      }
+      this->vertexTriangles[_to].push_back(t);
+    }
+    this->vertexTriangles[_from].clear();
+    this->vertexTriangles[_from].shrink_to_fit();
+    this->removedVertices[_from] = true;
+    this->quadrics[_to] += this->quadrics[_from];
+    ++this->versions[_to];
+
+    // drop the removed triangles of the vertex and queue the collapses
+    // of its edges again, their cost changed with its quadric
+    auto &trianglesOfTo = this->vertexTriangles[_to];
+    trianglesOfTo.erase(std::remove_if(trianglesOfTo.begin(),
+        trianglesOfTo.end(), [this](uint32_t _t)
+        {
+          return this->removedTriangles[_t];
+        }), trianglesOfTo.end());
+    for (uint32_t t : trianglesOfTo)
+    {
+      for (uint32_t v : this->triangles[t])
+      {
+        if (v == _to)
+          continue;
+        this->Push(_to, v);
+        this->Push(v, _to);
+      }
+    }
+  }
+
+  /// \brief Welded vertex of every vertex of the submesh
+  private: std::vector<uint32_t> welded;
+
+  /// \brief Position of every welded vertex
+  private: std::vector<math::Vector3d> positions;
+
+  /// \brief Vertex of the submesh standing for every welded vertex
+  private: std::vector<uint32_t> representatives;
+
+  /// \brief Quadric of every welded vertex
+  private: std::vector<Ogre2Quadric> quadrics;
+
+  /// \brief Triangles of every welded vertex, may include removed ones
+  private: std::vector<std::vector<uint32_t>> vertexTriangles;
+
+  /// \brief Version of every welded vertex, increased when its quadric or
+  /// its neighbours change
+  private: std::vector<uint32_t> versions;
+
+  /// \brief Whether every welded vertex was collapsed
+  private: std::vector<bool> removedVertices;
+
+  /// \brief Welded vertices of every triangle
+  private: std::vector<std::array<uint32_t, 3>> triangles;
+
+  /// \brief Vertices of the submesh indexed by every triangle
+  private: std::vector<std::array<uint32_t, 3>> corners;
+
+  /// \brief Whether every triangle was removed
+  private: std::vector<bool> removedTriangles;
+
+  /// \brief Number of triangles left
+  private: size_t triangleCount = 0u;
+
+  /// \brief Largest cost of the collapses so far
+  private: double maxCost = 0.0;
+
+  /// \brief Queued collapses, cheapest first. Candidates pushed before
+  /// the versions of their vertices changed are skipped.
+  private: std::priority_queue<Candidate, std::vector<Candidate>,
+      std::greater<Candidate>> candidates;
+};
+
+//////////////////////////////////////////////////
+std::vector<Ogre2MeshLod::Level> Ogre2MeshLod::Generate(
+    const common::SubMesh &_subMesh, unsigned int _levelCount)
+{
+  GZ_PROFILE("Ogre2MeshLod::Generate");
+  std::vector<Level> levels;
+  if (_levelCount == 0u ||
+      _subMesh.SubMeshPrimitiveType() != common::SubMesh::TRIANGLES)
+  {
+    return levels;
+  }
+
+  Ogre2MeshSimplifier simplifier(_subMesh);
+  size_t target = simplifier.TriangleCount();
+  for (unsigned int l = 0u; l < _levelCount; ++l)
+  {
+    target = static_cast<size_t>(static_cast<double>(target) * kLevelRatio);
+    if (target == 0u || !simplifier.Collapse(target))
+      break;
+
+    Level level;
+    level.indices = simplifier.Indices();
+    level.error = simplifier.Error();
+    levels.push_back(std::move(level));
+  }
+  return levels;
+}
+
+//////////////////////////////////////////////////
+double Ogre2MeshLod::Distance(double _error)
+{
+  // an error of _error meters spans one pixel at this distance
+  return _error * kReferenceFocalLength;
+}
+
+/// \brief Read a positive number from the user data of a node
+/// \param[in] _node Node
+/// \param[in] _key Key of the user data
+/// \param[in] _default Value if the node has no valid user data
+/// \return Value
+static double PositiveUserData(const Node &_node, const std::string &_key,
+    double _default)
+{
+  if (!_node.HasUserData(_key))
+    return _default;
+
+  double result = _default;
+  Variant value = _node.UserData(_key);
+  if (const double *doublePtr = std::get_if<double>(&value))
+    result = *doublePtr;
+  else if (const float *floatPtr = std::get_if<float>(&value))
+    result = *floatPtr;
+  else if (const int *intPtr = std::get_if<int>(&value))
+    result = *intPtr;
+  else
+    gzerr << "Error casting user data: " << _key << "\n";
+
+  if (!(result > 0.0))
+  {
+    gzerr << "User data " << _key << " must be positive" << std::endl;
+    return _default;
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+void Ogre2MeshLod::UpdateCamera(const Node &_sensor, Ogre::Camera *_camera,
+    unsigned int _imageHeight)
+{
+  const double pixelError = PositiveUserData(_sensor, "lod_pixel_error", 1.0);
+  const double bias = PositiveUserData(_sensor, "lod_bias", 1.0);
+
+  const double tanHalfFov =
+      std::tan(_camera->getFOVy().valueRadians() * 0.5);
+  if (_imageHeight == 0u || !(tanHalfFov > 0.0))
+    return;
+  const double focalLength = _imageHeight / (2.0 * tanHalfFov);
+
+  // a level is used once its error spans less than pixelError pixels.
+  // Ogre divides the squared distances by the bias, so the distance scale
+  // is squared.
+  const double scale = focalLength / (kReferenceFocalLength * pixelError);
+  _camera->setLodBias(static_cast<Ogre::Real>(scale * scale * bias));
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2MESHLOD_HH_
+#define GZ_RENDERING_OGRE2_OGRE2MESHLOD_HH_
+
+#include <cstdint>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+#include "gz/rendering/Node.hh"
+#include "gz/rendering/ogre2/Export.hh"
+
+namespace gz
+{
+  namespace common
+  {
+    class SubMesh;
+  }
+}
+
+namespace Ogre
+{
+  class Camera;
+}
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Levels of detail of the meshes loaded by Ogre2MeshFactory, see
+    /// MeshDescriptor::lodLevels.
+    ///
+    /// Generate simplifies a submesh with quadric error metrics, collapsing
+    /// vertices onto their neighbours so that every level indexes the
+    /// vertices of the full submesh. Every level has about half the
+    /// triangles of the previous one. A level is used from the distance at
+    /// which its error spans less than a pixel for a camera with a focal
+    /// length of kReferenceFocalLength pixels. UpdateCamera scales that
+    /// distance for each camera from its actual focal length and the pixel
+    /// error it tolerates, so small sensor images and cube map faces switch
+    /// to coarse levels sooner than large GUI views.
+    class GZ_RENDERING_OGRE2_HIDDEN Ogre2MeshLod
+    {
+      /// \brief Focal length, in pixels, the level distances are computed
+      /// for
+      public: static constexpr double kReferenceFocalLength = 1000.0;
+
+      /// \brief Simplified level of a submesh
+      public: class Level
+      {
+        /// \brief Triangle list indexing the vertices of the submesh
+        public: std::vector<uint32_t> indices;
+
+        /// \brief Largest distance, in meters, between the level and the
+        /// full submesh, estimated from the quadric errors
+        public: double error = 0.0;
+      };
+
+      /// \brief Generate the simplified levels of a submesh. Levels that
+      /// cannot be simplified further are left out, so fewer levels than
+      /// asked for may be returned.
+      /// \param[in] _subMesh Submesh, only triangle lists are simplified
+      /// \param[in] _levelCount Number of levels to generate
+      /// \return Levels, from the most to the least detailed
+      public: static std::vector<Level> Generate(
+                  const common::SubMesh &_subMesh, unsigned int _levelCount);
+
+      /// \brief Get the distance from which a level is used
+      /// \param[in] _error Error of the level
+      /// \return Distance, in meters, for the reference focal length
+      public: static double Distance(double _error);
+
+      /// \brief Set the LOD bias of an Ogre camera rendering for a sensor
+      /// or a user camera. The bias matches the focal length of the camera
+      /// to the reference one and is scaled by the "lod_pixel_error" user
+      /// data of the sensor, the error in pixels it tolerates, 1 by
+      /// default, and by its "lod_bias" user data, 1 by default. Larger
+      /// pixel errors and smaller biases select coarser levels.
+      /// \param[in] _sensor Sensor or camera owning the Ogre camera
+      /// \param[in] _camera Ogre camera, with its field of view set
+      /// \param[in] _imageHeight Height in pixels of the images rendered by
+      /// the Ogre camera
+      public: static void UpdateCamera(const Node &_sensor,
+                  Ogre::Camera *_camera, unsigned int _imageHeight);
+    };
+    }
+  }
+}
+#endif
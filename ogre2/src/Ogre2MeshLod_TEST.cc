@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <gz/common/Mesh.hh>
+#include <gz/common/MeshManager.hh>
+#include <gz/common/SubMesh.hh>
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/Image.hh"
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/RenderEngine.hh"
+#include "gz/rendering/RenderingIface.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/ogre2/Ogre2Includes.hh"
+#include "gz/rendering/ogre2/Ogre2Mesh.hh"
+
+#include "Ogre2MeshLod.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(Ogre2MeshLodTest, Generate)
+{
+  const common::Mesh *mesh =
+      common::MeshManager::Instance()->MeshByName("unit_sphere");
+  ASSERT_NE(nullptr, mesh);
+  auto subMesh = mesh->SubMeshByIndex(0u).lock();
+  ASSERT_NE(nullptr, subMesh);
+
+  const unsigned int levelCount = 3u;
+  std::vector<Ogre2MeshLod::Level> levels =
+      Ogre2MeshLod::Generate(*subMesh, levelCount);
+  ASSERT_EQ(levelCount, levels.size());
+
+  // every level has about half the triangles of the previous one, indexes
+  // the vertices of the full submesh and is further from it
+  size_t target = subMesh->IndexCount() / 3u;
+  double error = 0.0;
+  for (const Ogre2MeshLod::Level &level : levels)
+  {
+    target /= 2u;
+    ASSERT_EQ(0u, level.indices.size() % 3u);
+    const size_t triangleCount = level.indices.size() / 3u;
+    EXPECT_LE(triangleCount, target);
+    EXPECT_GE(triangleCount, target * 9u / 10u);
+
+    for (uint32_t index : level.indices)
+      EXPECT_LT(index, subMesh->VertexCount());
+
+    EXPECT_GT(level.error, error);
+    error = level.error;
+  }
+
+  // nothing to generate
+  EXPECT_TRUE(Ogre2MeshLod::Generate(*subMesh, 0u).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(Ogre2MeshLodTest, CameraLevel)
+{
+  RenderEngine *engine = rendering::engine("ogre2");
+  if (!engine)
+    GTEST_SKIP() << "Engine 'ogre2' could not be loaded";
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  MeshDescriptor descriptor("unit_sphere");
+  descriptor.Load();
+  descriptor.lodLevels = 3u;
+  MeshPtr meshGeom = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, meshGeom);
+  Ogre2MeshPtr ogreMesh = std::dynamic_pointer_cast<Ogre2Mesh>(meshGeom);
+  ASSERT_NE(nullptr, ogreMesh);
+  Ogre::MovableObject *item = ogreMesh->OgreObject();
+  ASSERT_NE(nullptr, item);
+
+  VisualPtr visual = scene->CreateVisual("visual");
+  visual->AddGeometry(meshGeom);
+  root->AddChild(visual);
+
+  // the same camera picks the full mesh when it tolerates a small error
+  // and the coarsest level when it tolerates a large one
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetLocalPosition(-3.0, 0.0, 0.0);
+  camera->SetImageWidth(256);
+  camera->SetImageHeight(256);
+  root->AddChild(camera);
+  Image image = camera->CreateImage();
+
+  camera->SetUserData("lod_pixel_error", 0.01);
+  camera->Capture(image);
+  const unsigned int fineLod = item->mCurrentMeshLod;
+  EXPECT_EQ(0u, fineLod);
+
+  camera->SetUserData("lod_pixel_error", 100.0);
+  camera->Capture(image);
+  const unsigned int coarseLod = item->mCurrentMeshLod;
+  EXPECT_EQ(descriptor.lodLevels, coarseLod);
+
+  engine->DestroyScene(scene);
+  ASSERT_TRUE(rendering::unloadEngine(engine->Name()));
+}
@@ -95,6 +95,62 @@ void Ogre2Node::SetRawLocalPose(const math::Pose3d &_Pose3d)
   this->SetRawLocalRotation(_Pose3d.Rot());
 }
 
+//////////////////////////////////////////////////
+bool Ogre2Node::UpdateLocalPose(const math::Pose3d &_pose)
+{
+  if (nullptr == this->ogreNode)
+    return false;
+
+  if (!_pose.IsFinite())
+  {
+    gzerr << "Unable to set non-finite pose [" << _pose
+          << "] to node [" << this->Name() << "]" << std::endl;
+    return false;
+  }
+
+  // nodes with an origin offset, and cameras far away from the origin,
+  // need the extra handling done by SetLocalPose
+  if (this->origin != math::Vector3d::Zero ||
+      _pose.Pos().SquaredLength() > 1e18)
+  {
+    if (this->LocalPose() == _pose)
+      return false;
+    this->SetLocalPose(_pose);
+    return true;
+  }
+
+  // compare in single precision, as stored by ogre, so a pose re-sent
+  // unchanged every frame is skipped
+  const Ogre::Vector3 position = Ogre2Conversions::Convert(_pose.Pos());
+  const Ogre::Quaternion orientation = Ogre2Conversions::Convert(_pose.Rot());
+  if (position == this->ogreNode->getPosition() &&
+      orientation == this->ogreNode->getOrientation())
+  {
+    return false;
+  }
+
+  if (!this->initialLocalPoseSet)
+  {
+    this->initialLocalPose = _pose;
+    this->initialLocalPoseSet = true;
+  }
+
+  this->ogreNode->setPosition(position);
+  this->ogreNode->setOrientation(orientation);
+  this->NotifyStaticDirty();
+  this->MarkPreRenderDirty();
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Node::NotifyStaticDirty()
+{
+  if (nullptr == this->ogreNode || !this->ogreNode->isStatic())
+    return;
+
+  this->scene->OgreSceneManager()->notifyStaticDirty(this->ogreNode);
+}
+
 //////////////////////////////////////////////////
 math::Vector3d Ogre2Node::RawLocalPosition() const
 {
@@ -120,7 +176,15 @@ void Ogre2Node::SetRawLocalPosition(const math::Vector3d &_position)
           << "1e9 from origin" << std::endl;
     return;
   }
-  this->ogreNode->setPosition(Ogre2Conversions::Convert(_position));
+
+  Ogre::Vector3 position = Ogre2Conversions::Convert(_position);
+  // static nodes are only refreshed when notified, so re-sending the same
+  // position must not make them dirty
+  if (this->ogreNode->isStatic() && position == this->ogreNode->getPosition())
+    return;
+
+  this->ogreNode->setPosition(position);
+  this->NotifyStaticDirty();
 }
 
 //////////////////////////////////////////////////
@@ -138,7 +202,15 @@ void Ogre2Node::SetRawLocalRotation(const math::Quaterniond &_rotation)
   if (nullptr == this->ogreNode)
     return;
 
-  this->ogreNode->setOrientation(Ogre2Conversions::Convert(_rotation));
+  Ogre::Quaternion orientation = Ogre2Conversions::Convert(_rotation);
+  if (this->ogreNode->isStatic() &&
+      orientation == this->ogreNode->getOrientation())
+  {
+    return;
+  }
+
+  this->ogreNode->setOrientation(orientation);
+  this->NotifyStaticDirty();
 }
 
 //////////////////////////////////////////////////
@@ -279,4 +351,5 @@ void Ogre2Node::SetLocalScaleImpl(const math::Vector3d &_scale)
     return;
 
   this->ogreNode->setScale(Ogre2Conversions::Convert(_scale));
+  this->NotifyStaticDirty();
 }
@@ -0,0 +1,260 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <gz/common/Profiler.hh>
+
+#include "Ogre2PointCloudOctree.hh"
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Smallest half size of the root, so that a first batch of
+/// coincident points does not create a degenerate root
+static constexpr Ogre::Real kMinRootHalfSize = 1;
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudOctree::Insert(const float *_points,
+    const uint8_t *_colors, size_t _count)
+{
+  GZ_PROFILE("Ogre2PointCloudOctree::Insert");
+  if (_count == 0u)
+    return;
+
+  if (!this->root)
+  {
+    // bound the first batch, later batches grow the root if needed
+    Ogre::Vector3 minPoint(_points[0], _points[1], _points[2]);
+    Ogre::Vector3 maxPoint = minPoint;
+    for (size_t i = 1u; i < _count; ++i)
+    {
+      const float *p = _points + i * 3u;
+      minPoint.makeFloor(Ogre::Vector3(p[0], p[1], p[2]));
+      maxPoint.makeCeil(Ogre::Vector3(p[0], p[1], p[2]));
+    }
+    const Ogre::Vector3 extent = maxPoint - minPoint;
+    const Ogre::Real halfSize = std::max(kMinRootHalfSize,
+        std::max({extent.x, extent.y, extent.z}) * Ogre::Real(0.5) *
+        Ogre::Real(1.001));
+    this->root = this->CreateNode((minPoint + maxPoint) * Ogre::Real(0.5),
+        halfSize, 0u);
+  }
+
+  for (size_t i = 0u; i < _count; ++i)
+  {
+    const float *p = _points + i * 3u;
+    const Ogre::Vector3 point(p[0], p[1], p[2]);
+    while (std::abs(point.x - this->root->center.x) > this->root->halfSize ||
+           std::abs(point.y - this->root->center.y) > this->root->halfSize ||
+           std::abs(point.z - this->root->center.z) > this->root->halfSize)
+    {
+      this->Grow(point);
+    }
+    this->InsertPoint(this->root.get(), p, _colors + i * 4u);
+  }
+  this->pointCount += _count;
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudOctree::Clear()
+{
+  // node ids are not reset so that they never refer to a removed node
+  this->root.reset();
+  this->pointCount = 0u;
+  this->nodeCount = 0u;
+}
+
+//////////////////////////////////////////////////
+const Ogre2PointCloudOctree::Node *Ogre2PointCloudOctree::Root() const
+{
+  return this->root.get();
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2PointCloudOctree::PointCount() const
+{
+  return this->pointCount;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2PointCloudOctree::NodeCount() const
+{
+  return this->nodeCount;
+}
+
+//////////////////////////////////////////////////
+std::unique_ptr<Ogre2PointCloudOctree::Node>
+    Ogre2PointCloudOctree::CreateNode(const Ogre::Vector3 &_center,
+    Ogre::Real _halfSize, unsigned int _depth)
+{
+  auto node = std::make_unique<Node>();
+  node->id = this->nextId++;
+  node->depth = _depth;
+  node->center = _center;
+  node->halfSize = _halfSize;
+  ++this->nodeCount;
+  return node;
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudOctree::Grow(const Ogre::Vector3 &_point)
+{
+  std::unique_ptr<Node> oldRoot = std::move(this->root);
+
+  // the old root becomes the octant of the new root facing away from the
+  // point
+  Ogre::Vector3 direction(
+      _point.x >= oldRoot->center.x ? 1 : -1,
+      _point.y >= oldRoot->center.y ? 1 : -1,
+      _point.z >= oldRoot->center.z ? 1 : -1);
+  this->root = this->CreateNode(
+      oldRoot->center + direction * oldRoot->halfSize,
+      oldRoot->halfSize * 2, 0u);
+  this->root->leaf = false;
+
+  std::vector<Node *> stack = {oldRoot.get()};
+  while (!stack.empty())
+  {
+    Node *node = stack.back();
+    stack.pop_back();
+    ++node->depth;
+    for (auto &child : node->children)
+    {
+      if (child)
+        stack.push_back(child.get());
+    }
+  }
+
+  // pull a sample of the old root up so that the coarsest level still
+  // covers the points added so far
+  Node &newRoot = *this->root;
+  std::vector<float> keptPoints;
+  std::vector<uint8_t> keptColors;
+  keptPoints.reserve(oldRoot->points.size());
+  keptColors.reserve(oldRoot->colors.size());
+  for (size_t i = 0u; i < oldRoot->PointCount(); ++i)
+  {
+    const float *p = oldRoot->points.data() + i * 3u;
+    const uint8_t *c = oldRoot->colors.data() + i * 4u;
+    if (newRoot.cells.insert(Cell(newRoot, p)).second)
+    {
+      newRoot.points.insert(newRoot.points.end(), p, p + 3);
+      newRoot.colors.insert(newRoot.colors.end(), c, c + 4);
+    }
+    else
+    {
+      keptPoints.insert(keptPoints.end(), p, p + 3);
+      keptColors.insert(keptColors.end(), c, c + 4);
+    }
+  }
+
+  if (keptPoints.size() != oldRoot->points.size())
+  {
+    oldRoot->points.swap(keptPoints);
+    oldRoot->colors.swap(keptColors);
+    ++oldRoot->version;
+    if (!oldRoot->leaf)
+    {
+      oldRoot->cells.clear();
+      for (size_t i = 0u; i < oldRoot->PointCount(); ++i)
+      {
+        oldRoot->cells.insert(
+            Cell(*oldRoot, oldRoot->points.data() + i * 3u));
+      }
+    }
+  }
+
+  const unsigned int octant = Octant(newRoot, oldRoot->center.ptr());
+  newRoot.children[octant] = std::move(oldRoot);
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudOctree::InsertPoint(Node *_node, const float *_point,
+    const uint8_t *_color)
+{
+  Node *node = _node;
+  while (!node->leaf)
+  {
+    // keep the point here if its cell is free, otherwise pass it down
+    if (node->cells.insert(Cell(*node, _point)).second)
+    {
+      node->points.insert(node->points.end(), _point, _point + 3);
+      node->colors.insert(node->colors.end(), _color, _color + 4);
+      return;
+    }
+
+    const unsigned int octant = Octant(*node, _point);
+    std::unique_ptr<Node> &child = node->children[octant];
+    if (!child)
+    {
+      const Ogre::Real offset = node->halfSize * Ogre::Real(0.5);
+      const Ogre::Vector3 center = node->center + Ogre::Vector3(
+          (octant & 1u) ? offset : -offset,
+          (octant & 2u) ? offset : -offset,
+          (octant & 4u) ? offset : -offset);
+      child = this->CreateNode(center, offset, node->depth + 1u);
+    }
+    node = child.get();
+  }
+
+  node->points.insert(node->points.end(), _point, _point + 3);
+  node->colors.insert(node->colors.end(), _color, _color + 4);
+  if (node->PointCount() > kMaxLeafPoints && node->depth < kMaxDepth)
+    this->Split(node);
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudOctree::Split(Node *_node)
+{
+  std::vector<float> points;
+  std::vector<uint8_t> colors;
+  points.swap(_node->points);
+  colors.swap(_node->colors);
+  _node->leaf = false;
+  ++_node->version;
+
+  for (size_t i = 0u; i < points.size() / 3u; ++i)
+    this->InsertPoint(_node, points.data() + i * 3u, colors.data() + i * 4u);
+}
+
+//////////////////////////////////////////////////
+uint32_t Ogre2PointCloudOctree::Cell(const Node &_node, const float *_point)
+{
+  const Ogre::Real scale =
+      static_cast<Ogre::Real>(kGridSize) / (_node.halfSize * 2);
+  uint32_t cell[3];
+  for (unsigned int a = 0u; a < 3u; ++a)
+  {
+    const Ogre::Real t =
+        (_point[a] - (_node.center[a] - _node.halfSize)) * scale;
+    cell[a] = static_cast<uint32_t>(std::clamp(static_cast<int64_t>(t),
+        int64_t(0), static_cast<int64_t>(kGridSize) - 1));
+  }
+  return cell[0] + kGridSize * (cell[1] + kGridSize * cell[2]);
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2PointCloudOctree::Octant(const Node &_node,
+    const float *_point)
+{
+  return (_point[0] >= _node.center.x ? 1u : 0u) |
+         (_point[1] >= _node.center.y ? 2u : 0u) |
+         (_point[2] >= _node.center.z ? 4u : 0u);
+}
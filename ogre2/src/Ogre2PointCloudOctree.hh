@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_RENDERING_OGRE2_OGRE2POINTCLOUDOCTREE_HH_
+#define GZ_RENDERING_OGRE2_OGRE2POINTCLOUDOCTREE_HH_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "gz/rendering/config.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Math/Simple/OgreAabb.h>
+#include <OgreVector3.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+namespace gz
+{
+  namespace rendering
+  {
+    inline namespace GZ_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Octree of points used by Ogre2PointCloudVisual, where every
+    /// level of detail adds points to the levels above it.
+    ///
+    /// Every internal node keeps at most one point per cell of a
+    /// kGridSize^3 grid over its bounds and passes the other points down to
+    /// its children, so drawing the nodes from the root down to some depth
+    /// draws the cloud with a spacing of about the cell size of that depth.
+    /// Leaves keep all their points until they hold more than
+    /// kMaxLeafPoints and are split.
+    ///
+    /// The root grows to contain points added outside of it. The octree is
+    /// not thread safe, Ogre2PointCloudVisual guards it with a mutex.
+    class Ogre2PointCloudOctree
+    {
+      /// \brief Number of sampling cells along each axis of a node
+      public: static constexpr unsigned int kGridSize = 128u;
+
+      /// \brief Number of points a leaf holds before it is split
+      public: static constexpr size_t kMaxLeafPoints = 16384u;
+
+      /// \brief Depth past which leaves are no longer split
+      public: static constexpr unsigned int kMaxDepth = 20u;
+
+      /// \brief Node of the octree
+      public: struct Node
+      {
+        /// \brief Unique id of the node, never reused by an octree
+        uint32_t id = 0u;
+
+        /// \brief Depth of the node, the root is at depth 0
+        unsigned int depth = 0u;
+
+        /// \brief Center of the node
+        Ogre::Vector3 center = Ogre::Vector3::ZERO;
+
+        /// \brief Half the size of the node along each axis
+        Ogre::Real halfSize = 0;
+
+        /// \brief True if the node has never been split
+        bool leaf = true;
+
+        /// \brief Point coordinates, 3 floats per point
+        std::vector<float> points;
+
+        /// \brief Point colors, 4 bytes per point in RGBA order
+        std::vector<uint8_t> colors;
+
+        /// \brief Sampling cells holding a point, internal nodes only
+        std::unordered_set<uint32_t> cells;
+
+        /// \brief Incremented every time points are removed from the node
+        /// or reordered. Points appended to the node leave it unchanged.
+        uint64_t version = 0u;
+
+        /// \brief Children, indexed by octant
+        std::array<std::unique_ptr<Node>, 8> children;
+
+        /// \brief Get the number of points held by the node
+        /// \return Number of points
+        public: size_t PointCount() const
+        {
+          return this->points.size() / 3u;
+        }
+
+        /// \brief Get the bounds of the node
+        /// \return Bounds of the node
+        public: Ogre::Aabb Bounds() const
+        {
+          return Ogre::Aabb(this->center, Ogre::Vector3(this->halfSize));
+        }
+
+        /// \brief Get the distance between the points of the node when its
+        /// sampling grid is full
+        /// \return Size of a sampling cell
+        public: Ogre::Real Spacing() const
+        {
+          return this->halfSize * 2 / static_cast<Ogre::Real>(kGridSize);
+        }
+      };
+
+      /// \brief Insert points
+      /// \param[in] _points Point coordinates, 3 floats per point. All
+      /// coordinates must be finite.
+      /// \param[in] _colors Point colors, 4 bytes per point
+      /// \param[in] _count Number of points
+      public: void Insert(const float *_points, const uint8_t *_colors,
+                          size_t _count);
+
+      /// \brief Remove all the points and nodes
+      public: void Clear();
+
+      /// \brief Get the root of the octree
+      /// \return Root, or null if the octree is empty
+      public: const Node *Root() const;
+
+      /// \brief Get the number of points in the octree
+      /// \return Number of points
+      public: size_t PointCount() const;
+
+      /// \brief Get the number of nodes in the octree
+      /// \return Number of nodes
+      public: size_t NodeCount() const;
+
+      /// \brief Create a node
+      /// \param[in] _center Center of the node
+      /// \param[in] _halfSize Half the size of the node
+      /// \param[in] _depth Depth of the node
+      /// \return The node
+      private: std::unique_ptr<Node> CreateNode(const Ogre::Vector3 &_center,
+                   Ogre::Real _halfSize, unsigned int _depth);
+
+      /// \brief Double the size of the root toward a point outside of it
+      /// \param[in] _point Point outside of the root
+      private: void Grow(const Ogre::Vector3 &_point);
+
+      /// \brief Insert a point into a node or its descendants
+      /// \param[in] _node Node to insert the point into
+      /// \param[in] _point Point coordinates
+      /// \param[in] _color Point color, 4 bytes
+      private: void InsertPoint(Node *_node, const float *_point,
+                   const uint8_t *_color);
+
+      /// \brief Split a leaf holding too many points
+      /// \param[in] _node Leaf to split
+      private: void Split(Node *_node);
+
+      /// \brief Get the sampling cell of a node a point falls in
+      /// \param[in] _node Node
+      /// \param[in] _point Point coordinates
+      /// \return Index of the cell
+      private: static uint32_t Cell(const Node &_node, const float *_point);
+
+      /// \brief Get the octant of a node a point falls in
+      /// \param[in] _node Node
+      /// \param[in] _point Point coordinates
+      /// \return Index of the octant
+      private: static unsigned int Octant(const Node &_node,
+                   const float *_point);
+
+      /// \brief Root node
+      private: std::unique_ptr<Node> root;
+
+      /// \brief Number of points
+      private: size_t pointCount = 0u;
+
+      /// \brief Number of nodes
+      private: size_t nodeCount = 0u;
+
+      /// \brief Id of the next node created
+      private: uint32_t nextId = 0u;
+    };
+    }
+  }
+}
+#endif
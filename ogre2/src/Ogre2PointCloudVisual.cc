@@ -0,0 +1,721 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifdef __APPLE__
+  #define GL_SILENCE_DEPRECATION
+  #include <OpenGL/gl.h>
+  #include <OpenGL/glext.h>
+#else
+#ifndef _WIN32
+  #include <GL/gl.h>
+#endif
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Profiler.hh>
+
+#include "gz/rendering/ogre2/Ogre2Camera.hh"
+#include "gz/rendering/ogre2/Ogre2DepthCamera.hh"
+#include "gz/rendering/ogre2/Ogre2ParticleEmitter.hh"
+#include "gz/rendering/ogre2/Ogre2PointCloudVisual.hh"
+#include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "gz/rendering/ogre2/Ogre2Scene.hh"
+
+#include "Ogre2PointCloudOctree.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreCamera.h>
+#include <OgreItem.h>
+#include <OgreMaterialManager.h>
+#include <OgreMesh2.h>
+#include <OgreMeshManager2.h>
+#include <OgreRoot.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreSubMesh2.h>
+#include <OgreTechnique.h>
+#include <OgreViewport.h>
+#include <Vao/OgreVaoManager.h>
+#include <Vao/OgreVertexArrayObject.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Number of points the background thread inserts into the octree
+/// at once, which bounds how long it holds the octree lock
+static constexpr size_t kInsertChunk = 16384u;
+
+/// \brief Smallest number of points a node buffer is created for
+static constexpr size_t kMinNodeCapacity = 256u;
+
+/// \brief Private data for the Ogre2PointCloudVisual class. Also the
+/// listener selecting the octree nodes every camera draws.
+class gz::rendering::Ogre2PointCloudVisual::Implementation
+  : public Ogre::Camera::Listener
+{
+  /// \brief Points passed to AddPoints, waiting to be inserted
+  public: struct Batch
+  {
+    /// \brief Point coordinates, 3 floats per point
+    std::vector<float> points;
+
+    /// \brief Point colors, 4 bytes per point
+    std::vector<uint8_t> colors;
+
+    /// \brief Octree generation the points were added to
+    uint64_t generation = 0u;
+  };
+
+  /// \brief GPU resources of an octree node
+  public: struct GpuNode
+  {
+    /// \brief Mesh holding the points of the node
+    Ogre::MeshPtr mesh;
+
+    /// \brief Item drawing the mesh
+    Ogre::Item *item = nullptr;
+
+    /// \brief Vertex array object of the mesh
+    Ogre::VertexArrayObject *vao = nullptr;
+
+    /// \brief Point coordinates
+    Ogre::VertexBufferPacked *positions = nullptr;
+
+    /// \brief Point colors
+    Ogre::VertexBufferPacked *colors = nullptr;
+
+    /// \brief Number of points the buffers can hold
+    size_t capacity = 0u;
+
+    /// \brief Number of points uploaded
+    size_t count = 0u;
+
+    /// \brief Version of the octree node the points were uploaded from
+    uint64_t version = 0u;
+
+    /// \brief Last frame a camera drew the node
+    uint64_t lastDrawnFrame = 0u;
+
+    /// \brief Last camera pass that selected the node
+    uint64_t selectedPass = 0u;
+  };
+
+  /// \brief Node a camera asked for
+  public: struct Request
+  {
+    /// \brief Octree node
+    const Ogre2PointCloudOctree::Node *node = nullptr;
+
+    /// \brief Projected size of the node, larger nodes are uploaded first
+    Ogre::Real priority = 0;
+  };
+
+  /// \brief Select the nodes the camera draws and show their items
+  /// \param[in] _cam Camera about to render
+  public: virtual void cameraPreRenderScene(Ogre::Camera *_cam) override;
+
+  /// \brief Insert the batches passed to AddPoints into the octree
+  public: void InsertBatches();
+
+  /// \brief Destroy the item, mesh and buffers of a node
+  /// \param[in] _node Node to destroy
+  /// \param[in] _vaoManager Manager of the node buffers
+  public: void DestroyGpuNode(GpuNode &_node, Ogre::VaoManager *_vaoManager);
+
+  /// \brief Octree of all the inserted points
+  public: Ogre2PointCloudOctree octree;
+
+  /// \brief Guards the octree, the generation and the requests
+  public: std::mutex octreeMutex;
+
+  /// \brief Incremented every time the points are cleared
+  public: std::atomic<uint64_t> generation{0u};
+
+  /// \brief Batches waiting to be inserted
+  public: std::deque<Batch> batches;
+
+  /// \brief Guards the batches and stopWorker
+  public: std::mutex batchMutex;
+
+  /// \brief Notified when a batch is added or the worker is stopped
+  public: std::condition_variable batchCondition;
+
+  /// \brief True to stop the worker thread
+  public: bool stopWorker = false;
+
+  /// \brief Thread inserting the batches into the octree
+  public: std::thread worker;
+
+  /// \brief Number of points added
+  public: std::atomic<size_t> pointCount{0u};
+
+  /// \brief GPU resources of the nodes, by node id
+  public: std::unordered_map<uint32_t, GpuNode> gpuNodes;
+
+  /// \brief Octree generation the GPU nodes belong to
+  public: uint64_t gpuGeneration = 0u;
+
+  /// \brief Number of points the node buffers can hold, in total
+  public: size_t residentPoints = 0u;
+
+  /// \brief Nodes the cameras asked for since the last upload, by node id
+  public: std::unordered_map<uint32_t, Request> requests;
+
+  /// \brief Octree generation of the requests
+  public: uint64_t requestGeneration = 0u;
+
+  /// \brief Incremented every PreRender
+  public: uint64_t frame = 0u;
+
+  /// \brief Incremented every time a camera selects nodes
+  public: uint64_t pass = 0u;
+
+  /// \brief Number of points drawn by the last camera
+  public: size_t drawnPointCount = 0u;
+
+  /// \brief Copy of the screen space error, read by the listener
+  public: double screenSpaceError = 2.0;
+
+  /// \brief Copy of the point budget, read by the listener
+  public: size_t pointBudget = 0u;
+
+  /// \brief True if the visual is visible
+  public: bool visible = true;
+
+  /// \brief Scene node of the visual
+  public: Ogre::SceneNode *ogreNode = nullptr;
+
+  /// \brief Material of the points
+  public: Ogre::MaterialPtr material;
+
+  /// \brief Cameras the listener has been added to, and their names
+  public: std::unordered_map<Ogre::Camera *, Ogre::IdString>
+      camerasWithListener;
+};
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::Implementation::InsertBatches()
+{
+  while (true)
+  {
+    Batch batch;
+    {
+      std::unique_lock<std::mutex> lock(this->batchMutex);
+      this->batchCondition.wait(lock, [this]
+          {
+            return this->stopWorker || !this->batches.empty();
+          });
+      if (this->stopWorker)
+        return;
+      batch = std::move(this->batches.front());
+      this->batches.pop_front();
+    }
+
+    // insert a chunk at a time so the render thread never waits long
+    const size_t count = batch.points.size() / 3u;
+    for (size_t start = 0u; start < count; start += kInsertChunk)
+    {
+      std::lock_guard<std::mutex> lock(this->octreeMutex);
+      if (batch.generation != this->generation)
+        break;
+      this->octree.Insert(batch.points.data() + start * 3u,
+          batch.colors.data() + start * 4u,
+          std::min(kInsertChunk, count - start));
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::Implementation::DestroyGpuNode(GpuNode &_node,
+    Ogre::VaoManager *_vaoManager)
+{
+  this->residentPoints -= _node.capacity;
+  _node.item->_getManager()->destroyItem(_node.item);
+  _node.item = nullptr;
+  Ogre::SubMesh *subMesh = _node.mesh->getSubMesh(0);
+  subMesh->destroyVaos(subMesh->mVao[Ogre::VpNormal], _vaoManager);
+  subMesh->mVao[Ogre::VpShadow].clear();
+  Ogre::MeshManager::getSingleton().remove(_node.mesh->getName());
+  _node.mesh.reset();
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::Implementation::cameraPreRenderScene(
+    Ogre::Camera *_cam)
+{
+  GZ_PROFILE("Ogre2PointCloudVisual::cameraPreRenderScene");
+  ++this->pass;
+  size_t drawn = 0u;
+
+  Ogre::Viewport *viewport = _cam->getLastViewport();
+  if (this->visible && viewport)
+  {
+    std::lock_guard<std::mutex> lock(this->octreeMutex);
+    if (this->requestGeneration != this->generation)
+    {
+      this->requests.clear();
+      this->requestGeneration = this->generation;
+    }
+
+    // size in pixels of one unit of length at unit distance
+    const bool ortho = _cam->getProjectionType() == Ogre::PT_ORTHOGRAPHIC;
+    const Ogre::Real height =
+        static_cast<Ogre::Real>(viewport->getActualHeight());
+    const Ogre::Real pixelScale = ortho ?
+        height / _cam->getOrthoWindowHeight() :
+        height / (2 * std::tan(_cam->getFOVy().valueRadians() / 2));
+    const Ogre::Vector3 scale = this->ogreNode->_getDerivedScale();
+    const Ogre::Real worldScale = std::max({std::abs(scale.x),
+        std::abs(scale.y), std::abs(scale.z)}) * pixelScale;
+    const Ogre::Matrix4 &world = this->ogreNode->_getFullTransform();
+    const Ogre::Vector3 cameraPos = _cam->getDerivedPosition();
+    const Ogre::Real nearDistance = _cam->getNearClipDistance();
+
+    // visit the largest nodes on screen first so the point budget is spent
+    // on the coarse levels before the fine ones
+    using Entry = std::pair<Ogre::Real, const Ogre2PointCloudOctree::Node *>;
+    std::priority_queue<Entry> queue;
+    if (this->octree.Root())
+    {
+      queue.emplace(std::numeric_limits<Ogre::Real>::max(),
+          this->octree.Root());
+    }
+
+    size_t selected = 0u;
+    while (!queue.empty())
+    {
+      const auto [priority, node] = queue.top();
+      queue.pop();
+
+      Ogre::Aabb bounds = node->Bounds();
+      bounds.transformAffine(world);
+      if (!_cam->isVisible(Ogre::AxisAlignedBox(bounds.getMinimum(),
+          bounds.getMaximum())))
+      {
+        continue;
+      }
+
+      if (selected > 0u && selected + node->PointCount() > this->pointBudget)
+        continue;
+      selected += node->PointCount();
+
+      Request &request = this->requests[node->id];
+      request.node = node;
+      request.priority = std::max(request.priority, priority);
+
+      auto gpuNode = this->gpuNodes.find(node->id);
+      if (gpuNode != this->gpuNodes.end() && gpuNode->second.count > 0u)
+      {
+        gpuNode->second.selectedPass = this->pass;
+        gpuNode->second.lastDrawnFrame = this->frame;
+        drawn += gpuNode->second.count;
+      }
+
+      // draw the children when the spacing of this level is too coarse
+      const Ogre::Real distance = ortho ? Ogre::Real(1) : std::max(
+          bounds.getCenter().distance(cameraPos) - bounds.getRadius(),
+          nearDistance);
+      if (node->Spacing() * worldScale / distance <= this->screenSpaceError)
+        continue;
+
+      for (const auto &child : node->children)
+      {
+        if (!child)
+          continue;
+        const Ogre::Real childDistance = ortho ? Ogre::Real(1) : std::max(
+            (world * child->center).distance(cameraPos), nearDistance);
+        queue.emplace(child->halfSize * worldScale / childDistance,
+            child.get());
+      }
+    }
+  }
+
+  for (auto &gpuNode : this->gpuNodes)
+  {
+    gpuNode.second.item->setVisible(
+        gpuNode.second.selectedPass == this->pass);
+  }
+  this->drawnPointCount = drawn;
+}
+
+//////////////////////////////////////////////////
+Ogre2PointCloudVisual::Ogre2PointCloudVisual()
+    : dataPtr(utils::MakeUniqueImpl<Implementation>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2PointCloudVisual::~Ogre2PointCloudVisual()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::PreRender()
+{
+  GZ_PROFILE("Ogre2PointCloudVisual::PreRender");
+  if (!this->dataPtr->material)
+  {
+    // enable GL_PROGRAM_POINT_SIZE so we can set gl_PointSize in vertex
+    // shader
+    auto engine = Ogre2RenderEngine::Instance();
+    std::string renderSystemName =
+        engine->OgreRoot()->getRenderSystem()->getFriendlyName();
+    if (renderSystemName.find("OpenGL") != std::string::npos)
+    {
+    #ifdef __APPLE__
+      glEnable(GL_VERTEX_PROGRAM_POINT_SIZE);
+    #else
+    #ifndef _WIN32
+      glEnable(GL_PROGRAM_POINT_SIZE);
+    #endif
+    #endif
+    }
+    this->dataPtr->material =
+        Ogre::MaterialManager::getSingleton().getByName("PointCloudPoint");
+    this->dataPtr->ogreNode = this->ogreNode;
+  }
+
+  // point renderables use low level materials
+  // get the material and set size uniform variable
+  auto pass = this->dataPtr->material->getTechnique(0)->getPass(0);
+  auto vertParams = pass->getVertexProgramParameters();
+  vertParams->setNamedConstant("size", static_cast<Ogre::Real>(this->size));
+
+  this->dataPtr->screenSpaceError = this->screenSpaceError;
+  this->dataPtr->pointBudget = this->pointBudget;
+
+  this->UpdateCameraListener();
+  this->UpdateGpuNodes();
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::Destroy()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->batchMutex);
+    this->dataPtr->stopWorker = true;
+    this->dataPtr->batches.clear();
+  }
+  this->dataPtr->batchCondition.notify_all();
+  if (this->dataPtr->worker.joinable())
+    this->dataPtr->worker.join();
+
+  if (this->scene && this->scene->IsInitialized())
+  {
+    for (const auto &ogreCamIt : this->dataPtr->camerasWithListener)
+    {
+      // find the camera again in case it was destroyed already
+      auto ogreCam = this->scene->OgreSceneManager()->findCameraNoThrow(
+          ogreCamIt.second);
+      if (ogreCam)
+        ogreCam->removeListener(this->dataPtr.get());
+    }
+    this->DestroyGpuNodes();
+  }
+  this->dataPtr->camerasWithListener.clear();
+
+  BasePointCloudVisual::Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::AddPoints(const float *_points,
+    const uint8_t *_colors, size_t _count)
+{
+  GZ_PROFILE("Ogre2PointCloudVisual::AddPoints");
+  Implementation::Batch batch;
+  batch.points.reserve(_count * 3u);
+  batch.colors.reserve(_count * 4u);
+  for (size_t i = 0u; i < _count; ++i)
+  {
+    const float *p = _points + i * 3u;
+    if (!std::isfinite(p[0]) || !std::isfinite(p[1]) || !std::isfinite(p[2]))
+      continue;
+    batch.points.insert(batch.points.end(), p, p + 3);
+    batch.colors.insert(batch.colors.end(), _colors + i * 4u,
+        _colors + i * 4u + 4u);
+  }
+  if (batch.points.empty())
+    return;
+
+  this->dataPtr->pointCount += batch.points.size() / 3u;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->batchMutex);
+    if (this->dataPtr->stopWorker)
+      return;
+    batch.generation = this->dataPtr->generation;
+    this->dataPtr->batches.push_back(std::move(batch));
+    if (!this->dataPtr->worker.joinable())
+    {
+      this->dataPtr->worker = std::thread(
+          &Implementation::InsertBatches, this->dataPtr.get());
+    }
+  }
+  this->dataPtr->batchCondition.notify_one();
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::ClearPoints()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->batchMutex);
+    this->dataPtr->batches.clear();
+  }
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->octreeMutex);
+    this->dataPtr->octree.Clear();
+    this->dataPtr->requests.clear();
+    ++this->dataPtr->generation;
+  }
+  this->dataPtr->pointCount = 0u;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2PointCloudVisual::PointCount() const
+{
+  return this->dataPtr->pointCount;
+}
+
+//////////////////////////////////////////////////
+size_t Ogre2PointCloudVisual::DrawnPointCount() const
+{
+  return this->dataPtr->drawnPointCount;
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::SetVisible(bool _visible)
+{
+  BasePointCloudVisual::SetVisible(_visible);
+  this->dataPtr->visible = _visible;
+
+  // the camera listener shows the nodes each camera selects
+  for (auto &gpuNode : this->dataPtr->gpuNodes)
+    gpuNode.second.item->setVisible(false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::UpdateCameraListener()
+{
+  GZ_PROFILE("Ogre2PointCloudVisual::UpdateCameraListener");
+  for (unsigned int i = 0; i < this->scene->SensorCount(); ++i)
+  {
+    auto sensor = this->scene->SensorByIndex(i);
+    Ogre::Camera *ogreCam = nullptr;
+    Ogre2CameraPtr camera = std::dynamic_pointer_cast<Ogre2Camera>(sensor);
+    if (camera)
+    {
+      ogreCam = camera->OgreCamera();
+    }
+    else
+    {
+      // depth camera can also generate rgb output (when simulating
+      // RGBD cameras)
+      Ogre2DepthCameraPtr depthCamera =
+          std::dynamic_pointer_cast<Ogre2DepthCamera>(sensor);
+      if (depthCamera)
+        ogreCam = depthCamera->OgreCamera();
+    }
+
+    if (ogreCam && this->dataPtr->camerasWithListener.find(ogreCam) ==
+        this->dataPtr->camerasWithListener.end())
+    {
+      ogreCam->addListener(this->dataPtr.get());
+      this->dataPtr->camerasWithListener[ogreCam] = ogreCam->getName();
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::UpdateGpuNodes()
+{
+  GZ_PROFILE("Ogre2PointCloudVisual::UpdateGpuNodes");
+  ++this->dataPtr->frame;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->octreeMutex);
+  if (this->dataPtr->gpuGeneration != this->dataPtr->generation)
+  {
+    this->DestroyGpuNodes();
+    this->dataPtr->gpuGeneration = this->dataPtr->generation;
+  }
+  if (this->dataPtr->requestGeneration != this->dataPtr->generation)
+    this->dataPtr->requests.clear();
+
+  // nodes the cameras asked for that are missing or out of date, largest
+  // on screen first
+  std::vector<Implementation::Request> pending;
+  for (const auto &request : this->dataPtr->requests)
+  {
+    const Ogre2PointCloudOctree::Node *node = request.second.node;
+    auto gpuNode = this->dataPtr->gpuNodes.find(node->id);
+    if (gpuNode == this->dataPtr->gpuNodes.end() ||
+        gpuNode->second.version != node->version ||
+        gpuNode->second.count != node->PointCount())
+    {
+      pending.push_back(request.second);
+    }
+  }
+  this->dataPtr->requests.clear();
+  std::sort(pending.begin(), pending.end(),
+      [](const Implementation::Request &_a, const Implementation::Request &_b)
+      {
+        return _a.priority > _b.priority;
+      });
+
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  Ogre::VaoManager *vaoManager =
+      sceneManager->getDestinationRenderSystem()->getVaoManager();
+
+  size_t uploaded = 0u;
+  for (const auto &request : pending)
+  {
+    const Ogre2PointCloudOctree::Node *node = request.node;
+    const size_t count = node->PointCount();
+    if (count == 0u)
+      continue;
+
+    auto gpuNode = this->dataPtr->gpuNodes.find(node->id);
+    const bool reupload = gpuNode == this->dataPtr->gpuNodes.end() ||
+        gpuNode->second.version != node->version ||
+        gpuNode->second.count > count;
+    const size_t start = reupload ? 0u : gpuNode->second.count;
+    if (uploaded > 0u && uploaded + count - start > this->uploadBudget)
+      continue;
+
+    // create the buffers, with room for the node to grow
+    if (gpuNode == this->dataPtr->gpuNodes.end() ||
+        gpuNode->second.capacity < count)
+    {
+      if (gpuNode != this->dataPtr->gpuNodes.end())
+      {
+        this->dataPtr->DestroyGpuNode(gpuNode->second, vaoManager);
+        this->dataPtr->gpuNodes.erase(gpuNode);
+      }
+
+      Implementation::GpuNode newNode;
+      newNode.capacity = kMinNodeCapacity;
+      while (newNode.capacity < count)
+        newNode.capacity *= 2u;
+      // not evicted before the cameras had a chance to draw it
+      newNode.lastDrawnFrame = this->dataPtr->frame;
+
+      Ogre::VertexElement2Vec positionElements;
+      positionElements.push_back(
+          Ogre::VertexElement2(Ogre::VET_FLOAT3, Ogre::VES_POSITION));
+      newNode.positions = vaoManager->createVertexBuffer(positionElements,
+          newNode.capacity, Ogre::BT_DEFAULT, nullptr, false);
+
+      // the point cloud shaders read the color from the normal
+      Ogre::VertexElement2Vec colorElements;
+      colorElements.push_back(
+          Ogre::VertexElement2(Ogre::VET_UBYTE4_NORM, Ogre::VES_NORMAL));
+      newNode.colors = vaoManager->createVertexBuffer(colorElements,
+          newNode.capacity, Ogre::BT_DEFAULT, nullptr, false);
+
+      Ogre::VertexBufferPackedVec vertexBuffers;
+      vertexBuffers.push_back(newNode.positions);
+      vertexBuffers.push_back(newNode.colors);
+      newNode.vao = vaoManager->createVertexArrayObject(
+          vertexBuffers, nullptr, Ogre::OT_POINT_LIST);
+
+      newNode.mesh = Ogre::MeshManager::getSingleton().createManual(
+          this->Name() + "_node_" + std::to_string(node->id),
+          Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+      Ogre::SubMesh *subMesh = newNode.mesh->createSubMesh();
+      subMesh->mVao[Ogre::VpNormal].push_back(newNode.vao);
+      subMesh->mVao[Ogre::VpShadow].push_back(newNode.vao);
+      newNode.mesh->_setBounds(node->Bounds(), false);
+      newNode.mesh->_setBoundingSphereRadius(node->Bounds().getRadius());
+
+      newNode.item = sceneManager->createItem(newNode.mesh,
+          Ogre::SCENE_DYNAMIC);
+      newNode.item->setCastShadows(false);
+      newNode.item->setVisibilityFlags(this->VisibilityFlags()
+          & ~Ogre2ParticleEmitter::kParticleVisibilityFlags);
+      newNode.item->getSubItem(0)->setMaterial(this->dataPtr->material);
+      newNode.item->setVisible(false);
+      this->ogreNode->attachObject(newNode.item);
+
+      this->dataPtr->residentPoints += newNode.capacity;
+      gpuNode = this->dataPtr->gpuNodes.emplace(node->id, newNode).first;
+    }
+
+    Implementation::GpuNode &target = gpuNode->second;
+    const size_t newCount = count - start;
+    target.positions->upload(node->points.data() + start * 3u,
+        start, newCount);
+    target.colors->upload(node->colors.data() + start * 4u,
+        start, newCount);
+    target.vao->setPrimitiveRange(0u, count);
+    target.count = count;
+    target.version = node->version;
+    uploaded += newCount;
+  }
+
+  // evict the nodes drawn least recently, never the ones drawn last frame
+  if (this->dataPtr->residentPoints > this->gpuPointBudget)
+  {
+    std::vector<std::pair<uint64_t, uint32_t>> candidates;
+    for (const auto &gpuNode : this->dataPtr->gpuNodes)
+    {
+      if (gpuNode.second.lastDrawnFrame + 1u < this->dataPtr->frame)
+      {
+        candidates.emplace_back(gpuNode.second.lastDrawnFrame,
+            gpuNode.first);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    for (const auto &candidate : candidates)
+    {
+      if (this->dataPtr->residentPoints <= this->gpuPointBudget)
+        break;
+      auto gpuNode = this->dataPtr->gpuNodes.find(candidate.second);
+      this->dataPtr->DestroyGpuNode(gpuNode->second, vaoManager);
+      this->dataPtr->gpuNodes.erase(gpuNode);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2PointCloudVisual::DestroyGpuNodes()
+{
+  if (this->dataPtr->gpuNodes.empty())
+    return;
+
+  Ogre::VaoManager *vaoManager = this->scene->OgreSceneManager()->
+      getDestinationRenderSystem()->getVaoManager();
+  for (auto &gpuNode : this->dataPtr->gpuNodes)
+    this->dataPtr->DestroyGpuNode(gpuNode.second, vaoManager);
+  this->dataPtr->gpuNodes.clear();
+}
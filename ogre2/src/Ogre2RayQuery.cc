@@ -15,9 +15,15 @@
  *
  */
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Mesh.hh>
-#include <gz/common/MeshManager.hh>
 #include <gz/common/SubMesh.hh>
 #include <gz/common/Profiler.hh>
 
@@ -32,9 +38,13 @@
 #include "gz/rendering/ogre2/Ogre2ThermalCamera.hh"
 #include "gz/rendering/ogre2/Ogre2WideAngleCamera.hh"
 
+#include "Ogre2MeshBvh.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
+#include <Math/Simple/OgreAabb.h>
+#include <OgreAxisAlignedBox.h>
 #include <OgreCamera.h>
 #include <OgreItem.h>
 #include <OgreMesh2.h>
@@ -50,9 +60,10 @@
 // want to benchmark.
 // #define SINGLE_THREADED
 
-// Define this macro to use the old code. Only use this code if for some
-// odd reason you suspect there is a regression (particularly with skeletally
-// animated objects) or you want to benchmark.
+// Define this macro to test every triangle of every mesh in world space
+// instead of traversing the mesh triangle hierarchies. Only use this code if
+// for some odd reason you suspect there is a regression (particularly with
+// skeletally animated objects) or you want to benchmark.
 // The new version should produce identical results (without accounting random
 // floating point precision issues).
 // #define SLOW_METHOD
@@ -285,18 +296,193 @@ RayQueryResult Ogre2RayQuery::ClosestPointBySelectionBuffer()
 
 //////////////////////////////////////////////////
 
+/// \brief An item that may be hit by a ray, to be tested triangle by
+/// triangle
+struct GZ_RENDERING_OGRE2_HIDDEN RayQueryCandidate
+{
+  /// \brief Transform of the item's parent node
+  Ogre::Matrix4 transform;
+
+  /// \brief True if transform is affine, so rays can be mapped into mesh
+  /// space with invTransform and invTransform3x3
+  bool affine = false;
+
+  /// \brief Inverse of transform, only set if it is affine
+  Ogre::Matrix4 invTransform;
+
+  /// \brief Rotation and scale part of invTransform
+  Ogre::Matrix3 invTransform3x3;
+
+  /// \brief World bounds of the item
+  Ogre::Aabb bounds;
+
+  /// \brief Mesh the item was created from
+  const common::Mesh *mesh = nullptr;
+
+  /// \brief Triangle hierarchy of the mesh
+  std::shared_ptr<const Ogre2MeshBvh> bvh;
+
+  /// \brief Id of the object owning the item
+  unsigned int objectId = 0u;
+};
+
+/// \brief Meshes and triangle hierarchies resolved so far, so that items
+/// sharing a mesh only look it up once
+using RayQueryMeshMap = std::unordered_map<const Ogre::Mesh *,
+    std::pair<std::shared_ptr<const Ogre2MeshBvh>, const common::Mesh *>>;
+
+//////////////////////////////////////////////////
+/// \brief Make the candidate of an item if ray queries can hit it
+/// \param[in] _scene Scene owning the item
+/// \param[in] _movable Movable object
+/// \param[in, out] _meshes Meshes resolved so far
+/// \param[out] _candidate Candidate of the item
+/// \return True if the item can be hit
+static bool MakeRayQueryCandidate(Ogre2Scene &_scene,
+    Ogre::MovableObject *_movable, RayQueryMeshMap &_meshes,
+    RayQueryCandidate &_candidate)
+{
+  if (!_movable || !_movable->getVisible())
+    return false;
+
+  auto userAny = _movable->getUserObjectBindings().getUserAny();
+  if (userAny.isEmpty() || userAny.getType() != typeid(unsigned int) ||
+      _movable->getMovableType() != "Item")
+  {
+    return false;
+  }
+
+  Ogre::Item *ogreItem = static_cast<Ogre::Item *>(_movable);
+  const Ogre::Mesh *ogreMesh = ogreItem->getMesh().get();
+  if (!ogreMesh)
+    return false;
+
+  auto meshIt = _meshes.find(ogreMesh);
+  if (meshIt == _meshes.end())
+  {
+    const common::Mesh *mesh = nullptr;
+    auto bvh = _scene.MeshBvhCache().Bvh(*ogreMesh, mesh);
+    meshIt = _meshes.emplace(ogreMesh, std::make_pair(bvh, mesh)).first;
+  }
+  if (!meshIt->second.first)
+    return false;
+
+  _candidate.transform = ogreItem->_getParentNodeFullTransform();
+  _candidate.affine = _candidate.transform.isAffine();
+  if (_candidate.affine)
+  {
+    // once per candidate rather than once per ray
+    _candidate.invTransform = _candidate.transform.inverse();
+    _candidate.invTransform.extract3x3Matrix(_candidate.invTransform3x3);
+  }
+  _candidate.bounds = ogreItem->getWorldAabb();
+  _candidate.bvh = meshIt->second.first;
+  _candidate.mesh = meshIt->second.second;
+  _candidate.objectId = Ogre::any_cast<unsigned int>(userAny);
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Intersect a ray with the triangles of a candidate
+/// \param[in] _candidate Candidate
+/// \param[in] _rayOrigin Raycast's origin
+/// \param[in] _rayDir Raycast's direction
+/// \param[in, out] _distance Distance to the closest hit so far, updated if
+/// the candidate is hit closer
+/// \param[in, out] _result Closest hit so far, updated if the candidate is
+/// hit closer
+static void IntersectRayQueryCandidate(const RayQueryCandidate &_candidate,
+    const Ogre::Vector3 &_rayOrigin, const Ogre::Vector3 &_rayDir,
+    double &_distance, RayQueryResult &_result)
+{
+  const Ogre::Matrix4 &transform = _candidate.transform;
+
+#ifndef SLOW_METHOD
+  if (_candidate.affine)
+  {
+    Ogre::Ray mouseRay(_candidate.invTransform * _rayOrigin,
+        (_candidate.invTransform3x3 * _rayDir).normalisedCopy());
+
+    Ogre::Real hitDistance = std::numeric_limits<Ogre::Real>::max();
+    if (_candidate.bvh->Intersect(mouseRay, hitDistance) &&
+        _distance > hitDistance)
+    {
+      // this is the closest so far, save it off
+      _distance = hitDistance;
+      _result.distance = _distance;
+      _result.point = Ogre2Conversions::Convert(
+        transform * mouseRay.getPoint(hitDistance));
+      _result.objectId = _candidate.objectId;
+    }
+    return;
+  }
+#endif
+
+  // the hierarchy is in mesh space, which a non affine transform does not
+  // map rays into: test every triangle in world space instead
+  Ogre::Ray mouseRay(_rayOrigin, _rayDir);
+  const common::Mesh *mesh = _candidate.mesh;
+  for (unsigned int j = 0; j < mesh->SubMeshCount(); ++j)
+  {
+    auto s = mesh->SubMeshByIndex(j);
+    auto submesh = s.lock();
+    if (!submesh || submesh->VertexCount() < 3u)
+      continue;
+    const unsigned int indexCount = submesh->IndexCount();
+
+    const math::Vector3d *RESTRICT_ALIAS vertices =
+      submesh->VertexPtr();
+    const unsigned int *RESTRICT_ALIAS indices = submesh->IndexPtr();
+
+    std::pair<bool, Ogre::Real> bestHit = {
+      false, std::numeric_limits<Ogre::Real>::max()
+    };
+
+    for (unsigned int k = 0; k + 2 < indexCount; k += 3)
+    {
+      Ogre::Vector3 worldVertexA =
+        transform * Ogre2Conversions::Convert(vertices[indices[k]]);
+      Ogre::Vector3 worldVertexB =
+        transform * Ogre2Conversions::Convert(vertices[indices[k + 1]]);
+      Ogre::Vector3 worldVertexC =
+        transform * Ogre2Conversions::Convert(vertices[indices[k + 2]]);
+
+      // check for a hit against this triangle
+      std::pair<bool, Ogre::Real> hit = Ogre::Math::intersects(
+        mouseRay, worldVertexA, worldVertexB, worldVertexC, true, false);
+
+      // if it was a hit check if its the closest
+      if (hit.first && hit.second < bestHit.second)
+      {
+        bestHit = hit;
+      }
+    }
+
+    if (bestHit.first && _distance > bestHit.second)
+    {
+      // this is the closest so far, save it off
+      _distance = bestHit.second;
+      _result.distance = _distance;
+      _result.point = Ogre2Conversions::Convert(mouseRay.getPoint(_distance));
+      _result.objectId = _candidate.objectId;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+
 /// \brief This class performs a Triangle-level raycast over the broadphase
 /// results returned by OgreNext spreading the work as evenly as possible
 /// across multiple threads
 ///
-/// On multicore machines this can lead to considerable speed ups, specially
-/// if the scene has a lot of triangles.
+/// Meshes are intersected through their cached triangle hierarchy
+/// (Ogre2MeshBvh), so each item costs O(log n) in its triangle count and
+/// the items are split across threads.
 class GZ_RENDERING_OGRE2_HIDDEN ThreadedTriRay final
   : public Ogre::UniformScalableTask
 {
-  /// \brief Stores the result Ogre2RayQueryPrivate::rayQuery->execute
-  /// that we will iterate for triangle intersection matches.
-  private: Ogre::RaySceneQueryResult ogreResult;
+  /// \brief Items hit by the broadphase
+  private: std::vector<RayQueryCandidate> candidates;
 
   /// \brief Raycast's origin
   private: const Ogre::Vector3 rayOrigin;
@@ -309,20 +495,19 @@ class GZ_RENDERING_OGRE2_HIDDEN ThreadedTriRay final
   public: std::vector<RayQueryResult> collectedResults;
 
   /// \brief Constructor
-  /// \param[in, out] _ogreResult Ray Query done by Ogre that we will iterate
-  /// We take ownership of its internal pointer, thus it becomes empty
-  /// afterwards
+  /// \param[in, out] _candidates Items to test. We take ownership of them,
+  /// thus the vector becomes empty afterwards
   /// \param[in] _rayOrigin Raycast's origin
   /// \param[in] _rayDir Raycast's direction
   /// \param[in] _numThreads Number of worker threads
-  public: ThreadedTriRay(Ogre::RaySceneQueryResult &_ogreResult,
+  public: ThreadedTriRay(std::vector<RayQueryCandidate> &_candidates,
                          const Ogre::Vector3 &_rayOrigin,
                          const Ogre::Vector3 &_rayDir,
                          size_t _numThreads) :
       rayOrigin(_rayOrigin),
       rayDir(_rayDir)
   {
-    this->ogreResult.swap(_ogreResult);
+    this->candidates.swap(_candidates);
     this->collectedResults.resize(_numThreads);
   }
 
@@ -339,157 +524,16 @@ class GZ_RENDERING_OGRE2_HIDDEN ThreadedTriRay final
 void ThreadedTriRay::execute(size_t _threadId, size_t _numThreads)
 {
   GZ_PROFILE("ThreadedTriRay::execute");
-  const unsigned int numThreads = static_cast<unsigned int>(_numThreads);
-  const unsigned int threadId = static_cast<unsigned int>(_threadId);
 
   double distance = std::numeric_limits<double>::max();
 
   RayQueryResult result;
 
-  // Iterate over all the results.
-  for (auto iter = this->ogreResult.begin(); iter != this->ogreResult.end();
-       ++iter)
+  // Iterate over the candidates assigned to this thread.
+  for (size_t i = _threadId; i < this->candidates.size(); i += _numThreads)
   {
-    if (iter->distance <= 0.0)
-      continue;
-
-    if (!iter->movable || !iter->movable->getVisible())
-      continue;
-
-    auto userAny = iter->movable->getUserObjectBindings().getUserAny();
-    if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int) &&
-        iter->movable->getMovableType() == "Item")
-    {
-      Ogre::Item *ogreItem = static_cast<Ogre::Item *>(iter->movable);
-
-      // mesh factory creates name with ::CENTER or ::ORIGINAL depending on
-      // the params passed in the MeshDescriptor when loading the mesh
-      // so strip off the suffix
-      std::string meshName = ogreItem->getMesh()->getName();
-      size_t idx = meshName.find("::");
-      if (idx != std::string::npos)
-        meshName.resize(idx);
-
-      const common::Mesh *mesh =
-        common::MeshManager::Instance()->MeshByName(meshName);
-
-      if (!mesh)
-        continue;
-
-      Ogre::Matrix4 transform = ogreItem->_getParentNodeFullTransform();
-
-      const bool bIsAffine = transform.isAffine();
-
-      Ogre::Ray mouseRay;
-#ifndef SLOW_METHOD
-      if (bIsAffine)
-      {
-        Ogre::Matrix4 invTransform = transform.inverse();
-        Ogre::Matrix3 invTransform3x3;
-        invTransform.extract3x3Matrix(invTransform3x3);
-        mouseRay = Ogre::Ray(invTransform * this->rayOrigin,
-                             (invTransform3x3 * this->rayDir).normalisedCopy());
-      }
-      else
-#endif
-      {
-        mouseRay = Ogre::Ray(this->rayOrigin, this->rayDir);
-      }
-
-      // test for hitting individual triangles on the mesh
-      for (unsigned int j = 0; j < mesh->SubMeshCount(); ++j)
-      {
-        auto s = mesh->SubMeshByIndex(j);
-        auto submesh = s.lock();
-        if (!submesh || submesh->VertexCount() < 3u)
-          continue;
-        const unsigned int indexCount = submesh->IndexCount();
-
-        const math::Vector3d *RESTRICT_ALIAS vertices =
-          submesh->VertexPtr();
-        const unsigned int *RESTRICT_ALIAS indices = submesh->IndexPtr();
-
-        std::pair<bool, Ogre::Real> bestHit = {
-          false, std::numeric_limits<Ogre::Real>::max()
-        };
-
-        // Round up to next multiple of numThreads and divide by it
-        unsigned int indexCountPerThread =
-          (indexCount + (numThreads - 1u)) / numThreads;
-        // indexCountPerThread must be multiple of 3
-        indexCountPerThread = ((indexCountPerThread + 2u) / 3u) * 3u;
-
-        unsigned int indexStart =
-          std::min(indexCountPerThread * threadId, indexCount);
-        unsigned int indexEnd =
-          std::min(indexCountPerThread * (threadId + 1u), indexCount);
-
-        for (unsigned int k = indexStart; k < indexEnd; k += 3)
-        {
-          if (indexCount <= k + 2)
-            continue;
-
-#ifdef SLOW_METHOD
-          math::Vector3d vertexA = submesh->Vertex(submesh->Index(k));
-          math::Vector3d vertexB = submesh->Vertex(submesh->Index(k + 1));
-          math::Vector3d vertexC = submesh->Vertex(submesh->Index(k + 2));
-
-          Ogre::Vector3 worldVertexA =
-            transform * Ogre2Conversions::Convert(vertexA);
-          Ogre::Vector3 worldVertexB =
-            transform * Ogre2Conversions::Convert(vertexB);
-          Ogre::Vector3 worldVertexC =
-            transform * Ogre2Conversions::Convert(vertexC);
-#else
-          Ogre::Vector3 worldVertexA, worldVertexB, worldVertexC;
-
-          if (bIsAffine)
-          {
-            worldVertexA = Ogre2Conversions::Convert(vertices[indices[k]]);
-            worldVertexB = Ogre2Conversions::Convert(vertices[indices[k + 1]]);
-            worldVertexC = Ogre2Conversions::Convert(vertices[indices[k + 2]]);
-          }
-          else
-          {
-            worldVertexA =
-              transform * Ogre2Conversions::Convert(vertices[indices[k]]);
-            worldVertexB =
-              transform * Ogre2Conversions::Convert(vertices[indices[k + 1]]);
-            worldVertexC =
-              transform * Ogre2Conversions::Convert(vertices[indices[k + 2]]);
-          }
-#endif
-
-          // check for a hit against this triangle
-          std::pair<bool, Ogre::Real> hit = Ogre::Math::intersects(
-            mouseRay, worldVertexA, worldVertexB, worldVertexC, true, false);
-
-          // if it was a hit check if its the closest
-          if (hit.first && hit.second < bestHit.second)
-          {
-            bestHit = hit;
-          }
-        }
-
-        if (bestHit.first && distance > bestHit.second)
-        {
-          // this is the closest so far, save it off
-          distance = bestHit.second;
-          result.distance = distance;
-          if (bIsAffine)
-          {
-            result.point = Ogre2Conversions::Convert(
-              transform * mouseRay.getPoint(distance));
-          }
-          else
-          {
-            result.point =
-              Ogre2Conversions::Convert(mouseRay.getPoint(distance));
-          }
-          result.objectId = Ogre::any_cast<unsigned int>(userAny);
-        }
-      }
-    }
+    IntersectRayQueryCandidate(this->candidates[i], this->rayOrigin,
+        this->rayDir, distance, result);
   }
 
   collectedResults[_threadId] = result;
@@ -513,6 +557,89 @@ RayQueryResult ThreadedTriRay::CollapseCollectedResults()
   return result;
 }
 
+//////////////////////////////////////////////////
+
+/// \brief This class performs a Triangle-level raycast of many rays against
+/// the same candidates, splitting the rays across multiple threads
+///
+/// Every ray tests the world bounds of every candidate before intersecting
+/// its triangles, the way the scene query of a single ray does.
+class GZ_RENDERING_OGRE2_HIDDEN ThreadedTriRays final
+  : public Ogre::UniformScalableTask
+{
+  /// \brief Items that may be hit
+  private: const std::vector<RayQueryCandidate> &candidates;
+
+  /// \brief Raycasts' origins
+  private: const std::vector<math::Vector3d> &rayOrigins;
+
+  /// \brief Raycasts' directions
+  private: const std::vector<math::Vector3d> &rayDirs;
+
+  /// \brief Closest hit of every ray
+  private: std::vector<RayQueryResult> &results;
+
+  /// \brief Constructor
+  /// \param[in] _candidates Items to test
+  /// \param[in] _rayOrigins Raycasts' origins
+  /// \param[in] _rayDirs Raycasts' directions, as many as origins
+  /// \param[out] _results Closest hit of every ray, as many as origins
+  public: ThreadedTriRays(const std::vector<RayQueryCandidate> &_candidates,
+                          const std::vector<math::Vector3d> &_rayOrigins,
+                          const std::vector<math::Vector3d> &_rayDirs,
+                          std::vector<RayQueryResult> &_results) :
+      candidates(_candidates),
+      rayOrigins(_rayOrigins),
+      rayDirs(_rayDirs),
+      results(_results)
+  {
+  }
+
+  // Documentation inherited
+  public: void execute(size_t _threadId, size_t _numThreads) override;
+};
+
+//////////////////////////////////////////////////
+void ThreadedTriRays::execute(size_t _threadId, size_t _numThreads)
+{
+  GZ_PROFILE("ThreadedTriRays::execute");
+
+  // contiguous ranges of rays, neighbouring rays tend to hit the same
+  // candidates
+  const size_t rayCount = this->rayOrigins.size();
+  const size_t raysPerThread = (rayCount + _numThreads - 1u) / _numThreads;
+  const size_t begin = std::min(_threadId * raysPerThread, rayCount);
+  const size_t end = std::min(begin + raysPerThread, rayCount);
+
+  for (size_t r = begin; r < end; ++r)
+  {
+    const Ogre::Vector3 rayOrigin =
+        Ogre2Conversions::Convert(this->rayOrigins[r]);
+    const Ogre::Vector3 rayDir = Ogre2Conversions::Convert(this->rayDirs[r]);
+    if (!rayOrigin.isNaN() && !rayDir.isNaN() &&
+        rayDir.squaredLength() > 0)
+    {
+      double distance = std::numeric_limits<double>::max();
+      RayQueryResult result;
+      const Ogre::Ray ray(rayOrigin, rayDir);
+      for (const RayQueryCandidate &candidate : this->candidates)
+      {
+        // items whose bounds contain the origin are skipped, as the scene
+        // query of ClosestPoint does
+        const Ogre::AxisAlignedBox box(candidate.bounds.getMinimum(),
+            candidate.bounds.getMaximum());
+        const std::pair<bool, Ogre::Real> boxHit = ray.intersects(box);
+        if (!boxHit.first || boxHit.second <= 0)
+          continue;
+
+        IntersectRayQueryCandidate(candidate, rayOrigin, rayDir, distance,
+            result);
+      }
+      this->results[r] = result;
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 RayQueryResult Ogre2RayQuery::ClosestPointByIntersection(bool _forceSceneUpdate)
 {
@@ -545,12 +672,29 @@ RayQueryResult Ogre2RayQuery::ClosestPointByIntersection(bool _forceSceneUpdate)
   // Perform the scene query
   Ogre::RaySceneQueryResult &ogreResult = this->dataPtr->rayQuery->execute();
 
+  // Resolve the mesh and triangle hierarchy of every item hit, once per
+  // distinct mesh
+  std::vector<RayQueryCandidate> candidates;
+  RayQueryMeshMap meshes;
+  for (auto iter = ogreResult.begin(); iter != ogreResult.end(); ++iter)
+  {
+    if (iter->distance <= 0.0)
+      continue;
+
+    RayQueryCandidate candidate;
+    if (MakeRayQueryCandidate(*ogreScene, iter->movable, meshes, candidate))
+      candidates.push_back(std::move(candidate));
+  }
+
+  if (candidates.empty())
+    return result;
+
 #ifndef SINGLE_THREADED
-  ThreadedTriRay rayTask(ogreResult, rayOrigin, rayDir,
+  ThreadedTriRay rayTask(candidates, rayOrigin, rayDir,
                          ogreSceneManager->getNumWorkerThreads());
   ogreSceneManager->executeUserScalableTask(&rayTask, true);
 #else
-  ThreadedTriRay rayTask(ogreResult, rayOrigin, rayDir, 1u);
+  ThreadedTriRay rayTask(candidates, rayOrigin, rayDir, 1u);
   rayTask.execute(0u, 1u);
 #endif
 
@@ -558,3 +702,62 @@ RayQueryResult Ogre2RayQuery::ClosestPointByIntersection(bool _forceSceneUpdate)
 
   return result;
 }
+
+//////////////////////////////////////////////////
+std::vector<RayQueryResult> Ogre2RayQuery::ClosestPoints(
+    const std::vector<math::Vector3d> &_origins,
+    const std::vector<math::Vector3d> &_directions,
+    bool _forceSceneUpdate)
+{
+  GZ_PROFILE("Ogre2RayQuery::ClosestPoints");
+  std::vector<RayQueryResult> results;
+  if (_origins.size() != _directions.size())
+  {
+    gzerr << "Number of ray origins [" << _origins.size()
+          << "] and directions [" << _directions.size()
+          << "] differ" << std::endl;
+    return results;
+  }
+  results.resize(_origins.size());
+
+  Ogre2ScenePtr ogreScene =
+      std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  if (!ogreScene || results.empty())
+    return results;
+
+  Ogre::SceneManager *ogreSceneManager = ogreScene->OgreSceneManager();
+
+  if (_forceSceneUpdate)
+  {
+    ogreSceneManager->updateSceneGraph();
+  }
+
+  // Resolve the candidates once for all the rays instead of running a scene
+  // query per ray
+  std::vector<RayQueryCandidate> candidates;
+  RayQueryMeshMap meshes;
+  auto itor = ogreSceneManager->getMovableObjectIterator(
+      Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (itor.hasMoreElements())
+  {
+    Ogre::MovableObject *movable = itor.getNext();
+    if (!movable->isAttached())
+      continue;
+
+    RayQueryCandidate candidate;
+    if (MakeRayQueryCandidate(*ogreScene, movable, meshes, candidate))
+      candidates.push_back(std::move(candidate));
+  }
+
+  if (candidates.empty())
+    return results;
+
+  ThreadedTriRays rayTask(candidates, _origins, _directions, results);
+#ifndef SINGLE_THREADED
+  ogreSceneManager->executeUserScalableTask(&rayTask, true);
+#else
+  rayTask.execute(0u, 1u);
+#endif
+
+  return results;
+}
@@ -29,6 +29,8 @@
 #include "gz/rendering/ogre2/Ogre2Scene.hh"
 #include "gz/rendering/Utils.hh"
 
+#include "Ogre2GpuReadbackTicket.hh"
+
 #include <string.h>
 
 namespace gz
@@ -103,11 +105,51 @@ class gz::rendering::Ogre2RenderTargetPrivate
   /// actual window
   ///
   public: Ogre::TextureGpu *ogreTexture[2] = {nullptr, nullptr};
+
+  /// \brief Pipelined GPU->CPU readback used by Copy() when a readback
+  /// latency is set
+  public: Ogre2GpuReadbackRing readback;
+
+  /// \brief Read the contents of a texture into a CPU buffer, either
+  /// synchronously or through the readback ring if latency is enabled.
+  /// \param[in] _texture Texture to read
+  /// \param[in] _dstBox Destination box describing the CPU buffer
+  /// \param[in] _dstFormat Pixel format to convert to
+  /// \return True if _dstBox was filled
+  public: bool ReadPixels(Ogre::TextureGpu *_texture,
+      Ogre::TextureBox &_dstBox, Ogre::PixelFormatGpu _dstFormat);
 };
 
 using namespace gz;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+bool Ogre2RenderTargetPrivate::ReadPixels(Ogre::TextureGpu *_texture,
+    Ogre::TextureBox &_dstBox, Ogre::PixelFormatGpu _dstFormat)
+{
+  if (this->readback.Latency() == 0u)
+  {
+    Ogre::Image2::copyContentsToMemory(
+        _texture, _texture->getEmptyBox(0u), _dstBox, _dstFormat);
+    return true;
+  }
+
+  Ogre::TextureBox srcBox = this->readback.DownloadAndMap(_texture);
+  if (!srcBox.data)
+  {
+    if (!this->readback.Filling())
+    {
+      gzerr << "Ogre2RenderTarget: GPU readback failed; dropping frame"
+            << std::endl;
+    }
+    return false;
+  }
+  Ogre::PixelFormatGpuUtils::bulkPixelConversion(
+      srcBox, _texture->getPixelFormat(), _dstBox, _dstFormat);
+  this->readback.Unmap();
+  return true;
+}
+
 //////////////////////////////////////////////////
 // Ogre2RenderTarget
 //////////////////////////////////////////////////
@@ -426,19 +468,30 @@ void Ogre2RenderTarget::Copy(Image &_image) const
     // create tmp color image to get data from gpu
     Image colorImage(this->width, this->height, PF_R8G8B8);
     dstBox.data = colorImage.Data();
-    Ogre::Image2::copyContentsToMemory(
-        texture, texture->getEmptyBox(0u), dstBox, dstOgrePf);
+    if (!this->dataPtr->ReadPixels(texture, dstBox, dstOgrePf))
+      return;
     // convert color image to bayer image
     _image = gz::rendering::convertRGBToBayer(colorImage, _image.Format());
   }
   else
   {
     dstBox.data = _image.Data();
-    Ogre::Image2::copyContentsToMemory(
-        texture, texture->getEmptyBox(0u), dstBox, dstOgrePf);
+    this->dataPtr->ReadPixels(texture, dstBox, dstOgrePf);
   }
 }
 
+//////////////////////////////////////////////////
+void Ogre2RenderTarget::SetReadbackLatency(unsigned int _frames)
+{
+  this->dataPtr->readback.SetLatency(_frames);
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2RenderTarget::ReadbackLatency() const
+{
+  return this->dataPtr->readback.Latency();
+}
+
 //////////////////////////////////////////////////
 Ogre::Camera *Ogre2RenderTarget::Camera() const
 {
@@ -542,6 +595,8 @@ void Ogre2RenderTarget::DestroyTargetImpl()
   if (nullptr == this->dataPtr->ogreTexture[0])
     return;
 
+  this->dataPtr->readback.Destroy();
+
   this->DestroyCompositor();
 
   Ogre::Root *root = Ogre2RenderEngine::Instance()->OgreRoot();
@@ -61,6 +61,7 @@
 #include "gz/rendering/ogre2/Ogre2MeshFactory.hh"
 #include "gz/rendering/ogre2/Ogre2Node.hh"
 #include "gz/rendering/ogre2/Ogre2ParticleEmitter.hh"
+#include "gz/rendering/ogre2/Ogre2PointCloudVisual.hh"
 #include "gz/rendering/ogre2/Ogre2Projector.hh"
 #include "gz/rendering/ogre2/Ogre2RayQuery.hh"
 #include "gz/rendering/ogre2/Ogre2RenderEngine.hh"
@@ -73,6 +74,8 @@
 #include "gz/rendering/ogre2/Ogre2WideAngleCamera.hh"
 #include "gz/rendering/ogre2/Ogre2WireBox.hh"
 
+#include "Ogre2MeshBvh.hh"
+
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
@@ -83,6 +86,7 @@
 #include <OgreDepthBuffer.h>
 #include <OgreMatrix4.h>
 #include <OgrePlatformInformation.h>
+#include <OgreRenderSystem.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
 #if OGRE_VERSION_MAJOR == 2 && OGRE_VERSION_MINOR == 1
@@ -136,6 +140,15 @@ class gz::rendering::Ogre2ScenePrivate
 
   /// \brief See Ogre2Scene::SetLightsGiDirty
   public: bool lightsGiDirty = false;
+
+  /// \brief Draw calls issued between the last PreRender / PostRender pair
+  public: unsigned int drawCallCount = 0u;
+
+  /// \brief Instances drawn between the last PreRender / PostRender pair
+  public: unsigned int drawnInstanceCount = 0u;
+
+  /// \brief Triangle hierarchies of the meshes picked by ray queries
+  public: Ogre2MeshBvhCache meshBvhCache;
 };
 
 using namespace gz;
@@ -228,6 +241,22 @@ void Ogre2Scene::SetBackgroundColor(const math::Color &_color)
   }
 }
 
+//////////////////////////////////////////////////
+unsigned int Ogre2Scene::SetLocalPoses(const unsigned int *_ids,
+    const math::Pose3d *_poses, unsigned int _count)
+{
+  GZ_PROFILE("Ogre2Scene::SetLocalPoses");
+  unsigned int changed = 0u;
+  for (unsigned int i = 0u; i < _count; ++i)
+  {
+    NodePtr node = this->NodeById(_ids[i]);
+    Ogre2Node *ogreNode = dynamic_cast<Ogre2Node *>(node.get());
+    if (nullptr != ogreNode && ogreNode->UpdateLocalPose(_poses[i]))
+      ++changed;
+  }
+  return changed;
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::PreRender()
 {
@@ -238,6 +267,9 @@ void Ogre2Scene::PreRender()
              "See Scene::SetCameraPassCountPerGpuFlush for details");
   this->dataPtr->frameUpdateStarted = true;
 
+  // count the draw calls of this frame only, see DrawCallCount
+  this->ogreSceneManager->getDestinationRenderSystem()->_resetMetrics();
+
   if (this->ShadowsDirty())
   {
     // notify all render targets
@@ -254,6 +286,9 @@ void Ogre2Scene::PreRender()
     this->UpdateShadowNode();
   }
 
+  // swap in the meshes loaded in the background before the visuals update
+  this->meshFactory->UpdateAsyncLoads();
+
   BaseScene::PreRender();
 
   if (!this->LegacyAutoGpuFlush())
@@ -292,6 +327,13 @@ void Ogre2Scene::PostRender()
              "See Scene::SetCameraPassCountPerGpuFlush for details");
   this->dataPtr->frameUpdateStarted = false;
 
+  // all the draws of this frame have been issued by now
+  const Ogre::RenderingMetrics &metrics =
+      this->ogreSceneManager->getDestinationRenderSystem()->getMetrics();
+  this->dataPtr->drawCallCount = static_cast<unsigned int>(metrics.mDrawCount);
+  this->dataPtr->drawnInstanceCount =
+      static_cast<unsigned int>(metrics.mInstanceCount);
+
   if (dataPtr->cameraPassCountPerGpuFlush == 0u)
   {
     gzwarn << "Calling Scene::PostRender but "
@@ -318,6 +360,18 @@ void Ogre2Scene::PostRender()
   }
 }
 
+//////////////////////////////////////////////////
+unsigned int Ogre2Scene::DrawCallCount() const
+{
+  return this->dataPtr->drawCallCount;
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2Scene::DrawnInstanceCount() const
+{
+  return this->dataPtr->drawnInstanceCount;
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::StartForcedRender()
 {
@@ -536,6 +590,10 @@ bool Ogre2Scene::InitImpl()
   this->CreateStores();
   this->CreateMeshFactory();
   UpdateShadowNode();
+
+  // draw call and instance counts, see DrawCallCount
+  this->ogreSceneManager->getDestinationRenderSystem()
+      ->setMetricsRecordingEnabled(true);
   return true;
 }
 
@@ -1295,6 +1353,19 @@ MeshPtr Ogre2Scene::CreateMeshImpl(unsigned int _id,
   return (result) ? mesh : nullptr;
 }
 
+//////////////////////////////////////////////////
+MeshPtr Ogre2Scene::CreateMeshAsyncImpl(unsigned int _id,
+    const std::string &_name, const MeshDescriptor &_desc)
+{
+  Ogre2MeshPtr mesh = this->meshFactory->CreateAsync(_desc);
+  if (nullptr == mesh)
+    return nullptr;
+  mesh->SetDescriptor(_desc);
+
+  bool result = this->InitObject(mesh, _id, _name);
+  return (result) ? mesh : nullptr;
+}
+
 //////////////////////////////////////////////////
 CapsulePtr Ogre2Scene::CreateCapsuleImpl(unsigned int _id,
     const std::string &_name)
@@ -1341,6 +1412,15 @@ MarkerPtr Ogre2Scene::CreateMarkerImpl(unsigned int _id,
   return (result) ? marker: nullptr;
 }
 
+//////////////////////////////////////////////////
+PointCloudVisualPtr Ogre2Scene::CreatePointCloudVisualImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2PointCloudVisualPtr visual(new Ogre2PointCloudVisual);
+  bool result = this->InitObject(visual, _id, _name);
+  return (result) ? visual : nullptr;
+}
+
 //////////////////////////////////////////////////
 LidarVisualPtr Ogre2Scene::CreateLidarVisualImpl(unsigned int _id,
     const std::string &_name)
@@ -1566,6 +1646,12 @@ bool Ogre2Scene::ShadowsDirty() const
   return this->dataPtr->shadowsDirty;
 }
 
+//////////////////////////////////////////////////
+Ogre2MeshBvhCache &Ogre2Scene::MeshBvhCache()
+{
+  return this->dataPtr->meshBvhCache;
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::SetSkyEnabled(bool _enabled)
 {
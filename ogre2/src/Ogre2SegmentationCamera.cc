@@ -15,7 +15,20 @@
  *
  */
 
+#include <cstring>
+#include <limits>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:5033)
+#endif
+#include <Threading/OgreUniformScalableTask.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
 
 #include <gz/common/Console.hh>
 #include <gz/common/Profiler.hh>
@@ -35,6 +48,8 @@
 #include "gz/rendering/RenderTypes.hh"
 #include "gz/rendering/Utils.hh"
 
+#include "Ogre2GpuReadbackTicket.hh"
+#include "Ogre2MeshLod.hh"
 #include "Ogre2SegmentationMaterialSwitcher.hh"
 
 /// \brief Private data for the Ogre2SegmentationCamera class
@@ -43,6 +58,18 @@ class gz::rendering::Ogre2SegmentationCameraPrivate
   /// \brief buffer to store render texture data & to be sent to listeners
   public: uint8_t *buffer {nullptr};
 
+  /// \brief True once a frame has been published
+  public: bool hasFrame {false};
+
+  /// \brief True if the latest frame was written to the subscriber supplied
+  /// output buffer instead of buffer. SetOutputBuffer copies it back before
+  /// the output buffer is replaced.
+  public: bool frameInOutputBuffer {false};
+
+  /// \brief Persistent GPU->CPU readback ring used by the non-legacy
+  /// PostRender path.
+  public: Ogre2GpuReadbackRing segmentationReadback;
+
   /// \brief Workspace Definition
   public: std::string ogreCompositorWorkspaceDef;
 
@@ -72,6 +99,64 @@ class gz::rendering::Ogre2SegmentationCameraPrivate
   /// with colored version for segmentation
   public: std::unique_ptr<Ogre2SegmentationMaterialSwitcher>
           materialSwitcher {nullptr};
+
+  /// \brief Rebuild the color to label table if the material switcher
+  /// assigned different colors, or the segmentation type or background
+  /// label changed since it was last built
+  /// \param[in] _type Segmentation type
+  /// \param[in] _backgroundLabel Background label
+  public: void UpdateLabelTable(SegmentationType _type, int _backgroundLabel);
+
+  /// \brief Get the label map pixel of a colored map pixel
+  /// \param[in] _color 24 bit color of the colored map pixel
+  /// \return The three bytes of the label map pixel, packed in the lower
+  /// 24 bits
+  public: uint32_t LabelPixel(uint32_t _color) const;
+
+  /// \brief Decode a range of rows of the colored map into a label map
+  /// \param[in] _src Colored map
+  /// \param[out] _dst Label map
+  /// \param[in] _width Image width
+  /// \param[in] _rowBegin First row to decode
+  /// \param[in] _rowEnd One past the last row to decode
+  public: void DecodeRows(const uint8_t *_src, uint8_t *_dst,
+              unsigned int _width, unsigned int _rowBegin,
+              unsigned int _rowEnd) const;
+
+  /// \brief Entry of the color to label table
+  public: struct LabelEntry
+  {
+    /// \brief 24 bit color, or kEmptyColor for unused entries
+    uint32_t color;
+
+    /// \brief Label map pixel, packed as returned by LabelPixel
+    uint32_t pixel;
+  };
+
+  /// \brief Marks an unused entry of the color to label table
+  public: static constexpr uint32_t kEmptyColor =
+              std::numeric_limits<uint32_t>::max();
+
+  /// \brief Open addressing hash table from colors to label map pixels,
+  /// built from the material switcher's ColorToLabel map. Its size is a
+  /// power of two at least twice the number of colors so probes are short,
+  /// and it is small enough to stay in cache.
+  public: std::vector<LabelEntry> labelTable;
+
+  /// \brief Shift turning a hashed color into an index of labelTable
+  public: unsigned int labelTableShift {32u};
+
+  /// \brief Label map pixel of colors missing in labelTable
+  public: uint32_t backgroundPixel {0u};
+
+  /// \brief Material switcher version labelTable was built from
+  public: uint64_t labelTableVersion {std::numeric_limits<uint64_t>::max()};
+
+  /// \brief Segmentation type labelTable was built for
+  public: SegmentationType labelTableType {SegmentationType::ST_SEMANTIC};
+
+  /// \brief Background label labelTable was built for
+  public: int labelTableBackground {0};
 };
 
 using namespace gz;
@@ -106,12 +191,15 @@ void Ogre2SegmentationCamera::Init()
 void Ogre2SegmentationCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
+  this->dataPtr->segmentationReadback.Destroy();
 
   if (this->dataPtr->buffer)
   {
     delete [] this->dataPtr->buffer;
     this->dataPtr->buffer = nullptr;
   }
+  this->dataPtr->hasFrame = false;
+  this->dataPtr->frameInOutputBuffer = false;
 
   if (!this->ogreCamera)
     return;
@@ -255,12 +343,37 @@ void Ogre2SegmentationCamera::CreateSegmentationTexture()
     this->dataPtr->materialSwitcher.get());
 }
 
+namespace
+{
+  /// \brief Copy one mapped RGBA8 readback box into the RGB segmentation
+  /// buffer (drops alpha) in a single stride-aware pass.
+  /// Honors _box.bytesPerRow as the source stride.
+  void FillSegmentationBuffer(const Ogre::TextureBox &_box, uint8_t *_buffer,
+      unsigned int _width, unsigned int _height, unsigned int _channels)
+  {
+    const uint8_t *src = static_cast<const uint8_t *>(_box.data);
+    for (unsigned int row = 0; row < _height; ++row)
+    {
+      const uint8_t *srcRow = src + row * _box.bytesPerRow;
+      uint8_t *dstRow = _buffer + row * _width * _channels;
+      for (unsigned int column = 0; column < _width; ++column)
+      {
+        dstRow[column * _channels] = srcRow[column * 4u];
+        dstRow[column * _channels + 1] = srcRow[column * 4u + 1];
+        dstRow[column * _channels + 2] = srcRow[column * 4u + 2];
+      }
+    }
+  }
+}  // namespace
+
 /////////////////////////////////////////////////
 void Ogre2SegmentationCamera::PostRender()
 {
   GZ_PROFILE("Ogre2SegmentationCamera::PostRender");
   // return if no one is listening to the new frame
-  if (this->dataPtr->newSegmentationFrame.ConnectionCount() == 0)
+  const bool publishFrame =
+      this->dataPtr->newSegmentationFrame.ConnectionCount() > 0u;
+  if (!publishFrame && this->newFrameViewEvent.ConnectionCount() == 0u)
     return;
 
   const auto width = this->ImageWidth();
@@ -272,39 +385,97 @@ void Ogre2SegmentationCamera::PostRender()
   const auto bytesPerChannel = PixelUtil::BytesPerChannel(format);
   const auto bufferSize = len * channelCount * bytesPerChannel;
 
-  Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreSegmentationTexture, 0u, 0u);
-  Ogre::TextureBox box = image.getData(0);
-
   if (!this->dataPtr->buffer)
   {
     this->dataPtr->buffer = new uint8_t[bufferSize];
   }
 
-  uint8_t *bufferTmp = static_cast<uint8_t*>(box.data);
+  // write the frame straight into the subscriber supplied buffer if there
+  // is one
+  uint8_t *buffer = publishFrame ?
+      static_cast<uint8_t *>(this->OutputBuffer(bufferSize)) : nullptr;
+  if (!buffer)
+    buffer = this->dataPtr->buffer;
+
+  if (Ogre2UseLegacyReadback())
+  {
+    // Legacy A/B control: original Ogre::Image2 path, kept verbatim.
+    Ogre::Image2 image;
+    image.convertFromTexture(this->dataPtr->ogreSegmentationTexture, 0u, 0u);
+    Ogre::TextureBox box = image.getData(0);
+
+    uint8_t *bufferTmp = static_cast<uint8_t*>(box.data);
 
-  auto rawChannelCount = 4u;
+    auto rawChannelCount = 4u;
 
-  for (unsigned int row = 0; row < height; ++row)
+    for (unsigned int row = 0; row < height; ++row)
+    {
+      unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
+      for (unsigned int column = 0; column < width; ++column)
+      {
+        unsigned int idx = (row * width * channelCount) +
+            column * channelCount;
+        unsigned int rawIdx = rawDataRowIdx +
+            column * rawChannelCount;
+
+        buffer[idx] = bufferTmp[rawIdx];
+        buffer[idx + 1] = bufferTmp[rawIdx + 1];
+        buffer[idx + 2] = bufferTmp[rawIdx + 2];
+      }
+    }
+  }
+  else
   {
-    unsigned int rawDataRowIdx = row * box.bytesPerRow / bytesPerChannel;
-    for (unsigned int column = 0; column < width; ++column)
+    // Persistent-ticket path: map the staging buffer once and repack
+    // RGBA->RGB in a single fused pass.
+    this->dataPtr->segmentationReadback.SetLatency(this->ReadbackLatency());
+    Ogre::TextureBox box = this->dataPtr->segmentationReadback.DownloadAndMap(
+        this->dataPtr->ogreSegmentationTexture);
+    if (!box.data)
+    {
+      if (!this->dataPtr->segmentationReadback.Filling())
+      {
+        gzerr << "Ogre2SegmentationCamera: GPU readback failed; "
+              << "dropping frame" << std::endl;
+      }
+      return;
+    }
+    this->PublishFrameView(box.data, width, height, box.bytesPerRow,
+        PF_R8G8B8A8);
+    if (publishFrame)
     {
-      unsigned int idx = (row * width * channelCount) +
-          column * channelCount;
-      unsigned int rawIdx = rawDataRowIdx +
-          column * rawChannelCount;
-
-      this->dataPtr->buffer[idx] = bufferTmp[rawIdx];
-      this->dataPtr->buffer[idx + 1] = bufferTmp[rawIdx + 1];
-      this->dataPtr->buffer[idx + 2] = bufferTmp[rawIdx + 2];
+      FillSegmentationBuffer(box, buffer, width, height, channelCount);
     }
+    this->dataPtr->segmentationReadback.Unmap();
   }
 
-  this->dataPtr->newSegmentationFrame(
-    this->dataPtr->buffer,
-    width, height, channelCount,
-    PixelUtil::Name(format));
+  if (publishFrame)
+  {
+    this->dataPtr->hasFrame = true;
+    this->dataPtr->frameInOutputBuffer = buffer != this->dataPtr->buffer;
+
+    this->dataPtr->newSegmentationFrame(
+      buffer,
+      width, height, channelCount,
+      PixelUtil::Name(format));
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2SegmentationCamera::SetOutputBuffer(void *_buffer, size_t _size)
+{
+  // the subscriber may release the buffer once it is replaced, keep the
+  // latest frame in the internal buffer for LabelMapFromColoredBuffer
+  if (this->dataPtr->frameInOutputBuffer && this->dataPtr->buffer)
+  {
+    const PixelFormat format = this->ImageFormat();
+    std::memcpy(this->dataPtr->buffer, this->outputBuffer,
+        static_cast<size_t>(this->ImageWidth()) * this->ImageHeight() *
+        PixelUtil::ChannelCount(format) * PixelUtil::BytesPerChannel(format));
+  }
+  this->dataPtr->frameInOutputBuffer = false;
+
+  BaseSegmentationCamera::SetOutputBuffer(_buffer, _size);
 }
 
 /////////////////////////////////////////////////
@@ -320,6 +491,8 @@ gz::common::ConnectionPtr
 void Ogre2SegmentationCamera::Render()
 {
   GZ_PROFILE("Ogre2ThermalCamera::Render");
+  Ogre2MeshLod::UpdateCamera(*this, this->ogreCamera, this->ImageHeight());
+
   // update the compositors
   this->scene->StartRendering(this->ogreCamera);
 
@@ -360,70 +533,195 @@ void Ogre2SegmentationCamera::SetBackgroundLabel(int _label)
 }
 
 /////////////////////////////////////////////////
-void Ogre2SegmentationCamera::LabelMapFromColoredBuffer(
-  uint8_t * _labelBuffer) const
+void Ogre2SegmentationCameraPrivate::UpdateLabelTable(SegmentationType _type,
+    int _backgroundLabel)
 {
-  GZ_PROFILE("Ogre2SegmentationCamera::LabelMapFromColoredBuffer");
-  if (!this->isColoredMap)
+  const uint64_t version = this->materialSwitcher->ColorToLabelVersion();
+  if (version == this->labelTableVersion && _type == this->labelTableType &&
+      _backgroundLabel == this->labelTableBackground)
+  {
     return;
+  }
 
-  if (!this->dataPtr->buffer)
-    return;
+  GZ_PROFILE("Ogre2SegmentationCamera::UpdateLabelTable");
+  this->labelTableVersion = version;
+  this->labelTableType = _type;
+  this->labelTableBackground = _backgroundLabel;
 
-  auto colorToLabel = this->dataPtr->materialSwitcher->ColorToLabel();
+  // pixels that match no label are filled with the background label
+  const uint32_t background = static_cast<uint8_t>(_backgroundLabel);
+  this->backgroundPixel = background | (background << 8) | (background << 16);
 
-  auto width = this->ImageWidth();
-  auto height = this->ImageHeight();
+  const auto &colorToLabel = this->materialSwitcher->ColorToLabel();
+  size_t size = 16u;
+  unsigned int bits = 4u;
+  while (size < colorToLabel.size() * 2u)
+  {
+    size *= 2u;
+    ++bits;
+  }
+  this->labelTableShift = 32u - bits;
+  this->labelTable.assign(size, {kEmptyColor, this->backgroundPixel});
 
-  for (uint32_t i = 0; i < height; ++i)
+  for (const auto &[colorId, label] : colorToLabel)
   {
-    for (uint32_t j = 0; j < width; ++j)
+    uint32_t pixel = this->backgroundPixel;
+    if (_type == SegmentationType::ST_SEMANTIC)
     {
-      auto index = (i * width + j) * 3;
-      auto r = this->dataPtr->buffer[index];
-      auto g = this->dataPtr->buffer[index + 1];
-      auto b = this->dataPtr->buffer[index + 2];
-
-      // get color 24 bit unique id, we don't multiply it by 255 like before
-      // as they are not normalized we read it from the buffer in
-      // range [0-255] already
-      int64_t colorId = r * 256 * 256 + g * 256 + b;
+      const uint32_t label8bit = static_cast<uint8_t>(label % 256);
+      pixel = label8bit | (label8bit << 8) | (label8bit << 16);
+    }
+    else if (_type == SegmentationType::ST_PANOPTIC)
+    {
+      // get the label and instance counts from the composite label id
+      const uint32_t label8bit = static_cast<uint8_t>(label / (256 * 256));
+      // get the rest 16 bit
+      const uint16_t instanceCount = label % (256 * 256);
+      // composite that 16 bit count to two 8 bit channels
+      const uint32_t instanceCount1 = instanceCount / 256;
+      const uint32_t instanceCount2 = instanceCount % 256;
+      pixel = instanceCount2 | (instanceCount1 << 8) | (label8bit << 16);
+    }
 
-      // initialize the pixel with the background label value
-      _labelBuffer[index] = this->backgroundLabel;
-      _labelBuffer[index + 1] = this->backgroundLabel;
-      _labelBuffer[index + 2] = this->backgroundLabel;
+    const uint32_t color = static_cast<uint32_t>(colorId);
+    size_t index = (color * 0x9E3779B1u) >> this->labelTableShift;
+    while (this->labelTable[index].color != kEmptyColor)
+      index = (index + 1u) & (size - 1u);
+    this->labelTable[index] = {color, pixel};
+  }
+}
 
-      // skip if not exist
-      auto it = colorToLabel.find(colorId);
-      if (it == colorToLabel.end())
-        continue;
+/////////////////////////////////////////////////
+uint32_t Ogre2SegmentationCameraPrivate::LabelPixel(uint32_t _color) const
+{
+  const size_t mask = this->labelTable.size() - 1u;
+  size_t index = (_color * 0x9E3779B1u) >> this->labelTableShift;
+  while (true)
+  {
+    const LabelEntry &entry = this->labelTable[index];
+    if (entry.color == _color)
+      return entry.pixel;
+    if (entry.color == kEmptyColor)
+      return this->backgroundPixel;
+    index = (index + 1u) & mask;
+  }
+}
 
-      int64_t label = it->second;
+/////////////////////////////////////////////////
+void Ogre2SegmentationCameraPrivate::DecodeRows(const uint8_t *_src,
+    uint8_t *_dst, unsigned int _width, unsigned int _rowBegin,
+    unsigned int _rowEnd) const
+{
+  const size_t begin = static_cast<size_t>(_rowBegin) * _width * 3u;
+  const size_t end = static_cast<size_t>(_rowEnd) * _width * 3u;
+
+  // Segmentation maps are made of large flat regions, so most pixels have
+  // the same color as the previous one and skip the table lookup
+  uint32_t prevColor = kEmptyColor;
+  uint32_t pixel = this->backgroundPixel;
+  for (size_t index = begin; index < end; index += 3u)
+  {
+    // get color 24 bit unique id, we don't multiply it by 255 like before
+    // as they are not normalized we read it from the buffer in
+    // range [0-255] already
+    const uint32_t color = (static_cast<uint32_t>(_src[index]) << 16) |
+        (static_cast<uint32_t>(_src[index + 1]) << 8) | _src[index + 2];
+    if (color != prevColor)
+    {
+      pixel = this->LabelPixel(color);
+      prevColor = color;
+    }
+    _dst[index] = static_cast<uint8_t>(pixel);
+    _dst[index + 1] = static_cast<uint8_t>(pixel >> 8);
+    _dst[index + 2] = static_cast<uint8_t>(pixel >> 16);
+  }
+}
 
-      if (this->type == SegmentationType::ST_SEMANTIC)
-      {
-        uint8_t label8bit = label % 256;
+namespace
+{
+  /// \brief Decode the colored map into the label map on Ogre's worker
+  /// threads, each thread decoding a contiguous band of rows
+  class ThreadedLabelDecode final
+    : public Ogre::UniformScalableTask
+  {
+    /// \brief Constructor
+    /// \param[in] _dataPtr Camera private data holding the label table
+    /// \param[in] _src Colored map
+    /// \param[out] _dst Label map
+    /// \param[in] _width Image width
+    /// \param[in] _height Image height
+    public: ThreadedLabelDecode(const Ogre2SegmentationCameraPrivate &_dataPtr,
+        const uint8_t *_src, uint8_t *_dst, unsigned int _width,
+        unsigned int _height)
+        : dataPtr(_dataPtr), src(_src), dst(_dst), width(_width),
+          height(_height)
+    {
+    }
 
-        _labelBuffer[index] = label8bit;
-        _labelBuffer[index + 1] = label8bit;
-        _labelBuffer[index + 2] = label8bit;
-      }
-      else if (this->type == SegmentationType::ST_PANOPTIC)
-      {
-        // get the label and instance counts from the composite label id
-        uint8_t label8bit = label / (256 * 256);
-        // get the rest 16 bit
-        uint16_t instanceCount = label % (256 * 256);
-        // composite that 16 bit count to two 8 bit channels
-        uint8_t instanceCount1 = instanceCount / 256;
-        uint8_t instanceCount2 = instanceCount % 256;
-
-        _labelBuffer[index + 2] = label8bit;
-        _labelBuffer[index + 1] = instanceCount1;
-        _labelBuffer[index] = instanceCount2;
-      }
+    // Documentation inherited
+    public: void execute(size_t _threadId, size_t _numThreads) override
+    {
+      const auto rowBegin =
+          static_cast<unsigned int>(this->height * _threadId / _numThreads);
+      const auto rowEnd = static_cast<unsigned int>(
+          this->height * (_threadId + 1u) / _numThreads);
+      this->dataPtr.DecodeRows(this->src, this->dst, this->width, rowBegin,
+          rowEnd);
     }
+
+    /// \brief Camera private data holding the label table
+    private: const Ogre2SegmentationCameraPrivate &dataPtr;
+
+    /// \brief Colored map
+    private: const uint8_t *src;
+
+    /// \brief Label map
+    private: uint8_t *dst;
+
+    /// \brief Image width
+    private: unsigned int width;
+
+    /// \brief Image height
+    private: unsigned int height;
+  };
+}  // namespace
+
+/////////////////////////////////////////////////
+void Ogre2SegmentationCamera::LabelMapFromColoredBuffer(
+  uint8_t * _labelBuffer) const
+{
+  GZ_PROFILE("Ogre2SegmentationCamera::LabelMapFromColoredBuffer");
+  if (!this->dataPtr->hasFrame)
+    return;
+  const uint8_t *frame = this->dataPtr->frameInOutputBuffer ?
+      static_cast<const uint8_t *>(this->outputBuffer) :
+      this->dataPtr->buffer;
+
+  const auto width = this->ImageWidth();
+  const auto height = this->ImageHeight();
+
+  // the map already holds label ids, there is nothing to decode
+  if (!this->isColoredMap)
+  {
+    std::memcpy(_labelBuffer, frame, static_cast<size_t>(width) * height * 3u);
+    return;
+  }
+
+  this->dataPtr->UpdateLabelTable(this->type, this->backgroundLabel);
+
+  // large images are split across Ogre's worker threads
+  const unsigned int minPixelsPerThread = 64u * 1024u;
+  ThreadedLabelDecode task(*this->dataPtr, frame, _labelBuffer, width,
+      height);
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  if (sceneManager->getNumWorkerThreads() > 1u &&
+      width * height >= 2u * minPixelsPerThread)
+  {
+    sceneManager->executeUserScalableTask(&task, true);
+  }
+  else
+  {
+    task.execute(0u, 1u);
   }
 }
 
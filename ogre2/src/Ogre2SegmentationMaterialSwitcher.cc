@@ -236,6 +236,8 @@ void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
     Ogre::Camera * /*_cam*/)
 {
   GZ_PROFILE("Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene");
+  // keep the previous map around to tell whether the colors changed
+  this->prevColorToLabel.swap(this->colorToLabel);
   this->colorToLabel.clear();
   auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
       Ogre::ItemFactory::FACTORY_TYPE_NAME);
@@ -389,6 +391,9 @@ void Ogre2SegmentationMaterialSwitcher::cameraPreRenderScene(
   // Remove the reference count on noBlend we created
   hlmsManager->destroyBlendblock(noBlend);
 
+  if (this->colorToLabel != this->prevColorToLabel)
+    ++this->colorToLabelVersion;
+
   // reset the count & colors tracking
   this->instancesCount.clear();
   this->takenColors.clear();
@@ -460,3 +465,9 @@ Ogre2SegmentationMaterialSwitcher::ColorToLabel() const
 {
   return this->colorToLabel;
 }
+
+////////////////////////////////////////////////
+uint64_t Ogre2SegmentationMaterialSwitcher::ColorToLabelVersion() const
+{
+  return this->colorToLabelVersion;
+}
@@ -18,6 +18,7 @@
 #ifndef GZ_RENDERING_OGRE2_OGRE2SEGMENTATIONMATERIALSWITCHER_HH_
 #define GZ_RENDERING_OGRE2_OGRE2SEGMENTATIONMATERIALSWITCHER_HH_
 
+#include <cstdint>
 #include <random>
 #include <string>
 #include <unordered_map>
@@ -69,6 +70,12 @@ class GZ_RENDERING_OGRE2_VISIBLE Ogre2SegmentationMaterialSwitcher :
   /// \return The map between color and label IDs
   public: const std::unordered_map<int64_t, int64_t> &ColorToLabel() const;
 
+  /// \brief Get a counter that is incremented every time a render changes
+  /// the map between color IDs and label IDs, so users can cache data
+  /// derived from it
+  /// \return Version of the map between color and label IDs
+  public: uint64_t ColorToLabelVersion() const;
+
   /// \brief Create a color to apply for the given visual
   /// \param[in] _visual Visual will be applying the color to
   /// \param[in,out] _prevParentName A persistent string between call
@@ -119,6 +126,13 @@ class GZ_RENDERING_OGRE2_VISIBLE Ogre2SegmentationMaterialSwitcher :
   /// or composite id (8 bit label + 16 bit instances) in instance type
   private: std::unordered_map<int64_t, int64_t> colorToLabel;
 
+  /// \brief Map between color and label IDs of the previous render, used
+  /// to detect changes
+  private: std::unordered_map<int64_t, int64_t> prevColorToLabel;
+
+  /// \brief Incremented when colorToLabel changes between renders
+  private: uint64_t colorToLabelVersion = 0u;
+
   /// \brief A map of ogre datablock pointer to their original blendblocks
   private: std::unordered_map<Ogre::HlmsDatablock *,
       const Ogre::HlmsBlendblock *> datablockMap;
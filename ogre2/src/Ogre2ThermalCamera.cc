@@ -63,6 +63,8 @@
 
 #include <gz/common/Image.hh>
 
+#include "Ogre2GpuReadbackTicket.hh"
+#include "Ogre2MeshLod.hh"
 #include "Terra/Terra.h"
 
 namespace gz
@@ -157,6 +159,10 @@ class gz::rendering::Ogre2ThermalCameraPrivate
   /// \brief Outgoing thermal data, used by newThermalFrame event.
   public: uint16_t *thermalImage = nullptr;
 
+  /// \brief Persistent GPU->CPU readback ring used by the non-legacy
+  /// PostRender path.
+  public: Ogre2GpuReadbackRing thermalReadback;
+
   /// \brief maximum value used for data outside sensor range
   public: uint16_t dataMaxVal = std::numeric_limits<uint16_t>::max();
 
@@ -717,6 +723,7 @@ void Ogre2ThermalCamera::Init()
 void Ogre2ThermalCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
+  this->dataPtr->thermalReadback.Destroy();
 
   if (this->dataPtr->thermalImage)
   {
@@ -1103,6 +1110,8 @@ void Ogre2ThermalCamera::Render()
   const bool bOldDepthClamp = this->ogreCamera->getNeedsDepthClamp();
   this->ogreCamera->_setNeedsDepthClamp(true);
 
+  Ogre2MeshLod::UpdateCamera(*this, this->ogreCamera, this->ImageHeight());
+
   // update the compositors
   this->scene->StartRendering(this->ogreCamera);
 
@@ -1143,11 +1152,40 @@ void Ogre2ThermalCamera::PreRender()
   this->dataPtr->thermalMaterialSwitcher->SetLinearResolution(this->resolution);
 }
 
+namespace
+{
+  /// \brief Copy one mapped thermal readback box into the persistent
+  /// uint16 thermal image in a single stride-aware pass. 8 bit data is
+  /// widened to 16 bit, 16 bit data is copied row by row.
+  /// Honors _box.bytesPerRow as the source stride.
+  void FillThermalImage(const Ogre::TextureBox &_box, uint16_t *_thermalImage,
+      unsigned int _width, unsigned int _height, bool _is8Bit)
+  {
+    const uint8_t *src = static_cast<const uint8_t *>(_box.data);
+    for (unsigned int i = 0u; i < _height; ++i)
+    {
+      const uint8_t *srcRow = src + i * _box.bytesPerRow;
+      uint16_t *dstRow = _thermalImage + i * _width;
+      if (_is8Bit)
+      {
+        for (unsigned int j = 0u; j < _width; ++j)
+          dstRow[j] = srcRow[j];
+      }
+      else
+      {
+        memcpy(dstRow, srcRow, _width * sizeof(uint16_t));
+      }
+    }
+  }
+}  // namespace
+
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::PostRender()
 {
   GZ_PROFILE("Ogre2ThermalCamera::PostRender");
-  if (this->dataPtr->newThermalFrame.ConnectionCount() <= 0u)
+  const bool publishFrame =
+      this->dataPtr->newThermalFrame.ConnectionCount() > 0u;
+  if (!publishFrame && this->newFrameViewEvent.ConnectionCount() == 0u)
     return;
 
   unsigned int width = this->ImageWidth();
@@ -1158,49 +1196,85 @@ void Ogre2ThermalCamera::PostRender()
   unsigned int channelCount = PixelUtil::ChannelCount(format);
   unsigned int bytesPerChannel = PixelUtil::BytesPerChannel(format);
 
-  Ogre::Image2 image;
-  image.convertFromTexture(this->dataPtr->ogreThermalTexture, 0u, 0u);
-
   if (!this->dataPtr->thermalImage)
   {
     this->dataPtr->thermalImage = new uint16_t[len];
   }
 
-  Ogre::TextureBox box = image.getData(0u);
-  if (format == PF_L8)
+  // publish into the subscriber supplied buffer if there is one
+  uint16_t *thermalImage = static_cast<uint16_t *>(
+      this->OutputBuffer(len * sizeof(uint16_t)));
+  if (!thermalImage)
+    thermalImage = this->dataPtr->thermalImage;
+
+  if (Ogre2UseLegacyReadback())
   {
-    uint8_t *thermalBuffer = static_cast<uint8_t*>(box.data);
-    for (unsigned int i = 0u; i < height; ++i)
+    // Legacy A/B control: original Ogre::Image2 path, kept verbatim.
+    Ogre::Image2 image;
+    image.convertFromTexture(this->dataPtr->ogreThermalTexture, 0u, 0u);
+
+    Ogre::TextureBox box = image.getData(0u);
+    if (format == PF_L8)
+    {
+      uint8_t *thermalBuffer = static_cast<uint8_t*>(box.data);
+      for (unsigned int i = 0u; i < height; ++i)
+      {
+        // the texture box step size could be larger than our image buffer
+        // step size
+        unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
+        for (unsigned int j = 0u; j < width; ++j)
+        {
+          unsigned int idx = (i * width) + j;
+          thermalImage[idx] = thermalBuffer[rawDataRowIdx + j];
+        }
+      }
+    }
+    else
     {
-      // the texture box step size could be larger than our image buffer step
-      // size
-      unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-      for (unsigned int j = 0u; j < width; ++j)
+      // fill thermal data
+      // copy data row by row. The texture box may not be a contiguous region
+      // of a texture
+      uint16_t * thermalBuffer = static_cast<uint16_t *>(box.data);
+      for (unsigned int i = 0; i < height; ++i)
       {
-        unsigned int idx = (i * width) + j;
-        this->dataPtr->thermalImage[idx] = thermalBuffer[rawDataRowIdx + j];
+        unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
+        unsigned int rowIdx = i * width * channelCount;
+        memcpy(&thermalImage[rowIdx],
+            &thermalBuffer[rawDataRowIdx],
+            width * channelCount * bytesPerChannel);
       }
     }
   }
   else
   {
-    // fill thermal data
-    // copy data row by row. The texture box may not be a contiguous region of
-    // a texture
-    uint16_t * thermalBuffer = static_cast<uint16_t *>(box.data);
-    for (unsigned int i = 0; i < height; ++i)
+    // Persistent-ticket path: map the staging buffer once and widen / copy
+    // straight into the persistent thermal image in a single fused pass.
+    this->dataPtr->thermalReadback.SetLatency(this->ReadbackLatency());
+    Ogre::TextureBox box = this->dataPtr->thermalReadback.DownloadAndMap(
+        this->dataPtr->ogreThermalTexture);
+    if (!box.data)
     {
-      unsigned int rawDataRowIdx = i * box.bytesPerRow / bytesPerChannel;
-      unsigned int rowIdx = i * width * channelCount;
-      memcpy(&this->dataPtr->thermalImage[rowIdx],
-          &thermalBuffer[rawDataRowIdx],
-          width * channelCount * bytesPerChannel);
+      if (!this->dataPtr->thermalReadback.Filling())
+      {
+        gzerr << "Ogre2ThermalCamera: GPU readback failed; dropping frame"
+              << std::endl;
+      }
+      return;
     }
+    this->PublishFrameView(box.data, width, height, box.bytesPerRow,
+        format);
+    if (publishFrame)
+    {
+      FillThermalImage(box, thermalImage, width, height, format == PF_L8);
+    }
+    this->dataPtr->thermalReadback.Unmap();
   }
 
-  this->dataPtr->newThermalFrame(
-      this->dataPtr->thermalImage, width, height, 1,
-      PixelUtil::Name(format));
+  if (publishFrame)
+  {
+    this->dataPtr->newThermalFrame(
+        thermalImage, width, height, 1, PixelUtil::Name(format));
+  }
 
   // Uncomment to debug thermal output
   // std::cout << "wxh: " << width << " x " << height << std::endl;
@@ -90,6 +90,8 @@ void Ogre2Visual::SetWireframe(bool _show)
       datablock->setMacroblock(macroblock);
     }
   }
+
+  this->MarkPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
@@ -105,17 +107,40 @@ void Ogre2Visual::SetVisible(bool _visible)
     return;
 
   this->ogreNode->setVisible(_visible);
+
+  this->MarkPreRenderDirty();
 }
 
 //////////////////////////////////////////////////
 void Ogre2Visual::SetStatic(bool _static)
 {
-  this->ogreNode->setStatic(_static);
+  if (!this->ogreNode || this->ogreNode->isStatic() == _static)
+    return;
+
+  // a dynamic node can not hold static objects: the node turns static
+  // before its items and dynamic after them
+  if (_static)
+    this->ogreNode->setStatic(true);
+
+  for (unsigned int i = 0; i < this->ogreNode->numAttachedObjects(); ++i)
+  {
+    Ogre::MovableObject *ogreObj = this->ogreNode->getAttachedObject(i);
+    if (ogreObj->getMovableType() == Ogre::ItemFactory::FACTORY_TYPE_NAME)
+      ogreObj->setStatic(_static);
+  }
+
+  if (!_static)
+    this->ogreNode->setStatic(false);
+
+  this->NotifyStaticDirty();
 }
 
 //////////////////////////////////////////////////
 bool Ogre2Visual::Static() const
 {
+  if (!this->ogreNode)
+    return false;
+
   return this->ogreNode->isStatic();
 }
 
@@ -184,6 +209,15 @@ bool Ogre2Visual::AttachGeometry(GeometryPtr _geometry)
   derived->SetParent(this->SharedThis());
   this->ogreNode->attachObject(ogreObj);
 
+  // items of a static visual are static too, other objects such as
+  // particles and dynamic renderables keep updating every frame
+  if (this->ogreNode->isStatic() &&
+      ogreObj->getMovableType() == Ogre::ItemFactory::FACTORY_TYPE_NAME)
+  {
+    ogreObj->setStatic(true);
+  }
+  this->NotifyStaticDirty();
+
   return true;
 }
 
@@ -207,8 +241,15 @@ bool Ogre2Visual::DetachGeometry(GeometryPtr _geometry)
     return false;
   }
 
-  if (nullptr != derived->OgreObject())
-    this->ogreNode->detachObject(derived->OgreObject());
+  Ogre::MovableObject *ogreObj = derived->OgreObject();
+  if (nullptr != ogreObj)
+  {
+    // the object may be attached to a dynamic node later on
+    if (ogreObj->isStatic())
+      ogreObj->setStatic(false);
+    this->ogreNode->detachObject(ogreObj);
+    this->NotifyStaticDirty();
+  }
   derived->SetParent(nullptr);
   return true;
 }
@@ -15,6 +15,12 @@
  *
  */
 
+#include <array>
+#include <cmath>
+#include <functional>
+#include <set>
+#include <vector>
+
 #include "gz/rendering/ogre2/Ogre2WideAngleCamera.hh"
 
 #include "gz/rendering/CameraLens.hh"
@@ -26,6 +32,9 @@
 #include <gz/common/Profiler.hh>
 #include "gz/common/Util.hh"
 
+#include "Ogre2GpuReadbackTicket.hh"
+#include "Ogre2MeshLod.hh"
+
 #ifdef _MSC_VER
 #  pragma warning(push, 0)
 #endif
@@ -35,10 +44,15 @@
 #include <Compositor/Pass/PassQuad/OgreCompositorPassQuad.h>
 #include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
 #include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
+#include <OgreDecal.h>
 #include <OgreDepthBuffer.h>
 #include <OgreImage2.h>
+#include <OgreItem.h>
+#include <OgreLight.h>
 #include <OgrePass.h>
+#include <OgreRoot.h>
 #include <OgreSceneManager.h>
+#include <OgreSubItem.h>
 #include <OgreTechnique.h>
 #include <OgreTextureBox.h>
 #include <OgreTextureGpuManager.h>
@@ -166,6 +180,26 @@ class gz::rendering::Ogre2WideAngleCamera::Implementation
   ///  and needs to be converted to another format.
   public: std::unique_ptr<unsigned char []> dstImgData;
 
+  /// \brief Persistent GPU->CPU readback ring used by the non-legacy
+  /// PostRender path.
+  public: Ogre2GpuReadbackRing readback;
+
+  /// \brief Cubemap faces sampled by the stitching pass, the other faces
+  /// are not rendered. See UpdateCubeFaces.
+  public: std::set<unsigned int> cubeFaceIdx;
+
+  /// \brief Lens, field of view and image size cubeFaceIdx was computed
+  /// for
+  public: std::vector<double> cubeFacesKey;
+
+  /// \brief Signature of the content of every face when it was last
+  /// rendered, see FaceSignatures
+  public: std::array<uint64_t, 6> faceSignatures{};
+
+  /// \brief True for the faces whose content in envCubeMapTexture matches
+  /// faceSignatures
+  public: std::array<bool, 6> faceCached{};
+
   explicit Implementation(gz::rendering::Ogre2WideAngleCamera &_owner) :
     workspaceListener(_owner)
   {
@@ -184,6 +218,52 @@ using namespace rendering;
 static constexpr uint32_t kWideAngleCameraCubemapPassId = 1276660u;
 static constexpr uint32_t kWideAngleCameraQuadPassId = 1276661u;
 
+//////////////////////////////////////////////////
+/// \brief Combine a value into a hash
+/// \param[in, out] _seed Hash
+/// \param[in] _value Value
+template <typename T>
+static void HashCombine(uint64_t &_seed, const T &_value)
+{
+  _seed ^= std::hash<T>()(_value) + 0x9e3779b97f4a7c15ull + (_seed << 6) +
+      (_seed >> 2);
+}
+
+//////////////////////////////////////////////////
+/// \brief Combine a vector into a hash
+/// \param[in, out] _seed Hash
+/// \param[in] _value Vector
+static void HashCombine(uint64_t &_seed, const Ogre::Vector3 &_value)
+{
+  HashCombine(_seed, _value.x);
+  HashCombine(_seed, _value.y);
+  HashCombine(_seed, _value.z);
+}
+
+//////////////////////////////////////////////////
+/// \brief Combine a quaternion into a hash
+/// \param[in, out] _seed Hash
+/// \param[in] _value Quaternion
+static void HashCombine(uint64_t &_seed, const Ogre::Quaternion &_value)
+{
+  HashCombine(_seed, _value.w);
+  HashCombine(_seed, _value.x);
+  HashCombine(_seed, _value.y);
+  HashCombine(_seed, _value.z);
+}
+
+//////////////////////////////////////////////////
+/// \brief Combine a color into a hash
+/// \param[in, out] _seed Hash
+/// \param[in] _value Color
+static void HashCombine(uint64_t &_seed, const Ogre::ColourValue &_value)
+{
+  HashCombine(_seed, _value.r);
+  HashCombine(_seed, _value.g);
+  HashCombine(_seed, _value.b);
+  HashCombine(_seed, _value.a);
+}
+
 //////////////////////////////////////////////////
 Ogre2WideAngleCamera::Ogre2WideAngleCamera() :
   dataPtr(utils::MakeUniqueImpl<Implementation>(*this))
@@ -278,12 +358,14 @@ void Ogre2WideAngleCamera::PreRender()
   }
 
   this->UpdateRenderPasses();
+  this->UpdateCubeFaces();
 }
 
 //////////////////////////////////////////////////
 void Ogre2WideAngleCamera::Destroy()
 {
   this->RemoveAllRenderPasses();
+  this->dataPtr->readback.Destroy();
   this->DestroyTextures();
   this->DestroyRenderTexture();
 }
@@ -722,6 +804,9 @@ void Ogre2WideAngleCamera::CreateFacesWorkspaces(bool _withMsaa)
     this->dataPtr->envCubeMapTexture
   };
 
+  // the faces of the new workspaces are rendered at least once
+  this->dataPtr->faceCached.fill(false);
+
   for (uint32_t i = 0u; i < kWideAngleNumCubemapFaces; ++i)
   {
     GZ_ASSERT(!this->dataPtr->ogreCompositorWorkspace[i], "Must be nullptr!");
@@ -1039,13 +1124,32 @@ void Ogre2WideAngleCamera::Render()
 
   this->scene->StartRendering(this->dataPtr->ogreCamera);
 
+  // faces of the cubemap keep their content when they are not rendered.
+  // Render passes applied to the faces, e.g. noise, must run every frame so
+  // faces are not cached when there are any.
+  const bool cacheFaces =
+      this->StaticFaceCaching() && this->dataPtr->renderPasses.empty();
+  std::array<uint64_t, kWideAngleNumCubemapFaces> signatures{};
+  if (cacheFaces)
+    this->FaceSignatures(signatures);
+
   Ogre::vector<Ogre::TextureGpu *>::type swappedTargets;
 
   const Ogre::Quaternion oldCameraOrientation(
     this->dataPtr->ogreCamera->getOrientation());
 
-  for (size_t i = 0u; i < kWideAngleNumCubemapFaces; ++i)
+  uint8_t renderedFaceCount = 0u;
+  for (unsigned int i : this->dataPtr->cubeFaceIdx)
   {
+    if (cacheFaces && this->dataPtr->faceCached[i] &&
+        this->dataPtr->faceSignatures[i] == signatures[i])
+    {
+      continue;
+    }
+    this->dataPtr->faceCached[i] = cacheFaces;
+    this->dataPtr->faceSignatures[i] = signatures[i];
+    ++renderedFaceCount;
+
     this->dataPtr->ogreCompositorWorkspace[i]->setEnabled(true);
 
     this->dataPtr->ogreCamera->setOrientation(oldCameraOrientation *
@@ -1079,8 +1183,209 @@ void Ogre2WideAngleCamera::Render()
     this->dataPtr->ogreCompositorFinalPass->setEnabled(false);
   }
 
-  this->scene->FlushGpuCommandsAndStartNewFrame(kWideAngleNumCubemapFaces,
-                                                false);
+  this->scene->FlushGpuCommandsAndStartNewFrame(renderedFaceCount, false);
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleCamera::UpdateCubeFaces()
+{
+  const CameraLens &lens = this->Lens();
+  const math::Vector3d fun = lens.MappingFunctionAsVector3d();
+  const std::vector<double> key = {lens.C1(), lens.C2(), lens.C3(), lens.F(),
+      fun.X(), fun.Y(), fun.Z(), lens.CutOffAngle(),
+      lens.ScaleToHFOV() ? 1.0 : 0.0, this->HFOV().Radian(),
+      static_cast<double>(this->ImageWidth()),
+      static_cast<double>(this->ImageHeight()),
+      static_cast<double>(this->dataPtr->envTextureSize)};
+  if (key == this->dataPtr->cubeFacesKey)
+    return;
+
+  GZ_PROFILE("Ogre2WideAngleCamera::UpdateCubeFaces");
+  this->dataPtr->cubeFacesKey = key;
+  std::set<unsigned int> &cubeFaceIdx = this->dataPtr->cubeFaceIdx;
+  cubeFaceIdx.clear();
+
+  // run the mapping of the stitching pass for every pixel, see
+  // PrepareForFinalPass and wide_lens_map_fp.glsl
+  const unsigned int width = this->ImageWidth();
+  const unsigned int height = this->ImageHeight();
+  const double ratio =
+      static_cast<double>(width) / static_cast<double>(height);
+  const double c1 = lens.C1();
+  const double c2 = lens.C2();
+  const double c3 = lens.C3();
+  double f = lens.F();
+  if (lens.ScaleToHFOV())
+  {
+    const double param = (this->HFOV().Radian() / 2.0) / c2 + c3;
+    f = 1.0 / (c1 * lens.ApplyMappingFunction(static_cast<float>(param)));
+  }
+  const double cutParam = lens.CutOffAngle() / c2 + c3;
+  const double cutRadius = c1 * f * (fun.X() * std::sin(cutParam) +
+      fun.Y() * std::tan(cutParam) + fun.Z() * cutParam);
+
+  // bilinear filtering reads the neighbouring face within a texel of the
+  // edge of a face
+  const double edgeMargin =
+      1.0 - 2.0 / std::max(1u, this->dataPtr->envTextureSize);
+
+  for (unsigned int y = 0u; y < height; ++y)
+  {
+    const double fragY =
+        -(1.0 - 2.0 * (y + 0.5) / static_cast<double>(height)) / ratio;
+    for (unsigned int x = 0u; x < width; ++x)
+    {
+      const double fragX =
+          -(2.0 * (x + 0.5) / static_cast<double>(width) - 1.0);
+      const double r = std::sqrt(fragX * fragX + fragY * fragY);
+      // pixels outside of the cut off radius are black
+      if (r >= cutRadius)
+        continue;
+
+      const double param = r / (c1 * f);
+      double theta = 0.0;
+      if (fun.X() > 0)
+        theta = std::asin(param);
+      else if (fun.Y() > 0)
+        theta = std::atan(param);
+      else if (fun.Z() > 0)
+        theta = param;
+      theta = (theta - c3) * c2;
+
+      math::Vector3d dir(0, 0, std::cos(theta));
+      if (r > 0.0)
+      {
+        dir.X() = -std::sin(theta) * fragX / r;
+        dir.Y() = std::sin(theta) * fragY / r;
+      }
+      if (!dir.IsFinite())
+        continue;
+
+      // faces are ordered +X, -X, +Y, -Y, +Z, -Z
+      const double maxAbs = dir.Abs().Max();
+      for (unsigned int axis = 0u; axis < 3u; ++axis)
+      {
+        if (std::abs(dir[axis]) >= maxAbs * edgeMargin)
+          cubeFaceIdx.insert(axis * 2u + (dir[axis] < 0.0 ? 1u : 0u));
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2WideAngleCamera::FaceSignatures(
+    std::array<uint64_t, 6> &_signatures) const
+{
+  GZ_PROFILE("Ogre2WideAngleCamera::FaceSignatures");
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  const Ogre::Camera *camera = this->dataPtr->ogreCamera;
+  const Ogre::Vector3 position = camera->getDerivedPosition();
+  const Ogre::Quaternion orientation = camera->getDerivedOrientation();
+  const uint32_t visibilityMask = this->VisibilityMask() &
+    Ogre::VisibilityFlags::RESERVED_VISIBILITY_FLAGS;
+
+  // changes seen by every face
+  uint64_t common = 0u;
+  HashCombine(common, position);
+  HashCombine(common, orientation);
+  HashCombine(common, camera->getNearClipDistance());
+  HashCombine(common, camera->getFarClipDistance());
+  HashCombine(common, visibilityMask);
+  HashCombine(common,
+      Ogre2Conversions::Convert(this->scene->BackgroundColor()));
+  HashCombine(common, Ogre2Conversions::Convert(this->scene->AmbientLight()));
+  auto lightIt = sceneManager->getMovableObjectIterator(
+      Ogre::LightFactory::FACTORY_TYPE_NAME);
+  while (lightIt.hasMoreElements())
+  {
+    const Ogre::Light *light =
+        static_cast<const Ogre::Light *>(lightIt.getNext());
+    if (!light->isVisible() || !light->getParentNode())
+      continue;
+    HashCombine(common, static_cast<const void *>(light));
+    HashCombine(common, static_cast<int>(light->getType()));
+    HashCombine(common, light->getParentNode()->_getDerivedPosition());
+    HashCombine(common, light->getParentNode()->_getDerivedOrientation());
+    HashCombine(common, light->getDiffuseColour());
+    HashCombine(common, light->getSpecularColour());
+    HashCombine(common, light->getPowerScale());
+    HashCombine(common, light->getAttenuationRange());
+    HashCombine(common, light->getSpotlightOuterAngle().valueRadians());
+    HashCombine(common, light->getCastShadows());
+  }
+  _signatures.fill(common);
+
+  // direction of every face in the order of kCubemapRotations, used to
+  // find the faces objects overlap
+  Ogre::Vector3 forward[kWideAngleNumCubemapFaces];
+  Ogre::Vector3 right[kWideAngleNumCubemapFaces];
+  Ogre::Vector3 up[kWideAngleNumCubemapFaces];
+  for (unsigned int i = 0u; i < kWideAngleNumCubemapFaces; ++i)
+  {
+    const Ogre::Quaternion faceOrientation =
+        orientation * kCubemapRotations[i];
+    forward[i] = faceOrientation * Ogre::Vector3::NEGATIVE_UNIT_Z;
+    right[i] = faceOrientation * Ogre::Vector3::UNIT_X;
+    up[i] = faceOrientation * Ogre::Vector3::UNIT_Y;
+  }
+
+  // particles change every frame
+  const unsigned long frame = Ogre2RenderEngine::Instance()->OgreRoot()->
+      getNextFrameNumber();
+  for (const Ogre::String &type : {Ogre::ItemFactory::FACTORY_TYPE_NAME,
+      Ogre::DecalFactory::FACTORY_TYPE_NAME,
+      Ogre::ParticleSystemFactory::FACTORY_TYPE_NAME})
+  {
+    const bool particles =
+        type == Ogre::ParticleSystemFactory::FACTORY_TYPE_NAME;
+    auto it = sceneManager->getMovableObjectIterator(type);
+    while (it.hasMoreElements())
+    {
+      Ogre::MovableObject *object = it.getNext();
+      if (!object->isVisible() ||
+          !(object->getVisibilityFlags() & visibilityMask) ||
+          !object->getParentNode())
+      {
+        continue;
+      }
+
+      const Ogre::Aabb aabb = object->getWorldAabbUpdated();
+      const Ogre::Node *node = object->getParentNode();
+      uint64_t signature = 0u;
+      HashCombine(signature, static_cast<const void *>(object));
+      HashCombine(signature, aabb.mCenter);
+      HashCombine(signature, aabb.mHalfSize);
+      HashCombine(signature, node->_getDerivedOrientation());
+      HashCombine(signature, node->_getDerivedScale());
+      if (particles)
+        HashCombine(signature, frame);
+      if (type == Ogre::ItemFactory::FACTORY_TYPE_NAME)
+      {
+        const Ogre::Item *item = static_cast<const Ogre::Item *>(object);
+        for (size_t j = 0u; j < item->getNumSubItems(); ++j)
+        {
+          HashCombine(signature,
+              static_cast<const void *>(item->getSubItem(j)->getDatablock()));
+        }
+      }
+
+      // test the bounding sphere of the object against the sides of the
+      // 90 degrees frustum of every face
+      const Ogre::Vector3 center = aabb.mCenter - position;
+      const Ogre::Real radius = aabb.mHalfSize.length() *
+        Ogre::Math::Sqrt(Ogre::Real(2));
+      for (unsigned int i = 0u; i < kWideAngleNumCubemapFaces; ++i)
+      {
+        const Ogre::Real f = center.dotProduct(forward[i]);
+        if (!std::isfinite(radius) ||
+            (f - std::abs(center.dotProduct(right[i])) >= -radius &&
+             f - std::abs(center.dotProduct(up[i])) >= -radius))
+        {
+          HashCombine(_signatures[i], signature);
+        }
+      }
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -1277,7 +1582,9 @@ void Ogre2WideAngleCamera::PostRender()
     pass->PostRender();
   }
 
-  if (this->dataPtr->newImageFrame.ConnectionCount() <= 0u)
+  const bool publishFrame =
+      this->dataPtr->newImageFrame.ConnectionCount() > 0u;
+  if (!publishFrame && this->newFrameViewEvent.ConnectionCount() == 0u)
     return;
 
   PixelFormat format = this->ImageFormat();
@@ -1290,56 +1597,133 @@ void Ogre2WideAngleCamera::PostRender()
   Ogre::TextureGpu *texture =
       this->dataPtr->ogreStitchTexture[kStichFinalTexture];
   void *rawData = nullptr;
+  // Declared here so the legacy path's in-place conversion stays valid until
+  // the frame has been published.
   Ogre::Image2 ogreImage;
-  if (format == PF_R8G8B8)
+  if (Ogre2UseLegacyReadback())
   {
-    ogreImage.convertFromTexture(texture, 0u, 0u);
-    Ogre::TextureBox box = ogreImage.getData(0u);
-
-    // Convert in-place from RGBA32 to RGB24 reusing the same memory region.
-    // The data contained will no longer be meaningful to Image2, but that
-    // class will no longer manipulate that data. We also store it contiguously
-    // (which is what gazebo expects), instead of aligning rows to 4 bytes like
-    // Ogre does. This saves RAM and lots of bandwidth.
-    uint8_t *RESTRICT_ALIAS rgb24 =
-      reinterpret_cast<uint8_t * RESTRICT_ALIAS>(box.data);
-    for (size_t y = 0; y < box.height; ++y)
+    // Legacy A/B control: original Ogre::Image2 path, kept verbatim.
+    if (format == PF_R8G8B8)
+    {
+      ogreImage.convertFromTexture(texture, 0u, 0u);
+      Ogre::TextureBox box = ogreImage.getData(0u);
+
+      // Convert in-place from RGBA32 to RGB24 reusing the same memory
+      // region. The data contained will no longer be meaningful to Image2,
+      // but that class will no longer manipulate that data. We also store it
+      // contiguously (which is what gazebo expects), instead of aligning rows
+      // to 4 bytes like Ogre does. This saves RAM and lots of bandwidth.
+      uint8_t *RESTRICT_ALIAS rgb24 =
+        reinterpret_cast<uint8_t * RESTRICT_ALIAS>(box.data);
+      for (size_t y = 0; y < box.height; ++y)
+      {
+        uint8_t *RESTRICT_ALIAS rgba32 =
+          reinterpret_cast<uint8_t * RESTRICT_ALIAS>(box.at(0u, y, 0u));
+        for (size_t x = 0; x < box.width; ++x)
+        {
+          *rgb24++ = *rgba32++;
+          *rgb24++ = *rgba32++;
+          *rgb24++ = *rgba32++;
+          ++rgba32;
+        }
+      }
+      rawData = box.data;
+    }
+    else
     {
-      uint8_t *RESTRICT_ALIAS rgba32 =
-        reinterpret_cast<uint8_t * RESTRICT_ALIAS>(box.at(0u, y, 0u));
-      for (size_t x = 0; x < box.width; ++x)
+      // convert to destination format
+      Ogre::PixelFormatGpu dstOgrePf = Ogre2Conversions::Convert(format);
+      Ogre::TextureBox dstBox(
+        texture->getInternalWidth(), texture->getInternalHeight(),
+        texture->getDepth(), texture->getNumSlices(),
+        static_cast<uint32_t>(
+          Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
+        static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
+          texture->getInternalWidth(), 1u, 1u, 1u, dstOgrePf, 1u)),
+        static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
+          texture->getInternalWidth(), texture->getInternalHeight(), 1u, 1u,
+          dstOgrePf, 1u)));
+      if (!this->dataPtr->dstImgData)
       {
-        *rgb24++ = *rgba32++;
-        *rgb24++ = *rgba32++;
-        *rgb24++ = *rgba32++;
-        ++rgba32;
+        this->dataPtr->dstImgData = std::make_unique<unsigned char []>(
+            width * height * channelCount * bytesPerChannel);
       }
+      dstBox.data = this->dataPtr->dstImgData.get();
+      Ogre::Image2::copyContentsToMemory(texture, texture->getEmptyBox(0u),
+                                         dstBox, dstOgrePf);
+      rawData = dstBox.data;
     }
-    rawData = box.data;
   }
   else
   {
-    // convert to destination format
-    Ogre::PixelFormatGpu dstOgrePf = Ogre2Conversions::Convert(format);
-    Ogre::TextureBox dstBox(
-      texture->getInternalWidth(), texture->getInternalHeight(),
-      texture->getDepth(), texture->getNumSlices(),
-      static_cast<uint32_t>(
-        Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
-      static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
-        texture->getInternalWidth(), 1u, 1u, 1u, dstOgrePf, 1u)),
-      static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
-        texture->getInternalWidth(), texture->getInternalHeight(), 1u, 1u,
-        dstOgrePf, 1u)));
+    // Persistent-ticket path: map the staging buffer once and repack or
+    // convert straight into the persistent image buffer in a single pass.
+    this->dataPtr->readback.SetLatency(this->ReadbackLatency());
+    Ogre::TextureBox box = this->dataPtr->readback.DownloadAndMap(texture);
+    if (!box.data)
+    {
+      if (!this->dataPtr->readback.Filling())
+      {
+        gzerr << "Ogre2WideAngleCamera: GPU readback failed; dropping frame"
+              << std::endl;
+      }
+      return;
+    }
+    // the stitched texture is always RGBA8
+    this->PublishFrameView(box.data, width, height, box.bytesPerRow,
+        PF_R8G8B8A8);
+    if (!publishFrame)
+    {
+      this->dataPtr->readback.Unmap();
+      return;
+    }
+
+    const size_t imageSize = width * height * channelCount * bytesPerChannel;
     if (!this->dataPtr->dstImgData)
     {
-      this->dataPtr->dstImgData = std::make_unique<unsigned char []>(
-          width * height * channelCount * bytesPerChannel);
+      this->dataPtr->dstImgData =
+          std::make_unique<unsigned char []>(imageSize);
+    }
+    // publish into the subscriber supplied buffer if there is one
+    unsigned char *dstImgData =
+        static_cast<unsigned char *>(this->OutputBuffer(imageSize));
+    if (!dstImgData)
+      dstImgData = this->dataPtr->dstImgData.get();
+
+    if (format == PF_R8G8B8)
+    {
+      // RGBA32 -> contiguous RGB24
+      uint8_t *RESTRICT_ALIAS rgb24 = dstImgData;
+      for (size_t y = 0; y < box.height; ++y)
+      {
+        const uint8_t *RESTRICT_ALIAS rgba32 =
+          reinterpret_cast<const uint8_t * RESTRICT_ALIAS>(
+          box.at(0u, y, 0u));
+        for (size_t x = 0; x < box.width; ++x)
+        {
+          *rgb24++ = *rgba32++;
+          *rgb24++ = *rgba32++;
+          *rgb24++ = *rgba32++;
+          ++rgba32;
+        }
+      }
+    }
+    else
+    {
+      Ogre::PixelFormatGpu dstOgrePf = Ogre2Conversions::Convert(format);
+      Ogre::TextureBox dstBox(width, height, 1u, 1u,
+        static_cast<uint32_t>(
+          Ogre::PixelFormatGpuUtils::getBytesPerPixel(dstOgrePf)),
+        static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
+          width, 1u, 1u, 1u, dstOgrePf, 1u)),
+        static_cast<uint32_t>(Ogre::PixelFormatGpuUtils::getSizeBytes(
+          width, height, 1u, 1u, dstOgrePf, 1u)));
+      dstBox.data = dstImgData;
+      Ogre::PixelFormatGpuUtils::bulkPixelConversion(
+          box, texture->getPixelFormat(), dstBox, dstOgrePf);
     }
-    dstBox.data = this->dataPtr->dstImgData.get();
-    Ogre::Image2::copyContentsToMemory(texture, texture->getEmptyBox(0u),
-                                       dstBox, dstOgrePf);
-    rawData = dstBox.data;
+    this->dataPtr->readback.Unmap();
+    rawData = dstImgData;
   }
   this->dataPtr->newImageFrame(reinterpret_cast<uint8_t *>(rawData), width,
                                height, channelCount,
@@ -1381,6 +1765,8 @@ void Ogre2WideAngleCamera::PrepareForCubemapFacePass(
   Ogre::CompositorPass *_pass)
 {
   this->dataPtr->ogreCamera->setFOVy(Ogre::Degree(90));
+  Ogre2MeshLod::UpdateCamera(*this, this->dataPtr->ogreCamera,
+      this->dataPtr->envTextureSize);
 
   auto const &bgColor = this->scene->BackgroundColor();
   _pass->getRenderPassDesc()->setClearColour(
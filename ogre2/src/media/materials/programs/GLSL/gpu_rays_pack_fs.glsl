@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version ogre_glsl_ver_330
+
+vulkan_layout( location = 0 )
+in block
+{
+  vec2 uv0;
+} inPs;
+
+// RGBA32F output of the 2nd pass: range, retro, 0, 1
+vulkan_layout( ogre_t0 ) uniform texture2D inputTexture;
+
+vulkan( layout( ogre_s0 ) uniform sampler texSampler );
+
+vulkan_layout( location = 0 )
+out vec4 fragColor;
+
+// Number of channels kept per input texel. The output is a single channel
+// texture that is this many times wider than the input, so that it holds the
+// tightly packed PF_FLOAT32_RGB layout published by the sensor and can be
+// read back with a single contiguous copy.
+const int packedChannels = 3;
+
+void main()
+{
+  ivec2 inputSize = textureSize(vkSampler2D(inputTexture, texSampler), 0);
+
+  // texel of the packed output this fragment writes
+  int x = int(inPs.uv0.x * float(inputSize.x * packedChannels));
+  int y = int(inPs.uv0.y * float(inputSize.y));
+
+  int column = x / packedChannels;
+  int channel = x - column * packedChannels;
+
+  vec4 texel = texelFetch(vkSampler2D(inputTexture, texSampler),
+      ivec2(column, y), 0);
+
+  float value = texel.x;
+  if (channel == 1)
+    value = texel.y;
+  else if (channel == 2)
+    value = texel.z;
+
+  fragColor = vec4(value, 0, 0, 1.0);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version ogre_glsl_ver_330
+
+// Direction of the ray, in the lidar visual's frame
+vulkan_layout( OGRE_POSITION ) in vec4 vertex;
+// Range measured along the ray
+vulkan_layout( OGRE_TEXCOORD0 ) in float uv0;
+
+vulkan( layout( ogre_P0 ) uniform Params { )
+  uniform mat4 worldViewProj;
+  // xyz: origin of the rays, w: 1 to display rays that hit nothing
+  uniform vec4 origin;
+  // xyz: point color, w: point size
+  uniform vec4 colorSize;
+  // x: max range
+  uniform vec4 rangeParams;
+vulkan( }; )
+
+vulkan_layout( location = 0 )
+out block
+{
+  vec3 ptColor;
+} outVs;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+  float gl_PointSize;
+};
+
+void main()
+{
+  float maxRange = rangeParams.x;
+  float range = uv0;
+  bool noHit = isinf(range) || isnan(range) || range >= maxRange;
+  if (noHit)
+    range = maxRange;
+
+  gl_Position = worldViewProj * vec4(origin.xyz + vertex.xyz * range, 1.0);
+  // move the points of rays that hit nothing out of the clip volume
+  // unless they are displayed
+  if (noHit && origin.w < 0.5)
+    gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+
+  gl_PointSize = colorSize.w;
+  outVs.ptColor = colorSize.xyz;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// For details and documentation see: gpu_rays_pack_fs.glsl
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct PS_INPUT
+{
+  float2 uv0;
+};
+
+struct Params
+{
+};
+
+constant int packedChannels = 3;
+
+fragment float4 main_metal
+(
+  PS_INPUT inPs [[stage_in]],
+  texture2d<float>  inputTexture [[texture(0)]],
+  sampler inputTextureSampler    [[sampler(0)]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  int2 inputSize = int2(inputTexture.get_width(),
+                        inputTexture.get_height());
+
+  // texel of the packed output this fragment writes
+  int x = int(inPs.uv0.x * float(inputSize.x * packedChannels));
+  int y = int(inPs.uv0.y * float(inputSize.y));
+
+  int column = x / packedChannels;
+  int channel = x - column * packedChannels;
+
+  float4 texel = inputTexture.read(uint2(column, y));
+
+  float value = texel.x;
+  if (channel == 1)
+    value = texel.y;
+  else if (channel == 2)
+    value = texel.z;
+
+  return float4(value, 0, 0, 1.0);
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct VS_INPUT
+{
+  // Direction of the ray, in the lidar visual's frame
+  float4 position [[attribute(VES_POSITION)]];
+  // Range measured along the ray
+  float  uv0      [[attribute(VES_TEXTURE_COORDINATES0)]];
+};
+
+struct PS_INPUT
+{
+  float4 gl_Position  [[position]];
+  float  gl_PointSize [[point_size]];
+  float3 ptColor;
+};
+
+struct Params
+{
+  float4x4 worldViewProj;
+  // xyz: origin of the rays, w: 1 to display rays that hit nothing
+  float4 origin;
+  // xyz: point color, w: point size
+  float4 colorSize;
+  // x: max range
+  float4 rangeParams;
+};
+
+vertex PS_INPUT main_metal
+(
+  VS_INPUT input [[stage_in]],
+  constant Params &p [[buffer(PARAMETER_SLOT)]]
+)
+{
+  PS_INPUT outVs;
+
+  float maxRange = p.rangeParams.x;
+  float range = input.uv0;
+  bool noHit = isinf(range) || isnan(range) || range >= maxRange;
+  if (noHit)
+    range = maxRange;
+
+  outVs.gl_Position = p.worldViewProj *
+      float4(p.origin.xyz + input.position.xyz * range, 1.0);
+  // move the points of rays that hit nothing out of the clip volume
+  // unless they are displayed
+  if (noHit && p.origin.w < 0.5)
+    outVs.gl_Position = float4(2.0, 2.0, 2.0, 1.0);
+
+  outVs.gl_PointSize = p.colorSize.w;
+  outVs.ptColor = p.colorSize.xyz;
+
+  return outVs;
+}
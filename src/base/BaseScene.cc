@@ -39,6 +39,7 @@
 #include "gz/rendering/GpuRays.hh"
 #include "gz/rendering/Grid.hh"
 #include "gz/rendering/ParticleEmitter.hh"
+#include "gz/rendering/PointCloudVisual.hh"
 #include "gz/rendering/Projector.hh"
 #include "gz/rendering/RayQuery.hh"
 #include "gz/rendering/RenderTarget.hh"
@@ -335,6 +336,52 @@ void BaseScene::DestroyNodes()
   this->nodes->DestroyAll();
 }
 
+//////////////////////////////////////////////////
+unsigned int BaseScene::SetLocalPoses(const unsigned int *_ids,
+    const math::Pose3d *_poses, unsigned int _count)
+{
+  unsigned int changed = 0u;
+  for (unsigned int i = 0u; i < _count; ++i)
+  {
+    NodePtr node = this->nodes->GetById(_ids[i]);
+    if (!node)
+      continue;
+
+    const math::Pose3d &pose = _poses[i];
+    if (!pose.IsFinite())
+    {
+      gzerr << "Unable to set non-finite pose [" << pose
+            << "] to node [" << node->Name() << "]" << std::endl;
+      continue;
+    }
+
+    // render engines store poses in single precision, compare at that
+    // precision so a pose re-sent unchanged every frame is skipped
+    const math::Pose3d current = node->LocalPose();
+    if (static_cast<float>(pose.Pos().X()) ==
+            static_cast<float>(current.Pos().X()) &&
+        static_cast<float>(pose.Pos().Y()) ==
+            static_cast<float>(current.Pos().Y()) &&
+        static_cast<float>(pose.Pos().Z()) ==
+            static_cast<float>(current.Pos().Z()) &&
+        static_cast<float>(pose.Rot().W()) ==
+            static_cast<float>(current.Rot().W()) &&
+        static_cast<float>(pose.Rot().X()) ==
+            static_cast<float>(current.Rot().X()) &&
+        static_cast<float>(pose.Rot().Y()) ==
+            static_cast<float>(current.Rot().Y()) &&
+        static_cast<float>(pose.Rot().Z()) ==
+            static_cast<float>(current.Rot().Z()))
+    {
+      continue;
+    }
+
+    node->SetLocalPose(pose);
+    ++changed;
+  }
+  return changed;
+}
+
 //////////////////////////////////////////////////
 unsigned int BaseScene::LightCount() const
 {
@@ -1209,6 +1256,24 @@ MeshPtr BaseScene::CreateMesh(const MeshDescriptor &_desc)
   return this->CreateMeshImpl(objId, objName, _desc);
 }
 
+//////////////////////////////////////////////////
+MeshPtr BaseScene::CreateMeshAsync(const MeshDescriptor &_desc)
+{
+  std::string meshName = (_desc.mesh) ?
+      _desc.mesh->Name() : _desc.meshName;
+
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "Mesh-" + meshName);
+  return this->CreateMeshAsyncImpl(objId, objName, _desc);
+}
+
+//////////////////////////////////////////////////
+MeshPtr BaseScene::CreateMeshAsyncImpl(unsigned int _id,
+    const std::string &_name, const MeshDescriptor &_desc)
+{
+  return this->CreateMeshImpl(_id, _name, _desc);
+}
+
 //////////////////////////////////////////////////
 HeightmapPtr BaseScene::CreateHeightmap(const HeightmapDescriptor &_desc)
 {
@@ -1263,6 +1328,38 @@ LidarVisualPtr BaseScene::CreateLidarVisual(unsigned int _id,
   return (result) ? lidar : nullptr;
 }
 
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreatePointCloudVisual(objId);
+}
+
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual(unsigned int _id)
+{
+  const std::string objName =
+      this->CreateObjectName(_id, "PointCloudVisual");
+  return this->CreatePointCloudVisual(_id, objName);
+}
+
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual(
+    const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreatePointCloudVisual(objId, _name);
+}
+
+//////////////////////////////////////////////////
+PointCloudVisualPtr BaseScene::CreatePointCloudVisual(unsigned int _id,
+    const std::string &_name)
+{
+  PointCloudVisualPtr visual = this->CreatePointCloudVisualImpl(_id, _name);
+  bool result = this->RegisterVisual(visual);
+  return (result) ? visual : nullptr;
+}
+
 //////////////////////////////////////////////////
 FrustumVisualPtr BaseScene::CreateFrustumVisual()
 {
@@ -1543,7 +1640,25 @@ void BaseScene::SetActiveGlobalIllumination(GlobalIlluminationBasePtr _gi)
 //////////////////////////////////////////////////
 void BaseScene::PreRender()
 {
-  this->RootVisual()->PreRender();
+  this->preRenderVisitedNodeCount = this->RootVisual()->PreRenderIfDirty();
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::PreRenderVisitedNodeCount() const
+{
+  return this->preRenderVisitedNodeCount;
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::DrawCallCount() const
+{
+  return 0u;
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::DrawnInstanceCount() const
+{
+  return 0u;
 }
 
 //////////////////////////////////////////////////
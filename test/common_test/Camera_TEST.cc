@@ -17,10 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Camera.hh"
 #include "gz/rendering/GaussianNoisePass.hh"
+#include "gz/rendering/Image.hh"
 #include "gz/rendering/RenderPassSystem.hh"
 #include "gz/rendering/Scene.hh"
 #include "gz/rendering/Utils.hh"
@@ -308,6 +311,67 @@ TEST_F(CameraTest, VisibilityMask)
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(CameraTest, ReadbackLatency)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(48);
+
+  // synchronous readback by default
+  EXPECT_EQ(0u, camera->ReadbackLatency());
+
+  // render every frame with its own background color and record what a
+  // synchronous readback gives for it
+  const unsigned int frameCount = 6u;
+  auto frameColor = [](unsigned int _frame)
+  {
+    return math::Color(0.1f + 0.15f * _frame, 0.0f, 0.0f);
+  };
+  Image image = camera->CreateImage();
+  unsigned char *data = image.Data<unsigned char>();
+  unsigned char expected[frameCount];
+  for (unsigned int k = 0u; k < frameCount; ++k)
+  {
+    scene->SetBackgroundColor(frameColor(k));
+    camera->Capture(image);
+    expected[k] = data[0];
+  }
+
+  const unsigned int latency = 2u;
+  camera->SetReadbackLatency(latency);
+  EXPECT_EQ(latency, camera->ReadbackLatency());
+
+  // frame k - N is delivered at frame k and nothing is delivered while the
+  // ring is filling up. Only ogre2 pipelines the readback.
+  const unsigned int delay = this->engineToTest == "ogre2" ? latency : 0u;
+  const unsigned char unset = 0xFF;
+  for (unsigned int k = 0u; k < frameCount; ++k)
+  {
+    std::memset(data, unset, image.MemorySize());
+    scene->SetBackgroundColor(frameColor(k));
+    camera->Capture(image);
+    if (k < delay)
+      EXPECT_EQ(unset, data[0]) << "frame " << k;
+    else
+      EXPECT_EQ(expected[k - delay], data[0]) << "frame " << k;
+  }
+
+  // synchronous readback again
+  camera->SetReadbackLatency(0u);
+  EXPECT_EQ(0u, camera->ReadbackLatency());
+  scene->SetBackgroundColor(frameColor(0u));
+  camera->Capture(image);
+  EXPECT_EQ(expected[0], data[0]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(CameraTest, IntrinsicMatrix)
 {
@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/LidarVisual.hh"
@@ -104,6 +107,25 @@ TEST_F(LidarVisualTest, LidarVisual)
   lidar->ClearPoints();
   EXPECT_EQ(lidar->PointCount(), 0u);
 
+  // ranges interleaved with a second channel, as in a GpuRays frame
+  lidar->SetType(LVT_GPU_POINTS);
+  EXPECT_EQ(lidar->Type(), LVT_GPU_POINTS);
+  std::vector<float> frame{10.0f, 1.0f, 15.0f, 2.0f, INFINITY, 3.0f,
+                           3.5f, 4.0f};
+  lidar->SetPoints(frame.data(), 4u, 2u);
+  ASSERT_EQ(4u, lidar->PointCount());
+  std::vector<double> ranges = lidar->Points();
+  ASSERT_EQ(4u, ranges.size());
+  EXPECT_DOUBLE_EQ(10.0, ranges[0]);
+  EXPECT_DOUBLE_EQ(15.0, ranges[1]);
+  EXPECT_TRUE(std::isinf(ranges[2]));
+  EXPECT_DOUBLE_EQ(3.5, ranges[3]);
+  lidar->SetHorizontalRayCount(4u);
+  lidar->SetVerticalRayCount(1u);
+  lidar->Update();
+  lidar->ClearPoints();
+  EXPECT_EQ(lidar->PointCount(), 0u);
+
   // Clean up
   engine->DestroyScene(scene);
 }
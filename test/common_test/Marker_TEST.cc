@@ -16,10 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Marker.hh"
 #include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
 
 using namespace gz;
 using namespace rendering;
@@ -95,3 +98,51 @@ TEST_F(MarkerTest, Marker)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(MarkerTest, SetPoints)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+
+  MarkerPtr marker = scene->CreateMarker();
+  ASSERT_NE(nullptr, marker);
+  marker->SetType(MarkerType::MT_LINE_STRIP);
+
+  VisualPtr visual = scene->CreateVisual();
+  ASSERT_NE(nullptr, visual);
+  visual->AddGeometry(marker);
+  scene->RootVisual()->AddChild(visual);
+
+  // a path that grows by one point per update
+  std::vector<float> points;
+  for (unsigned int i = 0; i < 1000u; ++i)
+  {
+    points.push_back(0.01f * i);
+    points.push_back(0.0f);
+    points.push_back(1.0f);
+  }
+  EXPECT_NO_THROW(marker->SetPoints(points.data(), points.size() / 3));
+  EXPECT_NO_THROW(scene->PreRender());
+
+  for (unsigned int i = 0; i < 5u; ++i)
+  {
+    points.push_back(10.0f + i);
+    points.push_back(1.0f);
+    points.push_back(1.0f);
+    EXPECT_NO_THROW(marker->SetPoints(points.data(), points.size() / 3,
+        math::Color::Red));
+    EXPECT_NO_THROW(scene->PreRender());
+  }
+
+  // move a single point, shrink the path and switch to points
+  EXPECT_NO_THROW(marker->SetPoint(10, math::Vector3d(0, 0, 5)));
+  EXPECT_NO_THROW(scene->PreRender());
+  EXPECT_NO_THROW(marker->SetPoints(points.data(), 10u));
+  marker->SetType(MarkerType::MT_POINTS);
+  EXPECT_NO_THROW(scene->PreRender());
+  EXPECT_NO_THROW(marker->ClearPoints());
+  EXPECT_NO_THROW(scene->PreRender());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
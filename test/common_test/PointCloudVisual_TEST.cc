@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/PointCloudVisual.hh"
+#include "gz/rendering/Scene.hh"
+
+using namespace gz;
+using namespace rendering;
+using namespace std::chrono_literals;
+
+/// \brief The test fixture.
+class PointCloudVisualTest : public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(PointCloudVisualTest, PointCloudVisual)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  PointCloudVisualPtr cloud = scene->CreatePointCloudVisual();
+  ASSERT_NE(nullptr, cloud);
+  scene->RootVisual()->AddChild(cloud);
+
+  // check default properties
+  EXPECT_EQ(0u, cloud->PointCount());
+  EXPECT_EQ(0u, cloud->DrawnPointCount());
+  EXPECT_DOUBLE_EQ(1.0, cloud->Size());
+  EXPECT_LT(0.0, cloud->ScreenSpaceError());
+  EXPECT_LT(0u, cloud->PointBudget());
+  EXPECT_LT(0u, cloud->UploadBudget());
+  EXPECT_LT(0u, cloud->GpuPointBudget());
+
+  // test APIs
+  cloud->SetSize(3.0);
+  EXPECT_DOUBLE_EQ(3.0, cloud->Size());
+  cloud->SetScreenSpaceError(1.5);
+  EXPECT_DOUBLE_EQ(1.5, cloud->ScreenSpaceError());
+  cloud->SetPointBudget(100000u);
+  EXPECT_EQ(100000u, cloud->PointBudget());
+  cloud->SetUploadBudget(50000u);
+  EXPECT_EQ(50000u, cloud->UploadBudget());
+  cloud->SetGpuPointBudget(200000u);
+  EXPECT_EQ(200000u, cloud->GpuPointBudget());
+
+  // a 200 x 200 grid of points in front of the camera, and a point with
+  // non finite coordinates that is skipped
+  std::vector<float> points;
+  for (int i = 0; i < 200; ++i)
+  {
+    for (int j = 0; j < 200; ++j)
+    {
+      points.push_back(5.0f);
+      points.push_back(-1.0f + 0.01f * i);
+      points.push_back(-1.0f + 0.01f * j);
+    }
+  }
+  points.push_back(NAN);
+  points.push_back(0.0f);
+  points.push_back(0.0f);
+  cloud->AddPoints(points.data(), points.size() / 3u - 1u,
+      math::Color::Red);
+  cloud->AddPoints(points.data() + points.size() - 3u, 1u);
+  EXPECT_EQ(40000u, cloud->PointCount());
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(320u);
+  camera->SetImageHeight(240u);
+  scene->RootVisual()->AddChild(camera);
+
+  // the points are inserted in the background and uploaded over a few
+  // frames
+  for (unsigned int i = 0; i < 100u && cloud->DrawnPointCount() == 0u; ++i)
+  {
+    camera->Update();
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_LT(0u, cloud->DrawnPointCount());
+  EXPECT_GE(40000u, cloud->DrawnPointCount());
+
+  cloud->ClearPoints();
+  EXPECT_EQ(0u, cloud->PointCount());
+  camera->Update();
+  camera->Update();
+  EXPECT_EQ(0u, cloud->DrawnPointCount());
+
+  engine->DestroyScene(scene);
+}
@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/Camera.hh"
@@ -109,3 +111,141 @@ TEST_F(RayQueryTest, RayQuery)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(RayQueryTest, MeshIntersection)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  VisualPtr box = scene->CreateVisual();
+  ASSERT_NE(nullptr, box);
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(5.0, 0.0, 0.0);
+  root->AddChild(box);
+
+  RayQueryPtr rayQuery = scene->CreateRayQuery();
+  ASSERT_NE(nullptr, rayQuery);
+  rayQuery->SetOrigin(math::Vector3d(0.0, 0.2, -0.1));
+  rayQuery->SetDirection(math::Vector3d::UnitX);
+
+  RayQueryResult result = rayQuery->ClosestPoint();
+  EXPECT_TRUE(result);
+  EXPECT_EQ(box->Id(), result.objectId);
+  EXPECT_NEAR(4.5, result.distance, 1e-4);
+  EXPECT_NEAR(4.5, result.point.X(), 1e-4);
+  EXPECT_NEAR(0.2, result.point.Y(), 1e-4);
+  EXPECT_NEAR(-0.1, result.point.Z(), 1e-4);
+
+  // the mesh triangles are cached in mesh space, so moving and scaling the
+  // visual must still give the right hit point
+  box->SetLocalPosition(8.0, 1.0, 0.0);
+  box->SetLocalScale(2.0);
+  rayQuery->SetOrigin(math::Vector3d(0.0, 1.5, 0.5));
+  result = rayQuery->ClosestPoint();
+  EXPECT_TRUE(result);
+  EXPECT_EQ(box->Id(), result.objectId);
+  EXPECT_NEAR(7.0, result.point.X(), 1e-4);
+  EXPECT_NEAR(1.5, result.point.Y(), 1e-4);
+  EXPECT_NEAR(0.5, result.point.Z(), 1e-4);
+
+  // the closest of two boxes sharing the same mesh is reported
+  VisualPtr box2 = scene->CreateVisual();
+  ASSERT_NE(nullptr, box2);
+  box2->AddGeometry(scene->CreateBox());
+  box2->SetLocalPosition(3.0, 1.5, 0.5);
+  root->AddChild(box2);
+  result = rayQuery->ClosestPoint();
+  EXPECT_TRUE(result);
+  EXPECT_EQ(box2->Id(), result.objectId);
+  EXPECT_NEAR(2.5, result.point.X(), 1e-4);
+
+  // miss
+  rayQuery->SetOrigin(math::Vector3d(0.0, 5.0, 0.0));
+  result = rayQuery->ClosestPoint();
+  EXPECT_FALSE(result);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(RayQueryTest, ClosestPoints)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  VisualPtr box = scene->CreateVisual();
+  ASSERT_NE(nullptr, box);
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(5.0, 0.0, 0.0);
+  root->AddChild(box);
+
+  VisualPtr box2 = scene->CreateVisual();
+  ASSERT_NE(nullptr, box2);
+  box2->AddGeometry(scene->CreateBox());
+  box2->SetLocalPosition(0.0, 4.0, 0.0);
+  box2->SetLocalScale(2.0);
+  root->AddChild(box2);
+
+  RayQueryPtr rayQuery = scene->CreateRayQuery();
+  ASSERT_NE(nullptr, rayQuery);
+  const math::Vector3d origin(0.0, 0.2, -0.1);
+  rayQuery->SetOrigin(origin);
+  rayQuery->SetDirection(math::Vector3d::UnitX);
+
+  std::vector<math::Vector3d> origins = {
+      origin, math::Vector3d(0.3, 0.0, 0.2), origin,
+      math::Vector3d(0.0, 8.0, 0.0)};
+  std::vector<math::Vector3d> directions = {
+      math::Vector3d::UnitX, math::Vector3d::UnitY, -math::Vector3d::UnitX,
+      math::Vector3d::UnitX};
+
+  std::vector<RayQueryResult> results =
+      rayQuery->ClosestPoints(origins, directions);
+  ASSERT_EQ(origins.size(), results.size());
+
+  // the ray query origin and direction are left untouched
+  EXPECT_EQ(origin, rayQuery->Origin());
+  EXPECT_EQ(math::Vector3d::UnitX, rayQuery->Direction());
+
+  EXPECT_TRUE(results[0]);
+  EXPECT_EQ(box->Id(), results[0].objectId);
+  EXPECT_NEAR(4.5, results[0].point.X(), 1e-4);
+  EXPECT_NEAR(0.2, results[0].point.Y(), 1e-4);
+  EXPECT_NEAR(-0.1, results[0].point.Z(), 1e-4);
+
+  EXPECT_TRUE(results[1]);
+  EXPECT_EQ(box2->Id(), results[1].objectId);
+  EXPECT_NEAR(0.3, results[1].point.X(), 1e-4);
+  EXPECT_NEAR(3.0, results[1].point.Y(), 1e-4);
+  EXPECT_NEAR(0.2, results[1].point.Z(), 1e-4);
+
+  EXPECT_FALSE(results[2]);
+  EXPECT_FALSE(results[3]);
+
+  // every ray gives the same result as a single ray query
+  for (size_t i = 0u; i < origins.size(); ++i)
+  {
+    rayQuery->SetOrigin(origins[i]);
+    rayQuery->SetDirection(directions[i]);
+    RayQueryResult result = rayQuery->ClosestPoint();
+    EXPECT_EQ(static_cast<bool>(result), static_cast<bool>(results[i]));
+    EXPECT_EQ(result.objectId, results[i].objectId);
+    EXPECT_NEAR(result.distance, results[i].distance, 1e-4);
+    EXPECT_EQ(result.point, results[i].point);
+  }
+
+  // mismatched sizes
+  directions.pop_back();
+  EXPECT_TRUE(rayQuery->ClosestPoints(origins, directions).empty());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
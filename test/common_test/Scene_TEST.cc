@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include "gz/rendering/RenderTarget.hh"
@@ -791,3 +794,188 @@ TEST_F(SceneTest, ShadowTextureSize)
   EXPECT_FALSE(scene->SetShadowTextureSize(LightType::DIRECTIONAL, 32768u));
   EXPECT_EQ(scene->ShadowTextureSize(LightType::DIRECTIONAL), 8192u);
 }
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, PreRenderDirtyTracking)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  VisualPtr parent = scene->CreateVisual("parent");
+  root->AddChild(parent);
+
+  std::vector<VisualPtr> children;
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    VisualPtr child = scene->CreateVisual("child" + std::to_string(i));
+    child->AddGeometry(scene->CreateBox());
+    parent->AddChild(child);
+    children.push_back(child);
+  }
+  EXPECT_EQ(4u, scene->NodeCount());
+
+  // everything is new and gets visited
+  EXPECT_TRUE(root->PreRenderDirty());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(5u, scene->PreRenderVisitedNodeCount());
+  EXPECT_FALSE(root->PreRenderDirty());
+
+  // nothing changed
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(0u, scene->PreRenderVisitedNodeCount());
+
+  // a pose change only visits the path to the changed node
+  children[1]->SetLocalPosition(1, 2, 3);
+  EXPECT_TRUE(children[1]->PreRenderDirty());
+  EXPECT_TRUE(parent->PreRenderDirty());
+  EXPECT_TRUE(root->PreRenderDirty());
+  EXPECT_FALSE(children[0]->PreRenderDirty());
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(3u, scene->PreRenderVisitedNodeCount());
+
+  // a material set on the parent is propagated to the whole subtree
+  MaterialPtr material = scene->CreateMaterial();
+  parent->SetMaterial(material);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(5u, scene->PreRenderVisitedNodeCount());
+
+  // visibility
+  children[2]->SetVisible(false);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(3u, scene->PreRenderVisitedNodeCount());
+
+  // a newly added subtree is visited
+  VisualPtr added = scene->CreateVisual("added");
+  added->AddGeometry(scene->CreateSphere());
+  children[0]->AddChild(added);
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(4u, scene->PreRenderVisitedNodeCount());
+  EXPECT_EQ(5u, scene->NodeCount());
+
+  // explicit marking
+  added->MarkPreRenderDirty();
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(4u, scene->PreRenderVisitedNodeCount());
+
+  scene->PreRender();
+  scene->PostRender();
+  EXPECT_EQ(0u, scene->PreRenderVisitedNodeCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, SetLocalPoses)
+{
+  CHECK_SUPPORTED_ENGINE("ogre", "ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  std::vector<VisualPtr> visuals;
+  std::vector<unsigned int> ids;
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    root->AddChild(visual);
+    visuals.push_back(visual);
+    ids.push_back(visual->Id());
+  }
+
+  // a visual with an origin offset goes through Node::SetLocalPose
+  visuals[2]->SetOrigin(0, 0, 0.5);
+
+  std::vector<math::Pose3d> poses = {
+    math::Pose3d(1, 2, 3, 0, 0, 0.5),
+    math::Pose3d(-1, 0, 0.25, 0.1, 0, 0),
+    math::Pose3d(0, 4, 0, 0, 0, GZ_PI)};
+  EXPECT_EQ(3u, scene->SetLocalPoses(ids.data(), poses.data(), 3u));
+  for (unsigned int i = 0u; i < 3u; ++i)
+    EXPECT_EQ(poses[i], visuals[i]->LocalPose());
+
+  scene->PreRender();
+  scene->PostRender();
+
+  // re-sending the same poses changes nothing
+  EXPECT_EQ(0u, scene->SetLocalPoses(ids.data(), poses.data(), 3u));
+  EXPECT_FALSE(root->PreRenderDirty());
+
+  // only the changed pose is applied
+  poses[1].Pos().X() = 2.0;
+  EXPECT_EQ(1u, scene->SetLocalPoses(ids.data(), poses.data(), 3u));
+  EXPECT_EQ(poses[1], visuals[1]->LocalPose());
+  EXPECT_TRUE(visuals[1]->PreRenderDirty());
+  EXPECT_FALSE(visuals[0]->PreRenderDirty());
+
+  // unknown ids and non-finite poses are skipped
+  unsigned int badId = 123456u;
+  math::Pose3d badPose(math::NAN_D, 0, 0, 0, 0, 0);
+  EXPECT_EQ(0u, scene->SetLocalPoses(&badId, poses.data(), 1u));
+  EXPECT_EQ(0u, scene->SetLocalPoses(ids.data(), &badPose, 1u));
+  EXPECT_EQ(poses[0], visuals[0]->LocalPose());
+
+  scene->PreRender();
+  scene->PostRender();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, LookupAfterDestroy)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  std::vector<VisualPtr> visuals;
+  for (unsigned int i = 0u; i < 6u; ++i)
+    visuals.push_back(scene->CreateVisual("visual" + std::to_string(i)));
+  EXPECT_EQ(6u, scene->VisualCount());
+
+  // destroy visuals in the middle and at the end of the store
+  scene->DestroyVisualById(visuals[1]->Id());
+  scene->DestroyVisualByName("visual3");
+  scene->DestroyVisual(visuals[5]);
+  EXPECT_EQ(3u, scene->VisualCount());
+
+  // remaining visuals are found by id and name
+  for (unsigned int i : {0u, 2u, 4u})
+  {
+    EXPECT_TRUE(scene->HasVisualId(visuals[i]->Id()));
+    EXPECT_EQ(visuals[i], scene->VisualById(visuals[i]->Id()));
+    EXPECT_EQ(visuals[i], scene->VisualByName(visuals[i]->Name()));
+  }
+  for (unsigned int i : {1u, 3u, 5u})
+  {
+    EXPECT_FALSE(scene->HasVisualId(visuals[i]->Id()));
+    EXPECT_FALSE(scene->HasVisualName("visual" + std::to_string(i)));
+  }
+
+  // insertion order is preserved
+  EXPECT_EQ(visuals[0], scene->VisualByIndex(0u));
+  EXPECT_EQ(visuals[2], scene->VisualByIndex(1u));
+  EXPECT_EQ(visuals[4], scene->VisualByIndex(2u));
+  EXPECT_EQ(nullptr, scene->VisualByIndex(3u));
+
+  // lookups still work after adding more visuals
+  VisualPtr added = scene->CreateVisual("added");
+  EXPECT_EQ(added, scene->VisualByIndex(3u));
+  EXPECT_EQ(added, scene->VisualById(added->Id()));
+  EXPECT_EQ(visuals[4], scene->VisualById(visuals[4]->Id()));
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
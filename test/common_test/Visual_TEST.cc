@@ -499,6 +499,51 @@ TEST_F(VisualTest, Wireframe)
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+TEST_F(VisualTest, Static)
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene8");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr visual = scene->CreateVisual();
+  ASSERT_NE(nullptr, visual);
+  visual->AddGeometry(scene->CreateBox());
+  scene->RootVisual()->AddChild(visual);
+  EXPECT_FALSE(visual->Static());
+
+  visual->SetStatic(true);
+  EXPECT_TRUE(visual->Static());
+
+  // setting the same state twice is harmless
+  visual->SetStatic(true);
+  EXPECT_TRUE(visual->Static());
+
+  // static visuals can still be moved and extended
+  const math::Pose3d pose(1, 2, 3, 0, 0, 1);
+  visual->SetLocalPose(pose);
+  EXPECT_EQ(pose, visual->LocalPose());
+  visual->SetLocalScale(2.0);
+  EXPECT_EQ(math::Vector3d(2, 2, 2), visual->LocalScale());
+  GeometryPtr sphere = scene->CreateSphere();
+  visual->AddGeometry(sphere);
+  EXPECT_EQ(2u, visual->GeometryCount());
+
+  // geometries detached from a static visual can go to a dynamic one
+  visual->RemoveGeometry(sphere);
+  VisualPtr dynamicVisual = scene->CreateVisual();
+  ASSERT_NE(nullptr, dynamicVisual);
+  dynamicVisual->AddGeometry(sphere);
+  EXPECT_FALSE(dynamicVisual->Static());
+
+  visual->SetStatic(false);
+  EXPECT_FALSE(visual->Static());
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(VisualTest, Clone)
 {
@@ -39,11 +39,13 @@ endif()
 #                 [HEADLESS]
 #                 [RENDER_ENGINE <arg>]
 #                 [RENDER_ENGINE_BACKEND <arg>]
+#                 [SUFFIX <arg>]
+#                 [ENVIRONMENT <args>...]
 #
 # Set up a rendering test to match Gazebo test conventions with additionally
 # specifying engine-specific test parameters
 #
-# The test will be added with the name <TARGET>_<ENGINE>_<BACKEND>
+# The test will be added with the name <TARGET>_<ENGINE>_<BACKEND>[_<SUFFIX>]
 # For example: UNIT_Camera_TEST_ogre2_gl3plus
 #
 # <TARGET>: The executable to create a test from. The same executable may be
@@ -55,10 +57,16 @@ endif()
 #                          to be used by the test (eg "metal", "vulkan")
 #
 # [HEADLESS]: Optional.  Enable headless rendering if the engine/backend supports it
+#
+# [SUFFIX]: Optional. Appended to the test name, to run the same executable
+#           again with a different ENVIRONMENT
+#
+# [ENVIRONMENT]: Optional. Additional environment variables of the test,
+#                as NAME=VALUE pairs
 macro(gz_configure_rendering_test)
   set(options HEADLESS)
-  set(oneValueArgs TARGET RENDER_ENGINE RENDER_ENGINE_BACKEND)
-  set(multiValueArgs)
+  set(oneValueArgs TARGET RENDER_ENGINE RENDER_ENGINE_BACKEND SUFFIX)
+  set(multiValueArgs ENVIRONMENT)
 
   _gz_cmake_parse_arguments(gz_configure_rendering_test
     "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
@@ -68,6 +76,9 @@ macro(gz_configure_rendering_test)
   endif()
 
   set(test_name ${gz_configure_rendering_test_TARGET}_${gz_configure_rendering_test_RENDER_ENGINE}_${gz_configure_rendering_test_RENDER_ENGINE_BACKEND})
+  if(DEFINED gz_configure_rendering_test_SUFFIX)
+    set(test_name ${test_name}_${gz_configure_rendering_test_SUFFIX})
+  endif()
 
   add_test(NAME ${test_name}
     COMMAND ${gz_configure_rendering_test_TARGET} --gtest_output=xml:${CMAKE_BINARY_DIR}/test_results/${test_name}.xml)
@@ -93,6 +104,13 @@ macro(gz_configure_rendering_test)
         ENVIRONMENT "GZ_ENGINE_HEADLESS=1")
   endif()
 
+  foreach(env ${gz_configure_rendering_test_ENVIRONMENT})
+    set_property(
+        TEST ${test_name}
+        APPEND PROPERTY
+        ENVIRONMENT "${env}")
+  endforeach()
+
   if(Python3_Interpreter_FOUND)
     # Check that the test produced a result and create a failure if it didn't.
     # Guards against crashed and timed out tests.
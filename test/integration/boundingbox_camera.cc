@@ -298,6 +298,21 @@ TEST_F(BoundingBoxCameraTest, OccludedBoxes)
 
   g_mutex.unlock();
 
+  // The mesh vertices are cached after the first frame, the next frames
+  // must give the same boxes
+  camera->Update();
+
+  g_mutex.lock();
+  EXPECT_EQ(g_boxes.size(), size_t(2));
+  if (g_boxes.size() == 2u)
+  {
+    EXPECT_EQ(occludedFullBox.Center(), g_boxes[0].Center());
+    EXPECT_EQ(occludedFullBox.Size(), g_boxes[0].Size());
+    EXPECT_EQ(frontFullBox.Center(), g_boxes[1].Center());
+    EXPECT_EQ(frontFullBox.Size(), g_boxes[1].Size());
+  }
+  g_mutex.unlock();
+
   // Clean up
   engine->DestroyScene(scene);
 }
@@ -16,7 +16,11 @@
 */
 
 #include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
 #include <string>
+#include <vector>
 
 #include "CommonRenderingTest.hh"
 
@@ -861,3 +865,232 @@ TEST_F(DepthCameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraProjection))
 
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(DepthCameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCameraFrameView))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  const unsigned int width = 64u;
+  const unsigned int height = 48u;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  gz::rendering::VisualPtr root = scene->RootVisual();
+  gz::rendering::VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(2.0, 0.0, 0.0);
+  box->SetLocalScale(1.0, 10.0, 10.0);
+  root->AddChild(box);
+
+  auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+  ASSERT_NE(depthCamera, nullptr);
+  depthCamera->SetImageWidth(width);
+  depthCamera->SetImageHeight(height);
+  depthCamera->SetNearClipPlane(0.1);
+  depthCamera->SetFarClipPlane(10.0);
+  depthCamera->CreateDepthTexture();
+  root->AddChild(depthCamera);
+
+  // subscriber supplied output buffer for the depth frame
+  std::vector<float> output(width * height, 0.0f);
+  depthCamera->SetOutputBuffer(output.data(), output.size() * sizeof(float));
+
+  const float *published = nullptr;
+  gz::common::ConnectionPtr connection =
+    depthCamera->ConnectNewDepthFrame(
+        [&published](const float *_data, unsigned int, unsigned int,
+                     unsigned int, const std::string &)
+        {
+          published = _data;
+        });
+
+  // borrowed view of the mapped readback memory
+  unsigned int viewCount = 0u;
+  float viewCenter = 0.0f;
+  std::weak_ptr<const void> lifetime;
+  gz::common::ConnectionPtr viewConnection =
+    depthCamera->ConnectNewFrameView(
+        [&](const gz::rendering::FrameView &_view)
+        {
+          EXPECT_TRUE(_view.Valid());
+          EXPECT_EQ(width, _view.width);
+          EXPECT_EQ(height, _view.height);
+          EXPECT_EQ(gz::rendering::PF_FLOAT32_RGBA, _view.format);
+          EXPECT_GE(_view.rowPitch, width * 4u * sizeof(float));
+          const unsigned char *row =
+              static_cast<const unsigned char *>(_view.data) +
+              (height / 2u) * _view.rowPitch;
+          viewCenter = reinterpret_cast<const float *>(row)[
+              (width / 2u) * 4u];
+          lifetime = _view.lifetime;
+          ++viewCount;
+        });
+
+  depthCamera->Update();
+
+  // the view must not outlive the callback
+  EXPECT_EQ(1u, viewCount);
+  EXPECT_TRUE(lifetime.expired());
+
+  // the depth frame is published straight from the supplied buffer and
+  // matches what the view saw
+  EXPECT_EQ(output.data(), published);
+  EXPECT_NEAR(1.5, output[(height / 2u) * width + width / 2u], DEPTH_TOL);
+  EXPECT_FLOAT_EQ(viewCenter, output[(height / 2u) * width + width / 2u]);
+
+  // going back to the internal buffer
+  depthCamera->SetOutputBuffer(nullptr, 0u);
+  depthCamera->Update();
+  EXPECT_NE(output.data(), published);
+  EXPECT_EQ(2u, viewCount);
+
+  connection.reset();
+  viewConnection.reset();
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Compare the depth image and point cloud of a rasterized depth
+/// camera against the ones of the same camera casting its rays on the CPU
+TEST_F(DepthCameraTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CpuRayCasting))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  const unsigned int width = 160u;
+  const unsigned int height = 120u;
+  const double nearDist = 0.15;
+  const double farDist = 10.0;
+
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  gz::rendering::VisualPtr root = scene->RootVisual();
+
+  // a box in front of the cameras, a rotated box and a sphere next to it
+  // and a wall beyond the far clip plane
+  gz::rendering::VisualPtr box = scene->CreateVisual("box");
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(2.0, 0.0, 0.0);
+  root->AddChild(box);
+
+  gz::rendering::VisualPtr rotatedBox = scene->CreateVisual("rotated_box");
+  rotatedBox->AddGeometry(scene->CreateBox());
+  rotatedBox->SetLocalPosition(3.0, -1.5, 0.3);
+  rotatedBox->SetLocalRotation(0.3, 0.2, 0.7);
+  rotatedBox->SetLocalScale(1.0, 0.5, 1.5);
+  root->AddChild(rotatedBox);
+
+  gz::rendering::VisualPtr sphere = scene->CreateVisual("sphere");
+  sphere->AddGeometry(scene->CreateSphere());
+  sphere->SetLocalPosition(2.5, 1.2, -0.3);
+  root->AddChild(sphere);
+
+  gz::rendering::VisualPtr wall = scene->CreateVisual("wall");
+  wall->AddGeometry(scene->CreateBox());
+  wall->SetLocalPosition(farDist + 2.0, 0.0, 0.0);
+  wall->SetLocalScale(1.0, 40.0, 40.0);
+  root->AddChild(wall);
+
+  // a rasterized and a CPU ray casting camera with the same pose
+  gz::rendering::DepthCameraPtr cameras[2];
+  std::vector<float> depths[2];
+  gz::common::ConnectionPtr connections[2];
+  for (unsigned int i = 0u; i < 2u; ++i)
+  {
+    cameras[i] = scene->CreateDepthCamera(
+        "depth_camera_" + std::to_string(i));
+    ASSERT_NE(nullptr, cameras[i]);
+    cameras[i]->SetImageWidth(width);
+    cameras[i]->SetImageHeight(height);
+    cameras[i]->SetNearClipPlane(nearDist);
+    cameras[i]->SetFarClipPlane(farDist);
+    cameras[i]->SetAspectRatio(static_cast<double>(width) / height);
+    cameras[i]->SetHFOV(1.05);
+    if (i == 1u)
+      cameras[i]->SetUserData("cpu_ray_casting", true);
+    cameras[i]->CreateDepthTexture();
+    root->AddChild(cameras[i]);
+
+    depths[i].resize(width * height);
+    std::vector<float> &depth = depths[i];
+    connections[i] = cameras[i]->ConnectNewDepthFrame(
+        [&depth](const float *_data, unsigned int _width,
+                 unsigned int _height, unsigned int, const std::string &)
+        {
+          std::copy(_data, _data + _width * _height, depth.begin());
+        });
+  }
+
+  // count the pixels on which the cameras disagree, rays grazing an edge
+  // may hit in one image and miss in the other
+  const unsigned int mid = (height / 2u) * width + width / 2u;
+  auto update = [&](std::vector<float> _points[2])
+  {
+    for (unsigned int i = 0u; i < 2u; ++i)
+    {
+      cameras[i]->Update();
+      scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+      const float *data = cameras[i]->DepthData();
+      ASSERT_NE(nullptr, data);
+      _points[i].assign(data, data + width * height * 4u);
+    }
+  };
+  auto countMismatches = [&](const std::vector<float> _points[2],
+      unsigned int &_hits)
+  {
+    auto same = [](float _a, float _b, float _tol)
+    {
+      if (std::isinf(_a) || std::isinf(_b))
+        return _a == _b;
+      return std::abs(_a - _b) <= _tol;
+    };
+    unsigned int mismatches = 0u;
+    _hits = 0u;
+    for (unsigned int p = 0u; p < width * height; ++p)
+    {
+      if (std::isfinite(depths[0][p]))
+        ++_hits;
+      bool match = same(depths[0][p], depths[1][p], 0.01f);
+      for (unsigned int c = 0u; c < 3u; ++c)
+      {
+        match = match && same(_points[0][p * 4u + c], _points[1][p * 4u + c],
+            0.01f);
+      }
+      if (!match)
+        ++mismatches;
+    }
+    return mismatches;
+  };
+
+  std::vector<float> points[2];
+  update(points);
+
+  // the center pixel sees the front face of the box
+  EXPECT_NEAR(1.5, depths[0][mid], 0.01);
+  EXPECT_NEAR(1.5, depths[1][mid], 0.01);
+  EXPECT_FLOAT_EQ(depths[1][mid], points[1][mid * 4u]);
+
+  // the wall is beyond the far clip plane
+  EXPECT_FLOAT_EQ(gz::math::INF_D, depths[0][0]);
+  EXPECT_FLOAT_EQ(gz::math::INF_D, depths[1][0]);
+  EXPECT_FLOAT_EQ(gz::math::INF_D, points[1][0]);
+
+  unsigned int hits = 0u;
+  unsigned int mismatches = countMismatches(points, hits);
+  EXPECT_LT(width * height / 10u, hits);
+  EXPECT_GE(width * height / 50u, mismatches);
+
+  // a box closer than the near clip plane
+  box->SetLocalPosition(0.5 + nearDist * 0.5, 0.0, 0.0);
+  update(points);
+  EXPECT_FLOAT_EQ(-gz::math::INF_D, depths[0][mid]);
+  EXPECT_FLOAT_EQ(-gz::math::INF_D, depths[1][mid]);
+  EXPECT_FLOAT_EQ(-gz::math::INF_D, points[1][mid * 4u]);
+  mismatches = countMismatches(points, hits);
+  EXPECT_GE(width * height / 50u, mismatches);
+
+  for (auto &connection : connections)
+    connection.reset();
+  engine->DestroyScene(scene);
+}
@@ -17,6 +17,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/Image.hh>
@@ -765,6 +770,108 @@ TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SingleRay))
   engine->DestroyScene(scene);
 }
 
+/////////////////////////////////////////////////
+/// \brief Test that the frame view exposes the same data as the published
+/// scan, in the RGB layout if the readback is packed on the GPU
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(FrameView))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  const unsigned int hRayCount = 40u;
+  const unsigned int vRayCount = 4u;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  ASSERT_NE(nullptr, gpuRays);
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(10.0);
+  gpuRays->SetAngleMin(-0.5);
+  gpuRays->SetAngleMax(0.5);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalAngleMin(-0.1);
+  gpuRays->SetVerticalAngleMax(0.1);
+  gpuRays->SetVerticalRayCount(vRayCount);
+  root->AddChild(gpuRays);
+
+  VisualPtr box = scene->CreateVisual("UnitBox");
+  box->AddGeometry(scene->CreateBox());
+  box->SetWorldPosition(2.0, 0.0, 0.0);
+  root->AddChild(box);
+
+  const unsigned int channels = gpuRays->Channels();
+  std::vector<float> scan(hRayCount * vRayCount * channels);
+  common::ConnectionPtr c =
+    gpuRays->ConnectNewGpuRaysFrame(
+        std::bind(&::OnNewGpuRaysFrame, scan.data(),
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+
+  // copy of the range values seen through the view
+  std::vector<float> viewRanges;
+  common::ConnectionPtr viewConnection =
+    gpuRays->ConnectNewFrameView(
+        [&](const FrameView &_view)
+        {
+          ASSERT_TRUE(_view.Valid());
+          ASSERT_TRUE(_view.format == PF_FLOAT32_RGB ||
+                      _view.format == PF_FLOAT32_RGBA);
+          const unsigned int viewChannels =
+              PixelUtil::ChannelCount(_view.format);
+          viewRanges.clear();
+          for (unsigned int y = 0; y < _view.height; ++y)
+          {
+            const float *row = reinterpret_cast<const float *>(
+                static_cast<const unsigned char *>(_view.data) +
+                y * _view.rowPitch);
+            for (unsigned int x = 0; x < _view.width; ++x)
+              viewRanges.push_back(row[x * viewChannels]);
+          }
+        });
+
+  gpuRays->Update();
+
+  ASSERT_EQ(hRayCount * vRayCount, viewRanges.size());
+  for (unsigned int i = 0; i < hRayCount * vRayCount; ++i)
+    EXPECT_FLOAT_EQ(scan[i * channels], viewRanges[i]);
+
+  // the middle ray hits the box
+  const unsigned int mid = (vRayCount / 2u) * hRayCount + hRayCount / 2u;
+  EXPECT_NEAR(1.5, scan[mid * channels], 0.01);
+
+  // the scan is written straight into a subscriber supplied buffer
+  std::vector<float> output(scan.size(), 0.0f);
+  gpuRays->SetOutputBuffer(output.data(), output.size() * sizeof(float));
+  const float *published = nullptr;
+  common::ConnectionPtr outputConnection =
+    gpuRays->ConnectNewGpuRaysFrame(
+        [&published](const float *_data, unsigned int, unsigned int,
+                     unsigned int, const std::string &)
+        {
+          published = _data;
+        });
+  gpuRays->Update();
+  EXPECT_EQ(output.data(), published);
+  EXPECT_EQ(output.data(), gpuRays->Data());
+  EXPECT_NEAR(1.5, output[mid * channels], 0.01);
+
+  // the latest scan stays readable once the buffer is replaced and released
+  gpuRays->SetOutputBuffer(nullptr, 0u);
+  std::fill(output.begin(), output.end(), 0.0f);
+  ASSERT_NE(output.data(), gpuRays->Data());
+  EXPECT_NEAR(1.5, gpuRays->Data()[mid * channels], 0.01);
+
+  outputConnection.reset();
+  viewConnection.reset();
+  c.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
 /////////////////////////////////////////////////
 TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Visibility))
 {
@@ -1021,3 +1128,298 @@ TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Heightmap))
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+/// \brief Compare the ranges of rasterized gpu rays against the ones of
+/// the same sensor casting its rays on the CPU
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CpuRayCasting))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  #ifdef __APPLE__
+    GTEST_SKIP() << "Unsupported on apple, see issue #35.";
+  #endif
+
+  const double hMinAngle = -GZ_PI/2.0;
+  const double hMaxAngle = GZ_PI/2.0;
+  const double vMinAngle = -GZ_PI/8.0;
+  const double vMaxAngle = GZ_PI/8.0;
+  const double minRange = 0.1;
+  const double maxRange = 10.0;
+  const int hRayCount = 320;
+  // odd so that the middle row is horizontal
+  const int vRayCount = 15;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  // Create a rasterized and a CPU ray caster with the same pose
+  math::Pose3d testPose(math::Vector3d(0, 0, 0.5),
+      math::Quaterniond::Identity);
+
+  GpuRaysPtr gpuRays[2];
+  for (unsigned int i = 0u; i < 2u; ++i)
+  {
+    gpuRays[i] = scene->CreateGpuRays("gpu_rays_" + std::to_string(i));
+    gpuRays[i]->SetWorldPosition(testPose.Pos());
+    gpuRays[i]->SetWorldRotation(testPose.Rot());
+    gpuRays[i]->SetNearClipPlane(minRange);
+    gpuRays[i]->SetFarClipPlane(maxRange);
+    gpuRays[i]->SetAngleMin(hMinAngle);
+    gpuRays[i]->SetAngleMax(hMaxAngle);
+    gpuRays[i]->SetRayCount(hRayCount);
+    gpuRays[i]->SetVerticalAngleMin(vMinAngle);
+    gpuRays[i]->SetVerticalAngleMax(vMaxAngle);
+    gpuRays[i]->SetVerticalRayCount(vRayCount);
+    root->AddChild(gpuRays[i]);
+  }
+  gpuRays[1]->SetUserData("cpu_ray_casting", true);
+
+  // Create a box in front, a rotated box on the right and a sphere on the
+  // left of the ray casters
+  const double laserRetro = 1500;
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(3, 0, 0.5);
+  visualBox1->SetUserData("laser_retro", laserRetro);
+  root->AddChild(visualBox1);
+
+  VisualPtr visualBox2 = scene->CreateVisual("UnitBox2");
+  visualBox2->AddGeometry(scene->CreateBox());
+  visualBox2->SetWorldPosition(1, -4, 0.5);
+  visualBox2->SetWorldRotation(0.3, 0.2, 0.7);
+  visualBox2->SetLocalScale(2, 1, 1.5);
+  root->AddChild(visualBox2);
+
+  VisualPtr visualSphere = scene->CreateVisual("Sphere");
+  visualSphere->AddGeometry(scene->CreateSphere());
+  visualSphere->SetWorldPosition(2, 3, 0.5);
+  visualSphere->SetLocalScale(1.5);
+  root->AddChild(visualSphere);
+
+  const unsigned int channels = gpuRays[0]->Channels();
+  const unsigned int size = hRayCount * vRayCount * channels;
+  std::vector<float> scans[2];
+  for (unsigned int i = 0u; i < 2u; ++i)
+  {
+    scans[i].resize(size);
+    gpuRays[i]->Update();
+    scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+    gpuRays[i]->Copy(scans[i].data());
+  }
+
+  // the center ray sees the front face of the box
+  const unsigned int mid = (static_cast<unsigned int>(vRayCount/2) *
+      hRayCount + static_cast<unsigned int>(hRayCount/2)) * channels;
+  EXPECT_NEAR(scans[1][mid], 2.5, LASER_TOL);
+  EXPECT_NEAR(scans[1][mid + 1], laserRetro, 5.0);
+
+  // rays grazing an edge may hit in one scan and miss in the other, the
+  // others must agree
+  unsigned int hits = 0u;
+  unsigned int mismatches = 0u;
+  for (unsigned int i = 0u; i < size; i += channels)
+  {
+    const float gpuRange = scans[0][i];
+    const float cpuRange = scans[1][i];
+    if (std::isinf(gpuRange) && std::isinf(cpuRange))
+      continue;
+
+    ++hits;
+    if (std::abs(gpuRange - cpuRange) > 0.05f ||
+        std::abs(scans[0][i + 1] - scans[1][i + 1]) > 5.0f)
+    {
+      ++mismatches;
+    }
+  }
+  EXPECT_LT(0u, hits);
+  EXPECT_GE(hits / 50u, mismatches);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test co-located gpu rays sharing their cubemap
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SharedCubemap))
+{
+  #ifdef __APPLE__
+    GTEST_SKIP() << "Unsupported on apple, see issue #35.";
+  #endif
+
+  const double hMinAngle = -GZ_PI/2.0;
+  const double hMaxAngle = GZ_PI/2.0;
+  const double minRange = 0.1;
+  const double maxRange = 10.0;
+  // odd so that the middle ray points straight ahead
+  const int hRayCounts[3] = {101, 201, 151};
+  const int vRayCount = 1;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  // Ray casters at the same pose with different resolutions
+  math::Pose3d testPose(math::Vector3d(0, 0, 0.1),
+      math::Quaterniond::Identity);
+
+  GpuRaysPtr gpuRays[3];
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    gpuRays[i] = scene->CreateGpuRays("gpu_rays_" + std::to_string(i));
+    gpuRays[i]->SetWorldPosition(testPose.Pos());
+    gpuRays[i]->SetWorldRotation(testPose.Rot());
+    gpuRays[i]->SetNearClipPlane(minRange);
+    gpuRays[i]->SetFarClipPlane(maxRange);
+    gpuRays[i]->SetAngleMin(hMinAngle);
+    gpuRays[i]->SetAngleMax(hMaxAngle);
+    gpuRays[i]->SetRayCount(hRayCounts[i]);
+    gpuRays[i]->SetVerticalRayCount(vRayCount);
+    root->AddChild(gpuRays[i]);
+  }
+
+  // box in front and box on the right of the ray casters
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(3, 0, 0.5);
+  root->AddChild(visualBox1);
+
+  VisualPtr visualBox2 = scene->CreateVisual("UnitBox2");
+  visualBox2->AddGeometry(scene->CreateBox());
+  visualBox2->SetWorldPosition(0, -5, 0.5);
+  root->AddChild(visualBox2);
+
+  // all the sensors are updated in the same frame
+  std::vector<float> scans[3];
+  for (unsigned int i = 0u; i < 3u; ++i)
+    scans[i].resize(hRayCounts[i] * vRayCount * gpuRays[i]->Channels());
+
+  auto updateAll = [&]()
+  {
+    scene->PreRender();
+    for (unsigned int i = 0u; i < 3u; ++i)
+    {
+      gpuRays[i]->Render();
+      gpuRays[i]->PostRender();
+    }
+    scene->PostRender();
+    for (unsigned int i = 0u; i < 3u; ++i)
+      gpuRays[i]->Copy(scans[i].data());
+    scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+    return scene->DrawnInstanceCount();
+  };
+  const unsigned int sharedInstanceCount = updateAll();
+
+  int mid[3];
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    const unsigned int channels = gpuRays[i]->Channels();
+    mid[i] = static_cast<int>(hRayCounts[i]/2) * channels;
+    const int last = (hRayCounts[i] - 1) * channels;
+    EXPECT_NEAR(scans[i][mid[i]], 2.5, LASER_TOL);
+    EXPECT_NEAR(scans[i][0], 4.5, LASER_TOL);
+    EXPECT_FLOAT_EQ(scans[i][last], math::INF_F);
+  }
+
+  // move the last sensor away, it stops sharing the cubemap
+  gpuRays[2]->SetWorldPosition(1, 0, 0.1);
+  const unsigned int unsharedInstanceCount = updateAll();
+  EXPECT_NEAR(scans[0][mid[0]], 2.5, LASER_TOL);
+  EXPECT_NEAR(scans[1][mid[1]], 2.5, LASER_TOL);
+  EXPECT_NEAR(scans[2][mid[2]], 1.5, LASER_TOL);
+
+  // the faces of the shared cubemap were only rendered once, the moved
+  // sensor now renders the scene into a cubemap of its own
+  if (engine->Name() == "ogre2")
+    EXPECT_LT(sharedInstanceCount, unsharedInstanceCount);
+
+  // destroying the sensor owning the cubemap hands it over to the other one
+  scene->DestroySensor(gpuRays[0]);
+  gpuRays[1]->Update();
+  scene->SetTime(scene->Time() + std::chrono::milliseconds(16));
+  gpuRays[1]->Copy(scans[1].data());
+  EXPECT_NEAR(scans[1][mid[1]], 2.5, LASER_TOL);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+/// \brief Test sensors sampling the same rays from different poses
+TEST_F(GpuRaysTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SharedSampleTexture))
+{
+  #ifdef __APPLE__
+    GTEST_SKIP() << "Unsupported on apple, see issue #35.";
+  #endif
+
+  const double hMinAngle = -GZ_PI/2.0;
+  const double hMaxAngle = GZ_PI/2.0;
+  const double minRange = 0.1;
+  const double maxRange = 10.0;
+  const int hRayCount = 320;
+  const int vRayCount = 1;
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+
+  auto createGpuRays = [&](const std::string &_name, double _x)
+  {
+    GpuRaysPtr gpuRays = scene->CreateGpuRays(_name);
+    gpuRays->SetWorldPosition(_x, 0, 0.1);
+    gpuRays->SetNearClipPlane(minRange);
+    gpuRays->SetFarClipPlane(maxRange);
+    gpuRays->SetAngleMin(hMinAngle);
+    gpuRays->SetAngleMax(hMaxAngle);
+    gpuRays->SetRayCount(hRayCount);
+    gpuRays->SetVerticalRayCount(vRayCount);
+    root->AddChild(gpuRays);
+    return gpuRays;
+  };
+
+  // identical ray casters at different poses, they do not share the
+  // cubemap but share the sampling texture
+  GpuRaysPtr gpuRays1 = createGpuRays("gpu_rays_1", 0);
+  GpuRaysPtr gpuRays2 = createGpuRays("gpu_rays_2", 1);
+
+  // box in front of the ray casters
+  VisualPtr visualBox1 = scene->CreateVisual("UnitBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(3, 0, 0.5);
+  root->AddChild(visualBox1);
+
+  const unsigned int channels = gpuRays1->Channels();
+  const int mid = static_cast<int>(hRayCount/2) * channels;
+  const int last = (hRayCount - 1) * channels;
+  std::vector<float> scan1(hRayCount * vRayCount * channels);
+  std::vector<float> scan2(hRayCount * vRayCount * channels);
+
+  gpuRays1->Update();
+  gpuRays2->Update();
+  gpuRays1->Copy(scan1.data());
+  gpuRays2->Copy(scan2.data());
+  EXPECT_NEAR(scan1[mid], 2.5, LASER_TOL);
+  EXPECT_NEAR(scan2[mid], 1.5, LASER_TOL);
+  EXPECT_FLOAT_EQ(scan1[0], math::INF_F);
+  EXPECT_FLOAT_EQ(scan2[last], math::INF_F);
+
+  // the texture outlives the sensor that created it and is reused by a new
+  // identical sensor
+  scene->DestroySensor(gpuRays1);
+  GpuRaysPtr gpuRays3 = createGpuRays("gpu_rays_3", 0);
+  gpuRays2->Update();
+  gpuRays3->Update();
+  gpuRays2->Copy(scan2.data());
+  gpuRays3->Copy(scan1.data());
+  EXPECT_NEAR(scan1[mid], 2.5, LASER_TOL);
+  EXPECT_NEAR(scan2[mid], 1.5, LASER_TOL);
+  EXPECT_FLOAT_EQ(scan1[0], math::INF_F);
+  EXPECT_FLOAT_EQ(scan2[last], math::INF_F);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
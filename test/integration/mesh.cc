@@ -17,8 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <string>
 #include <memory>
+#include <thread>
 
 #include "CommonRenderingTest.hh"
 
@@ -37,6 +39,60 @@ using namespace rendering;
 
 class MeshTest: public CommonRenderingTest
 {
+  /// \brief Create a scene with a blue background and a red visual of a
+  /// mesh at the origin
+  /// \param[in] _descriptor Descriptor of the mesh
+  /// \param[out] _meshGeom Mesh created from the descriptor
+  /// \return Scene
+  protected: ScenePtr CreateRedMeshScene(const MeshDescriptor &_descriptor,
+      MeshPtr &_meshGeom)
+  {
+    ScenePtr scene = this->engine->CreateScene("scene");
+    if (!scene)
+      return scene;
+    scene->SetAmbientLight(1.0, 1.0, 1.0);
+    scene->SetBackgroundColor(0.0, 0.0, 1.0);
+
+    _meshGeom = scene->CreateMesh(_descriptor);
+    if (!_meshGeom)
+      return scene;
+
+    MaterialPtr material = scene->CreateMaterial();
+    material->SetAmbient(1.0, 0.0, 0.0);
+    material->SetDiffuse(1.0, 0.0, 0.0);
+    material->SetEmissive(1.0, 0.0, 0.0);
+
+    VisualPtr visual = scene->CreateVisual("visual");
+    visual->AddGeometry(_meshGeom);
+    visual->SetMaterial(material);
+    scene->RootVisual()->AddChild(visual);
+    return scene;
+  }
+
+  /// \brief Capture an image with a camera and check that it sees the red
+  /// mesh of CreateRedMeshScene
+  /// \param[in] _camera Camera
+  /// \param[in] _centerOnly Check the center pixel only, otherwise the mesh
+  /// must fill the whole image
+  protected: void ExpectRed(CameraPtr _camera, bool _centerOnly)
+  {
+    Image image = _camera->CreateImage();
+    _camera->Capture(image);
+
+    const unsigned int channelCount =
+        PixelUtil::ChannelCount(_camera->ImageFormat());
+    const unsigned int width = _camera->ImageWidth();
+    const unsigned int height = _camera->ImageHeight();
+    const unsigned char *data = image.Data<unsigned char>();
+    const unsigned int center = (height / 2u) * width + width / 2u;
+    const unsigned int begin = _centerOnly ? center : 0u;
+    const unsigned int end = _centerOnly ? center + 1u : width * height;
+    for (unsigned int i = begin; i < end; ++i)
+    {
+      EXPECT_GT(data[i * channelCount], 0u);
+      EXPECT_EQ(data[i * channelCount + 2], 0u);
+    }
+  }
 };
 
 /////////////////////////////////////////////////
@@ -188,3 +244,230 @@ TEST_F(MeshTest, NormalMapWithoutTexCoord)
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, LargeMesh)
+{
+  // Create a grid mesh with more vertices than 16 bit indices can address
+  // and verify that all of it is rendered
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  scene->SetBackgroundColor(0.0, 0.0, 1.0);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  const unsigned int gridSize = 300u;
+  common::Mesh mesh;
+  common::SubMesh subMesh;
+  subMesh.SetName("grid");
+  for (unsigned int i = 0u; i < gridSize; ++i)
+  {
+    for (unsigned int j = 0u; j < gridSize; ++j)
+    {
+      const double x = static_cast<double>(i) / (gridSize - 1u);
+      const double y = static_cast<double>(j) / (gridSize - 1u);
+      subMesh.AddVertex(math::Vector3d(x, y, 0));
+      subMesh.AddNormal(math::Vector3d(0, 0, 1));
+      subMesh.AddTexCoordBySet(math::Vector2d(x, y), 0);
+    }
+  }
+  for (unsigned int i = 0u; i + 1u < gridSize; ++i)
+  {
+    for (unsigned int j = 0u; j + 1u < gridSize; ++j)
+    {
+      const unsigned int v = i * gridSize + j;
+      subMesh.AddIndex(v);
+      subMesh.AddIndex(v + gridSize);
+      subMesh.AddIndex(v + gridSize + 1u);
+      subMesh.AddIndex(v);
+      subMesh.AddIndex(v + gridSize + 1u);
+      subMesh.AddIndex(v + 1u);
+    }
+  }
+  ASSERT_GT(subMesh.VertexCount(), 0xFFFFu);
+  mesh.AddSubMesh(subMesh);
+
+  MeshDescriptor descriptor;
+  descriptor.meshName = "large_mesh";
+  descriptor.mesh = &mesh;
+  descriptor.centerSubMesh = true;
+  MeshPtr meshGeom = scene->CreateMesh(descriptor);
+  ASSERT_NE(nullptr, meshGeom);
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(1.0, 0.0, 0.0);
+  material->SetDiffuse(1.0, 0.0, 0.0);
+  material->SetEmissive(1.0, 0.0, 0.0);
+
+  VisualPtr visual = scene->CreateVisual("visual");
+  visual->AddGeometry(meshGeom);
+  visual->SetMaterial(material);
+  root->AddChild(visual);
+
+  // the centered grid fills the view of the camera looking down on it
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetLocalPosition(0.0, 0.0, 0.4);
+  camera->SetLocalRotation(0, 1.57, 0);
+  camera->SetImageWidth(32);
+  camera->SetImageHeight(32);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+
+  unsigned int channelCount = PixelUtil::ChannelCount(camera->ImageFormat());
+  unsigned int size = camera->ImageWidth() * camera->ImageHeight();
+  unsigned char *data = image.Data<unsigned char>();
+  for (unsigned int i = 0; i < size; ++i)
+  {
+    EXPECT_GT(data[i * channelCount], 0u);
+    EXPECT_EQ(data[i * channelCount + 2], 0u);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, CompressVertices)
+{
+  // Create a box with compressed vertices and verify that it is rendered
+  // where the uncompressed one would be
+  MeshDescriptor descriptor("unit_box");
+  descriptor.Load();
+  descriptor.compressVertices = true;
+  MeshPtr meshGeom;
+  ScenePtr scene = this->CreateRedMeshScene(descriptor, meshGeom);
+  ASSERT_NE(nullptr, scene);
+  ASSERT_NE(nullptr, meshGeom);
+  EXPECT_TRUE(meshGeom->Descriptor().compressVertices);
+  EXPECT_EQ(1u, meshGeom->SubMeshCount());
+
+  // the box fills the view of the camera right above its top face
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetLocalPosition(0.0, 0.0, 0.8);
+  camera->SetLocalRotation(0, 1.57, 0);
+  camera->SetImageWidth(32);
+  camera->SetImageHeight(32);
+  scene->RootVisual()->AddChild(camera);
+  this->ExpectRed(camera, false);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, LodLevels)
+{
+  // Create a sphere with simplified levels of detail and verify that it is
+  // rendered by a camera close to it and by a camera that tolerates a large
+  // error, which should pick a coarse level
+  MeshDescriptor descriptor("unit_sphere");
+  descriptor.Load();
+  descriptor.lodLevels = 3u;
+  MeshPtr meshGeom;
+  ScenePtr scene = this->CreateRedMeshScene(descriptor, meshGeom);
+  ASSERT_NE(nullptr, scene);
+  ASSERT_NE(nullptr, meshGeom);
+  EXPECT_EQ(3u, meshGeom->Descriptor().lodLevels);
+
+  for (bool coarse : {false, true})
+  {
+    CameraPtr camera = scene->CreateCamera();
+    ASSERT_NE(nullptr, camera);
+    camera->SetLocalPosition(-3.0, 0.0, 0.0);
+    camera->SetImageWidth(32);
+    camera->SetImageHeight(32);
+    if (coarse)
+      camera->SetUserData("lod_pixel_error", 100.0);
+    scene->RootVisual()->AddChild(camera);
+
+    // the center of the sphere is red whatever the level
+    this->ExpectRed(camera, true);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshTest, CreateMeshAsync)
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  scene->SetBackgroundColor(0.0, 0.0, 1.0);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  common::Mesh mesh;
+  common::SubMesh subMesh;
+  subMesh.SetName("quad");
+  subMesh.AddVertex(math::Vector3d(-1, -1, 0));
+  subMesh.AddVertex(math::Vector3d(1, -1, 0));
+  subMesh.AddVertex(math::Vector3d(1, 1, 0));
+  subMesh.AddVertex(math::Vector3d(-1, 1, 0));
+  for (unsigned int i = 0u; i < 4u; ++i)
+    subMesh.AddNormal(math::Vector3d(0, 0, 1));
+  for (unsigned int index : {0u, 1u, 2u, 0u, 2u, 3u})
+    subMesh.AddIndex(index);
+  mesh.AddSubMesh(subMesh);
+
+  MeshDescriptor descriptor;
+  descriptor.meshName = "async_mesh";
+  descriptor.mesh = &mesh;
+  MeshPtr meshGeom = scene->CreateMeshAsync(descriptor);
+  ASSERT_NE(nullptr, meshGeom);
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(1.0, 0.0, 0.0);
+  material->SetDiffuse(1.0, 0.0, 0.0);
+  material->SetEmissive(1.0, 0.0, 0.0);
+
+  // the material set on the placeholder is kept once the mesh is loaded
+  VisualPtr visual = scene->CreateVisual("visual");
+  visual->AddGeometry(meshGeom);
+  visual->SetMaterial(material);
+  root->AddChild(visual);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetLocalPosition(0.0, 0.0, 0.5);
+  camera->SetLocalRotation(0, 1.57, 0);
+  camera->SetImageWidth(32);
+  camera->SetImageHeight(32);
+  root->AddChild(camera);
+
+  for (unsigned int i = 0u; i < 500u && !meshGeom->IsLoaded(); ++i)
+  {
+    camera->Update();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_TRUE(meshGeom->IsLoaded());
+  EXPECT_EQ(1u, meshGeom->SubMeshCount());
+
+  // the same mesh is created loaded now
+  MeshPtr meshGeom2 = scene->CreateMeshAsync(descriptor);
+  ASSERT_NE(nullptr, meshGeom2);
+  EXPECT_TRUE(meshGeom2->IsLoaded());
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+
+  unsigned int channelCount = PixelUtil::ChannelCount(camera->ImageFormat());
+  unsigned int size = camera->ImageWidth() * camera->ImageHeight();
+  unsigned char *data = image.Data<unsigned char>();
+  for (unsigned int i = 0; i < size; ++i)
+  {
+    EXPECT_GT(data[i * channelCount], 0u);
+    EXPECT_EQ(data[i * channelCount + 2], 0u);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -189,3 +189,50 @@ TEST_F(SceneTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(VisualAt))
   // Clean up
   engine->DestroyScene(scene);
 }
+
+/////////////////////////////////////////////////
+TEST_F(SceneTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(InstancedDraws))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  VisualPtr root = scene->RootVisual();
+  ASSERT_NE(nullptr, root);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(320);
+  camera->SetImageHeight(240);
+  camera->SetHFOV(GZ_PI / 2);
+  root->AddChild(camera);
+
+  // a wall of boxes sharing the same mesh and material in front of the camera
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(0.7, 0.2, 0.2);
+  const unsigned int side = 10u;
+  for (unsigned int i = 0u; i < side; ++i)
+  {
+    for (unsigned int j = 0u; j < side; ++j)
+    {
+      VisualPtr box = scene->CreateVisual();
+      box->AddGeometry(scene->CreateBox());
+      box->SetLocalPosition(8.0, i - side * 0.5, j - side * 0.5);
+      box->SetLocalScale(0.5, 0.5, 0.5);
+      box->SetMaterial(material);
+      root->AddChild(box);
+    }
+  }
+
+  camera->Update();
+  camera->Update();
+
+  // every box is drawn, batched into far fewer instanced draw calls
+  EXPECT_GE(scene->DrawnInstanceCount(), side * side);
+  EXPECT_GT(scene->DrawCallCount(), 0u);
+  EXPECT_LT(scene->DrawCallCount(), side * side / 4u);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
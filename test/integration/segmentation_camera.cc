@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/Filesystem.hh>
@@ -215,6 +218,44 @@ TEST_F(SegmentationCameraTest, SegmentationCameraBoxes)
   EXPECT_EQ(1, rightCount);
   EXPECT_EQ(2, leftCount);
 
+  // without colored map the label map is the rendered map
+  const unsigned int bufferSize = width * height * 3;
+  std::vector<uint8_t> labelMap(g_buffer, g_buffer + bufferSize);
+  std::vector<uint8_t> decodedMap(bufferSize, 0u);
+  camera->LabelMapFromColoredBuffer(decodedMap.data());
+  EXPECT_EQ(labelMap, decodedMap);
+
+  // decoding the colored map gives back the same label map
+  camera->EnableColoredMap(true);
+  g_counter = 0;
+  camera->Update();
+  EXPECT_EQ(1, g_counter);
+  camera->LabelMapFromColoredBuffer(decodedMap.data());
+  EXPECT_EQ(labelMap, decodedMap);
+
+  // and again once the color to label table is cached
+  camera->Update();
+  std::fill(decodedMap.begin(), decodedMap.end(), 0u);
+  camera->LabelMapFromColoredBuffer(decodedMap.data());
+  EXPECT_EQ(labelMap, decodedMap);
+
+  // the colored map is written straight into a subscriber supplied buffer
+  // and decoded from there
+  std::vector<uint8_t> output(bufferSize, 0u);
+  camera->SetOutputBuffer(output.data(), output.size());
+  camera->Update();
+  EXPECT_EQ(std::vector<uint8_t>(g_buffer, g_buffer + bufferSize), output);
+  std::fill(decodedMap.begin(), decodedMap.end(), 0u);
+  camera->LabelMapFromColoredBuffer(decodedMap.data());
+  EXPECT_EQ(labelMap, decodedMap);
+
+  // the latest map can still be decoded once the buffer is released
+  camera->SetOutputBuffer(nullptr, 0u);
+  std::fill(output.begin(), output.end(), 0u);
+  std::fill(decodedMap.begin(), decodedMap.end(), 0u);
+  camera->LabelMapFromColoredBuffer(decodedMap.data());
+  EXPECT_EQ(labelMap, decodedMap);
+
   // Clean up
   engine->DestroyScene(scene);
 }
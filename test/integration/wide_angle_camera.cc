@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "CommonRenderingTest.hh"
 
 #include <gz/common/Filesystem.hh>
@@ -606,3 +609,81 @@ TEST_F(WideAngleCameraTest,
   g_bufferL16 = nullptr;
   engine->DestroyScene(scene);
 }
+
+//////////////////////////////////////////////////
+TEST_F(WideAngleCameraTest,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(StaticFaceCaching))
+{
+  gz::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  scene->SetBackgroundColor(0.2, 0.2, 0.2);
+
+  rendering::VisualPtr root = scene->RootVisual();
+
+  const unsigned int width = 64u;
+  const unsigned int height = 64u;
+
+  // 180 degrees fisheye camera, the face behind it is not rendered
+  auto camera = scene->CreateWideAngleCamera("WideAngleCamera");
+  ASSERT_NE(camera, nullptr);
+  EXPECT_FALSE(camera->StaticFaceCaching());
+  camera->SetStaticFaceCaching(true);
+  EXPECT_TRUE(camera->StaticFaceCaching());
+
+  CameraLens lens;
+  lens.SetType(MFT_EQUIDISTANT);
+  lens.SetScaleToHFOV(true);
+  lens.SetCutOffAngle(GZ_PI / 2.0);
+  camera->SetLens(lens);
+  camera->SetHFOV(GZ_PI);
+  camera->SetImageWidth(width);
+  camera->SetImageHeight(height);
+  camera->SetImageFormat(PF_R8G8B8);
+  root->AddChild(camera);
+
+  // create blue material
+  MaterialPtr blue = scene->CreateMaterial();
+  blue->SetAmbient(0.0, 0.0, 0.3);
+  blue->SetDiffuse(0.0, 0.0, 0.8);
+
+  // create box visual in front of the camera
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(2, 0, 0);
+  box->SetMaterial(blue);
+  root->AddChild(box);
+
+  const unsigned int mid = (height / 2u * width + width / 2u) * 3u;
+  Image image = camera->CreateImage();
+  camera->Update();
+  camera->Copy(image);
+  const std::vector<unsigned char> first(image.Data<unsigned char>(),
+      image.Data<unsigned char>() + width * height * 3u);
+  EXPECT_GT(first[mid + 2], first[mid]);
+
+  // nothing changed, the cached faces give the same image
+  camera->Update();
+  camera->Copy(image);
+  EXPECT_TRUE(std::equal(first.begin(), first.end(),
+      image.Data<unsigned char>()));
+
+  // moving the box out of the view is seen
+  box->SetLocalPosition(2, 5, 0);
+  camera->Update();
+  camera->Copy(image);
+  const unsigned char *moved = image.Data<unsigned char>();
+  EXPECT_EQ(moved[mid], moved[mid + 2]);
+
+  // turning the camera is seen
+  box->SetLocalPosition(0, 2, 0);
+  camera->Update();
+  camera->SetLocalRotation(0, 0, GZ_PI / 2.0);
+  camera->Update();
+  camera->Copy(image);
+  const unsigned char *turned = image.Data<unsigned char>();
+  EXPECT_GT(turned[mid + 2], turned[mid]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CommonRenderingTest.hh"
+
+#include <gz/common/Filesystem.hh>
+#include <gz/common/Mesh.hh>
+#include <gz/common/SubMesh.hh>
+#include <gz/common/TempDirectory.hh>
+
+#include "gz/rendering/Camera.hh"
+#include "gz/rendering/Mesh.hh"
+#include "gz/rendering/Scene.hh"
+
+#include <gz/utils/ExtraTestMacros.hh>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Time to load many unique meshes, with CreateMesh on the render
+/// thread and with CreateMeshAsync, which packs the meshes on worker
+/// threads. Compare the ms reported by both tests. RenderCompressed
+/// compares the time to render the meshes with and without compressed
+/// vertices.
+class MeshLoadTest: public CommonRenderingTest
+{
+  /// \brief Create the unique meshes to load
+  /// \param[in] _prefix Prefix of the mesh names, unique per test
+  /// \param[in] _compress Whether to compress the vertices of the meshes
+  public: void CreateMeshes(const std::string &_prefix,
+      bool _compress = false);
+
+  /// \brief Report the result of a test
+  /// \param[in] _path Name of the loading path
+  /// \param[in] _ms Time taken to load all the meshes
+  /// \param[in] _frames Number of frames rendered while loading
+  public: void Report(const std::string &_path, double _ms,
+      unsigned int _frames);
+
+  /// \brief Number of unique meshes
+  public: const unsigned int meshCount = 200u;
+
+  /// \brief Number of vertices along the side of each grid mesh
+  public: const unsigned int gridSize = 100u;
+
+  /// \brief Meshes to load
+  public: std::vector<std::unique_ptr<common::Mesh>> meshes;
+
+  /// \brief Descriptors of the meshes to load
+  public: std::vector<MeshDescriptor> descriptors;
+};
+
+/////////////////////////////////////////////////
+void MeshLoadTest::CreateMeshes(const std::string &_prefix,
+    bool _compress)
+{
+  // the on-disk mesh cache keys meshes by the file they were loaded from.
+  // Name every mesh after a source file, as common::MeshManager does, and
+  // share the files between the tests so that later tests read the entries
+  // earlier ones wrote.
+  static common::TempDirectory sourceDir("mesh_load", "gz_rendering", true);
+
+  for (unsigned int m = 0u; m < this->meshCount; ++m)
+  {
+    const std::string source = common::joinPaths(sourceDir.Path(),
+        "grid_" + std::to_string(m) + ".obj");
+    if (!common::isFile(source))
+      std::ofstream(source) << "# mesh_load grid " << m << std::endl;
+
+    auto mesh = std::make_unique<common::Mesh>();
+    mesh->SetName(source);
+    common::SubMesh subMesh;
+    for (unsigned int i = 0u; i < this->gridSize; ++i)
+    {
+      for (unsigned int j = 0u; j < this->gridSize; ++j)
+      {
+        const double x = static_cast<double>(i) / this->gridSize;
+        const double y = static_cast<double>(j) / this->gridSize;
+        subMesh.AddVertex(math::Vector3d(x, y, 0.01 * m));
+        subMesh.AddNormal(math::Vector3d(0, 0, 1));
+        subMesh.AddTexCoordBySet(math::Vector2d(x, y), 0);
+      }
+    }
+    for (unsigned int i = 0u; i + 1u < this->gridSize; ++i)
+    {
+      for (unsigned int j = 0u; j + 1u < this->gridSize; ++j)
+      {
+        const unsigned int v = i * this->gridSize + j;
+        subMesh.AddIndex(v);
+        subMesh.AddIndex(v + this->gridSize);
+        subMesh.AddIndex(v + this->gridSize + 1u);
+        subMesh.AddIndex(v);
+        subMesh.AddIndex(v + this->gridSize + 1u);
+        subMesh.AddIndex(v + 1u);
+      }
+    }
+    mesh->AddSubMesh(subMesh);
+
+    MeshDescriptor descriptor;
+    descriptor.meshName = _prefix + std::to_string(m);
+    descriptor.mesh = mesh.get();
+    descriptor.compressVertices = _compress;
+    this->descriptors.push_back(descriptor);
+    this->meshes.push_back(std::move(mesh));
+  }
+}
+
+/////////////////////////////////////////////////
+void MeshLoadTest::Report(const std::string &_path, double _ms,
+    unsigned int _frames)
+{
+  gzdbg << "Path[" << _path << "] Meshes[" << this->meshCount << "] "
+    << "VerticesPerMesh[" << this->gridSize * this->gridSize << "] "
+    << "Ms[" << _ms << "] Frames[" << _frames << "]" << std::endl;
+  RecordProperty(_path + "_ms", std::to_string(_ms));
+  RecordProperty(_path + "_frames", std::to_string(_frames));
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshLoadTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CreateMesh))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  scene->RootVisual()->AddChild(camera);
+  this->CreateMeshes("mesh_load_sync_");
+
+  auto start = std::chrono::steady_clock::now();
+  for (const MeshDescriptor &descriptor : this->descriptors)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateMesh(descriptor));
+    scene->RootVisual()->AddChild(visual);
+  }
+  camera->Update();
+  auto end = std::chrono::steady_clock::now();
+
+  this->Report("sync",
+      std::chrono::duration<double, std::milli>(end - start).count(), 1u);
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshLoadTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(CreateMeshAsync))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  scene->RootVisual()->AddChild(camera);
+  this->CreateMeshes("mesh_load_async_");
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<MeshPtr> loading;
+  for (const MeshDescriptor &descriptor : this->descriptors)
+  {
+    MeshPtr mesh = scene->CreateMeshAsync(descriptor);
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(mesh);
+    scene->RootVisual()->AddChild(visual);
+    loading.push_back(mesh);
+  }
+  auto submitted = std::chrono::steady_clock::now();
+
+  // render frames until every placeholder is replaced
+  unsigned int frames = 0u;
+  while (!loading.empty() && frames < 100000u)
+  {
+    camera->Update();
+    ++frames;
+    loading.erase(std::remove_if(loading.begin(), loading.end(),
+        [](const MeshPtr &_mesh)
+        {
+          return _mesh->IsLoaded();
+        }), loading.end());
+  }
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_TRUE(loading.empty());
+
+  const double blockedMs =
+      std::chrono::duration<double, std::milli>(submitted - start).count();
+  gzdbg << "Path[async] RenderThreadBlockedMs[" << blockedMs << "]"
+    << std::endl;
+  RecordProperty("async_blocked_ms", std::to_string(blockedMs));
+  this->Report("async",
+      std::chrono::duration<double, std::milli>(end - start).count(), frames);
+
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshLoadTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(RenderCompressed))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  const unsigned int frameCount = 100u;
+  for (bool compress : {false, true})
+  {
+    ScenePtr scene = engine->CreateScene("scene");
+    ASSERT_NE(nullptr, scene);
+    CameraPtr camera = scene->CreateCamera();
+    ASSERT_NE(nullptr, camera);
+    camera->SetImageWidth(1024);
+    camera->SetImageHeight(1024);
+    camera->SetLocalPosition(0.5, 0.5, 4.0);
+    camera->SetLocalRotation(0, 1.57, 0);
+    scene->RootVisual()->AddChild(camera);
+    this->meshes.clear();
+    this->descriptors.clear();
+    this->CreateMeshes(compress ? "mesh_load_compressed_" :
+        "mesh_load_uncompressed_", compress);
+
+    auto start = std::chrono::steady_clock::now();
+    for (const MeshDescriptor &descriptor : this->descriptors)
+    {
+      VisualPtr visual = scene->CreateVisual();
+      visual->AddGeometry(scene->CreateMesh(descriptor));
+      scene->RootVisual()->AddChild(visual);
+    }
+    camera->Update();
+    auto loaded = std::chrono::steady_clock::now();
+    for (unsigned int i = 0u; i < frameCount; ++i)
+      camera->Update();
+    auto end = std::chrono::steady_clock::now();
+
+    const std::string path = compress ? "compressed" : "uncompressed";
+    this->Report(path,
+        std::chrono::duration<double, std::milli>(loaded - start).count(),
+        1u);
+    const double msPerFrame = std::chrono::duration<double, std::milli>(
+        end - loaded).count() / frameCount;
+    gzdbg << "Path[" << path << "] RenderMsPerFrame[" << msPerFrame << "]"
+      << std::endl;
+    RecordProperty(path + "_render_ms_per_frame", std::to_string(msPerFrame));
+
+    engine->DestroyScene(scene);
+  }
+}
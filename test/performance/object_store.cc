@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+#include <gz/utils/ExtraTestMacros.hh>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Time the scene object store: create, look up and destroy a large
+/// number of visuals.
+class ObjectStoreTest: public CommonRenderingTest
+{
+  /// \brief Time a function and report the result
+  /// \param[in] _name Name of the operation
+  /// \param[in] _count Number of objects the operation works on
+  /// \param[in] _func Function to time
+  public: void Measure(const std::string &_name, unsigned int _count,
+      const std::function<void()> &_func);
+
+  /// \brief Number of visuals in the scene
+  public: const unsigned int count = 100000u;
+};
+
+/////////////////////////////////////////////////
+void ObjectStoreTest::Measure(const std::string &_name, unsigned int _count,
+    const std::function<void()> &_func)
+{
+  auto start = std::chrono::steady_clock::now();
+  _func();
+  auto end = std::chrono::steady_clock::now();
+
+  double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  const double usPerObject = ms * 1000.0 / _count;
+
+  gzdbg << "Op[" << _name << "] Count[" << _count << "] "
+    << "Ms[" << ms << "] UsPerObject[" << usPerObject << "]" << std::endl;
+  RecordProperty(_name + "_us_per_object", std::to_string(usPerObject));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ObjectStoreTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Visuals))
+{
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  std::vector<unsigned int> ids;
+  ids.reserve(this->count);
+  this->Measure("create", this->count, [&]()
+  {
+    for (unsigned int i = 0u; i < this->count; ++i)
+      ids.push_back(scene->CreateVisual()->Id());
+  });
+  ASSERT_EQ(this->count, scene->VisualCount());
+
+  unsigned int found = 0u;
+  this->Measure("lookup_id", this->count, [&]()
+  {
+    for (unsigned int id : ids)
+      found += scene->VisualById(id) ? 1u : 0u;
+  });
+  EXPECT_EQ(this->count, found);
+
+  found = 0u;
+  this->Measure("lookup_node_id", this->count, [&]()
+  {
+    for (unsigned int id : ids)
+      found += scene->NodeById(id) ? 1u : 0u;
+  });
+  EXPECT_EQ(this->count, found);
+
+  std::vector<std::string> names;
+  names.reserve(this->count);
+  for (unsigned int i = 0u; i < this->count; ++i)
+    names.push_back(scene->VisualByIndex(i)->Name());
+
+  found = 0u;
+  this->Measure("lookup_name", this->count, [&]()
+  {
+    for (const std::string &name : names)
+      found += scene->HasVisualName(name) ? 1u : 0u;
+  });
+  EXPECT_EQ(this->count, found);
+
+  // destroy every other visual first, in creation order, to exercise
+  // removal from the middle of the store
+  this->Measure("destroy_id", this->count / 2u, [&]()
+  {
+    for (unsigned int i = 0u; i < this->count; i += 2u)
+      scene->DestroyVisualById(ids[i]);
+  });
+  EXPECT_EQ(this->count / 2u, scene->VisualCount());
+
+  this->Measure("iterate_index", this->count / 2u, [&]()
+  {
+    found = 0u;
+    for (unsigned int i = 0u; i < scene->VisualCount(); ++i)
+      found += scene->VisualByIndex(i) ? 1u : 0u;
+  });
+  EXPECT_EQ(this->count / 2u, found);
+
+  this->Measure("destroy_all", this->count / 2u, [&]()
+  {
+    scene->DestroyVisuals();
+  });
+  EXPECT_EQ(0u, scene->VisualCount());
+
+  engine->DestroyScene(scene);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gz/common/MeshManager.hh>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/MeshDescriptor.hh"
+#include "gz/rendering/RayQuery.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/Visual.hh"
+
+#include <gz/utils/ExtraTestMacros.hh>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Time CPU ray queries (RayQuery::ClosestPoint without a camera)
+/// against a single high resolution mesh
+class RayQueryPerfTest: public CommonRenderingTest
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(RayQueryPerfTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(LargeMesh))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // about 2M triangles
+  const std::string meshName = "ray_query_sphere";
+  const int rings = 1000;
+  const int segments = 1000;
+  common::MeshManager::Instance()->CreateSphere(meshName, 1.0f, rings,
+      segments);
+  MeshDescriptor descriptor(meshName);
+  descriptor.mesh = common::MeshManager::Instance()->MeshByName(meshName);
+  ASSERT_NE(nullptr, descriptor.mesh);
+
+  VisualPtr visual = scene->CreateVisual();
+  ASSERT_NE(nullptr, visual);
+  visual->AddGeometry(scene->CreateMesh(descriptor));
+  visual->SetLocalPosition(5.0, 0.0, 0.0);
+  scene->RootVisual()->AddChild(visual);
+
+  RayQueryPtr rayQuery = scene->CreateRayQuery();
+  ASSERT_NE(nullptr, rayQuery);
+  rayQuery->SetDirection(math::Vector3d::UnitX);
+
+  // the first query builds the mesh triangle hierarchy
+  auto start = std::chrono::steady_clock::now();
+  rayQuery->SetOrigin(math::Vector3d::Zero);
+  RayQueryResult result = rayQuery->ClosestPoint();
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_TRUE(result);
+  EXPECT_NEAR(4.0, result.point.X(), 1e-2);
+  double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  gzdbg << "Op[first] Triangles[" << rings * segments * 2 << "] "
+    << "Ms[" << ms << "]" << std::endl;
+  RecordProperty("first_ms", std::to_string(ms));
+
+  // sweep rays across the sphere
+  const unsigned int queries = 1000u;
+  unsigned int hits = 0u;
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0u; i < queries; ++i)
+  {
+    const double t = static_cast<double>(i) / queries;
+    rayQuery->SetOrigin(math::Vector3d(0.0, 1.2 * t - 0.6, 0.6 - 1.2 * t));
+    if (rayQuery->ClosestPoint(false))
+      ++hits;
+  }
+  end = std::chrono::steady_clock::now();
+  EXPECT_EQ(queries, hits);
+  ms = std::chrono::duration<double, std::milli>(end - start).count();
+  gzdbg << "Op[query] Count[" << queries << "] Ms[" << ms << "] "
+    << "UsPerQuery[" << ms * 1000.0 / queries << "]" << std::endl;
+  RecordProperty("query_us_per_query",
+      std::to_string(ms * 1000.0 / queries));
+
+  // the same rays in one batch
+  std::vector<math::Vector3d> origins;
+  std::vector<math::Vector3d> directions(queries, math::Vector3d::UnitX);
+  for (unsigned int i = 0u; i < queries; ++i)
+  {
+    const double t = static_cast<double>(i) / queries;
+    origins.emplace_back(0.0, 1.2 * t - 0.6, 0.6 - 1.2 * t);
+  }
+  start = std::chrono::steady_clock::now();
+  std::vector<RayQueryResult> results =
+      rayQuery->ClosestPoints(origins, directions, false);
+  end = std::chrono::steady_clock::now();
+  hits = 0u;
+  for (const RayQueryResult &batchResult : results)
+  {
+    if (batchResult)
+      ++hits;
+  }
+  EXPECT_EQ(queries, hits);
+  ms = std::chrono::duration<double, std::milli>(end - start).count();
+  gzdbg << "Op[batch] Count[" << queries << "] Ms[" << ms << "] "
+    << "UsPerQuery[" << ms * 1000.0 / queries << "]" << std::endl;
+  RecordProperty("batch_us_per_query",
+      std::to_string(ms * 1000.0 / queries));
+
+  engine->DestroyScene(scene);
+  common::MeshManager::Instance()->RemoveMesh(meshName);
+}
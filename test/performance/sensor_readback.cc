@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
+#include "CommonRenderingTest.hh"
+
+#include "gz/rendering/BoundingBoxCamera.hh"
+#include "gz/rendering/CameraLens.hh"
+#include "gz/rendering/DepthCamera.hh"
+#include "gz/rendering/GpuRays.hh"
+#include "gz/rendering/Scene.hh"
+#include "gz/rendering/SegmentationCamera.hh"
+#include "gz/rendering/ThermalCamera.hh"
+#include "gz/rendering/WideAngleCamera.hh"
+
+#include <gz/utils/ExtraTestMacros.hh>
+
+using namespace gz;
+using namespace rendering;
+
+/// \brief Per-sensor GPU->CPU readback throughput. The ogre2 readback path
+/// is selected once per process, so the same binary is registered twice:
+/// once as is and once with GZ_RENDERING_OGRE2_LEGACY_READBACK set. Compare
+/// the ms/frame reported by both runs.
+class SensorReadbackTest: public CommonRenderingTest
+{
+  /// \brief Populate the scene with a grid of labelled boxes
+  /// \param[in] _scene Scene to populate
+  public: void BuildScene(ScenePtr _scene);
+
+  /// \brief Time a number of sensor updates and report the result
+  /// \param[in] _name Name of the sensor type
+  /// \param[in] _update Function updating the sensor once
+  public: void Measure(const std::string &_name,
+      const std::function<void()> &_update);
+
+  /// \brief Image width used by all sensors
+  public: const unsigned int width = 640u;
+
+  /// \brief Image height used by all sensors
+  public: const unsigned int height = 480u;
+};
+
+/////////////////////////////////////////////////
+void SensorReadbackTest::BuildScene(ScenePtr _scene)
+{
+  VisualPtr root = _scene->RootVisual();
+  for (int i = -2; i <= 2; ++i)
+  {
+    for (int j = -2; j <= 2; ++j)
+    {
+      VisualPtr box = _scene->CreateVisual();
+      box->AddGeometry(_scene->CreateBox());
+      box->SetLocalPosition(4.0, i * 1.5, j * 1.5);
+      box->SetUserData("label", (i + 2) * 5 + j + 3);
+      box->SetUserData("temperature", 300.0f + i);
+      root->AddChild(box);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void SensorReadbackTest::Measure(const std::string &_name,
+    const std::function<void()> &_update)
+{
+  const unsigned int warmup = 10u;
+  const unsigned int frames = 100u;
+
+  for (unsigned int i = 0u; i < warmup; ++i)
+    _update();
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0u; i < frames; ++i)
+    _update();
+  auto end = std::chrono::steady_clock::now();
+
+  double msPerFrame =
+      std::chrono::duration<double, std::milli>(end - start).count() / frames;
+  const bool legacy =
+      std::getenv("GZ_RENDERING_OGRE2_LEGACY_READBACK") != nullptr;
+  const std::string path = legacy ? "legacy" : "ticket";
+
+  gzdbg << "Sensor[" << _name << "] Path[" << path << "] "
+    << "Size[" << this->width << "x" << this->height << "] "
+    << "MsPerFrame[" << msPerFrame << "]" << std::endl;
+  RecordProperty("readback_path", path);
+  RecordProperty("ms_per_frame", std::to_string(msPerFrame));
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorReadbackTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(DepthCamera))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  this->BuildScene(scene);
+
+  DepthCameraPtr camera = scene->CreateDepthCamera("depth");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(this->width);
+  camera->SetImageHeight(this->height);
+  camera->SetNearClipPlane(0.1);
+  camera->SetFarClipPlane(20.0);
+  camera->CreateDepthTexture();
+  scene->RootVisual()->AddChild(camera);
+
+  common::ConnectionPtr connection = camera->ConnectNewDepthFrame(
+      [](const float *, unsigned int, unsigned int, unsigned int,
+         const std::string &) {});
+
+  this->Measure("depth", [&]() { camera->Update(); });
+
+  connection.reset();
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorReadbackTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(GpuRays))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  this->BuildScene(scene);
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays");
+  ASSERT_NE(nullptr, gpuRays);
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(20.0);
+  gpuRays->SetAngleMin(-GZ_PI);
+  gpuRays->SetAngleMax(GZ_PI);
+  gpuRays->SetRayCount(2048);
+  gpuRays->SetVerticalAngleMin(-0.4);
+  gpuRays->SetVerticalAngleMax(0.4);
+  gpuRays->SetVerticalRayCount(128);
+  scene->RootVisual()->AddChild(gpuRays);
+
+  common::ConnectionPtr connection = gpuRays->ConnectNewGpuRaysFrame(
+      [](const float *, unsigned int, unsigned int, unsigned int,
+         const std::string &) {});
+
+  this->Measure("gpu_rays", [&]() { gpuRays->Update(); });
+
+  connection.reset();
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorReadbackTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(ThermalCamera))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  this->BuildScene(scene);
+
+  ThermalCameraPtr camera = scene->CreateThermalCamera("thermal");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(this->width);
+  camera->SetImageHeight(this->height);
+  camera->SetNearClipPlane(0.1);
+  camera->SetFarClipPlane(20.0);
+  camera->SetAmbientTemperature(296.0f);
+  scene->RootVisual()->AddChild(camera);
+
+  common::ConnectionPtr connection = camera->ConnectNewThermalFrame(
+      [](const uint16_t *, unsigned int, unsigned int, unsigned int,
+         const std::string &) {});
+
+  this->Measure("thermal", [&]() { camera->Update(); });
+
+  connection.reset();
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorReadbackTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SegmentationCamera))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  this->BuildScene(scene);
+
+  SegmentationCameraPtr camera =
+      scene->CreateSegmentationCamera("segmentation");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(this->width);
+  camera->SetImageHeight(this->height);
+  camera->SetSegmentationType(SegmentationType::ST_SEMANTIC);
+  camera->EnableColoredMap(true);
+  scene->RootVisual()->AddChild(camera);
+
+  common::ConnectionPtr connection = camera->ConnectNewSegmentationFrame(
+      [](const uint8_t *, unsigned int, unsigned int, unsigned int,
+         const std::string &) {});
+
+  this->Measure("segmentation", [&]() { camera->Update(); });
+
+  connection.reset();
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorReadbackTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(BoundingBoxCamera))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  this->BuildScene(scene);
+
+  BoundingBoxCameraPtr camera =
+      scene->CreateBoundingBoxCamera("bounding_box");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(this->width);
+  camera->SetImageHeight(this->height);
+  camera->SetBoundingBoxType(BoundingBoxType::BBT_VISIBLEBOX2D);
+  scene->RootVisual()->AddChild(camera);
+
+  common::ConnectionPtr connection = camera->ConnectNewBoundingBoxes(
+      [](const std::vector<BoundingBox> &) {});
+
+  this->Measure("bounding_box", [&]() { camera->Update(); });
+
+  connection.reset();
+  engine->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_F(SensorReadbackTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(WideAngleCamera))
+{
+  CHECK_SUPPORTED_ENGINE("ogre2");
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  this->BuildScene(scene);
+
+  WideAngleCameraPtr camera = scene->CreateWideAngleCamera("wide_angle");
+  ASSERT_NE(nullptr, camera);
+  CameraLens lens;
+  lens.SetCustomMappingFunction(1.05, 4.0, AFT_TAN, 1.0, 0.0);
+  lens.SetType(MFT_CUSTOM);
+  lens.SetCutOffAngle(GZ_PI);
+  camera->SetLens(lens);
+  camera->SetHFOV(2.6);
+  camera->SetImageWidth(this->width);
+  camera->SetImageHeight(this->height);
+  scene->RootVisual()->AddChild(camera);
+
+  common::ConnectionPtr connection = camera->ConnectNewWideAngleFrame(
+      [](const unsigned char *, unsigned int, unsigned int, unsigned int,
+         const std::string &) {});
+
+  this->Measure("wide_angle", [&]() { camera->Update(); });
+
+  connection.reset();
+  engine->DestroyScene(scene);
+}